@@ -12,6 +12,8 @@
  ********************************************************************************/
 
 #include "analyze.h"
+#include <array>
+#include <cstdint>
 #include <iostream>
 #ifdef wxVERSION_NUMBER
     #include <wx/file.h>
@@ -19,6 +21,85 @@
 
 namespace i18n_check
     {
+    namespace
+        {
+        /// @brief Stream buffer that writes its (wide) text to a file as UTF-8,
+        ///     so that a report can be spilled without holding all of its text in memory.
+        class utf8_file_buffer : public std::wstreambuf
+            {
+          public:
+            /** @brief Constructor.
+                @param file The file to write to.*/
+            explicit utf8_file_buffer(std::FILE* file) : m_file(file)
+                {
+                setp(m_buffer.data(), m_buffer.data() + m_buffer.size());
+                }
+
+            /// @returns The number of bytes written to the file.
+            [[nodiscard]]
+            uint64_t get_byte_count() const noexcept
+                {
+                return m_byteCount;
+                }
+
+            /// @returns @c true if any of the text failed to be written.
+            [[nodiscard]]
+            bool has_failed() const noexcept
+                {
+                return m_failed;
+                }
+
+          protected:
+            int_type overflow(int_type ch) override
+                {
+                if (sync() != 0)
+                    {
+                    return traits_type::eof();
+                    }
+                if (!traits_type::eq_int_type(ch, traits_type::eof()))
+                    {
+                    *pptr() = traits_type::to_char_type(ch);
+                    pbump(1);
+                    }
+                return traits_type::not_eof(ch);
+                }
+
+            int sync() override
+                {
+                std::wstring_view text{ pbase(), static_cast<size_t>(pptr() - pbase()) };
+                // don't split a surrogate pair (if wchar_t is UTF-16) across two writes
+                const bool splitSurrogate{ sizeof(wchar_t) == sizeof(uint16_t) &&
+                                           !text.empty() && text.back() >= 0xD800 &&
+                                           text.back() <= 0xDBFF };
+                if (splitSurrogate)
+                    {
+                    text.remove_suffix(1);
+                    }
+                const std::string utf8Str{ i18n_string_util::to_utf8(text) };
+                if (!m_failed &&
+                    std::fwrite(utf8Str.data(), 1, utf8Str.length(), m_file) != utf8Str.length())
+                    {
+                    m_failed = true;
+                    }
+                m_byteCount += utf8Str.length();
+
+                setp(m_buffer.data(), m_buffer.data() + m_buffer.size());
+                if (splitSurrogate)
+                    {
+                    m_buffer[0] = text.data()[text.length()];
+                    pbump(1);
+                    }
+                return m_failed ? -1 : 0;
+                }
+
+          private:
+            std::FILE* m_file{ nullptr };
+            uint64_t m_byteCount{ 0 };
+            bool m_failed{ false };
+            std::array<wchar_t, 4096> m_buffer{};
+            };
+        } // namespace
+
     //------------------------------------------------------
     bool valid_utf8_file(const std::filesystem::path& filePath, bool& startsWithBom)
         {
@@ -224,10 +305,7 @@ namespace i18n_check
         {
         m_filesThatShouldBeConvertedToUTF8.clear();
         m_filesThatContainUTF8Signature.clear();
-        m_cpp->clear_results();
-        m_rc->clear_results();
-        m_po->clear_results();
-        m_csharp->clear_results();
+        clear_results();
 
         size_t currentFileIndex{ 0 };
 
@@ -245,31 +323,16 @@ namespace i18n_check
             try
                 {
                 bool startsWithBom{ false };
-                if (const auto [readUtf8Ok, fileUtf8Text] = read_utf8_file(file, startsWithBom);
+                if (auto [readUtf8Ok, fileUtf8Text] = read_utf8_file(file, startsWithBom);
                     readUtf8Ok)
                     {
                     if (startsWithBom && m_cpp->get_style() & check_utf8_with_signature)
                         {
                         m_filesThatContainUTF8Signature.push_back(file);
                         }
-                    if (fileType == file_review_type::rc)
-                        {
-                        (*m_rc)(fileUtf8Text, file);
-                        }
-                    else if (fileType == file_review_type::po)
-                        {
-                        (*m_po)(fileUtf8Text, file);
-                        }
-                    else if (fileType == file_review_type::cs)
-                        {
-                        (*m_csharp)(fileUtf8Text, file);
-                        }
-                    else
-                        {
-                        (*m_cpp)(fileUtf8Text, file);
-                        }
+                    review_text(retain_text(fileUtf8Text), file, fileType);
                     }
-                else if (const auto [readUtf16Ok, fileUtf16Text] = read_utf16_file(file);
+                else if (auto [readUtf16Ok, fileUtf16Text] = read_utf16_file(file);
                          readUtf16Ok)
                     {
                     // UTF-16 or ANSI may not be supported consistently on
@@ -280,22 +343,7 @@ namespace i18n_check
                         {
                         m_filesThatShouldBeConvertedToUTF8.push_back(file);
                         }
-                    if (fileType == file_review_type::rc)
-                        {
-                        (*m_rc)(fileUtf16Text, file);
-                        }
-                    else if (fileType == file_review_type::po)
-                        {
-                        (*m_po)(fileUtf16Text, file);
-                        }
-                    else if (fileType == file_review_type::cs)
-                        {
-                        (*m_csharp)(fileUtf16Text, file);
-                        }
-                    else
-                        {
-                        (*m_cpp)(fileUtf16Text, file);
-                        }
+                    review_text(retain_text(fileUtf16Text), file, fileType);
                     }
                 else
                     {
@@ -304,7 +352,7 @@ namespace i18n_check
                         m_filesThatShouldBeConvertedToUTF8.push_back(file);
                         }
 #ifdef wxVERSION_NUMBER
-                    const std::wstring str = [&file]()
+                    std::wstring str = [&file]()
                     {
     #if CHECK_GCC_VERSION(12, 2, 1)
                         wxFile ifs(file.wstring());
@@ -323,25 +371,15 @@ namespace i18n_check
                     }();
 #else
                     std::wifstream ifs(file);
-                    const std::wstring str((std::istreambuf_iterator<wchar_t>(ifs)),
-                                           std::istreambuf_iterator<wchar_t>());
+                    std::wstring str((std::istreambuf_iterator<wchar_t>(ifs)),
+                                     std::istreambuf_iterator<wchar_t>());
 #endif
-                    if (fileType == file_review_type::rc)
-                        {
-                        (*m_rc)(str, file);
-                        }
-                    else if (fileType == file_review_type::po)
-                        {
-                        (*m_po)(str, file);
-                        }
-                    else if (fileType == file_review_type::cs)
-                        {
-                        (*m_csharp)(str, file);
-                        }
-                    else
-                        {
-                        (*m_cpp)(str, file);
-                        }
+                    review_text(retain_text(str), file, fileType);
+                    }
+
+                if (m_memoryLimit > 0 && get_results_memory_usage() >= m_memoryLimit)
+                    {
+                    spill_results();
                     }
                 }
             catch (const std::exception& expt)
@@ -365,6 +403,232 @@ namespace i18n_check
             }
         }
 
+    //------------------------------------------------------
+    void batch_analyze::review_text(std::wstring_view text, const std::filesystem::path& file,
+                                    const file_review_type fileType)
+        {
+        if (fileType == file_review_type::rc)
+            {
+            (*m_rc)(text, file);
+            }
+        else if (fileType == file_review_type::po)
+            {
+            (*m_po)(text, file);
+            }
+        else if (fileType == file_review_type::cs)
+            {
+            (*m_csharp)(text, file);
+            }
+        else
+            {
+            (*m_cpp)(text, file);
+            }
+        }
+
+    //------------------------------------------------------
+    std::wstring_view batch_analyze::retain_text(std::wstring& text)
+        {
+        if (!m_retainFileText)
+            {
+            return text;
+            }
+        return m_retainedFileTexts.emplace_back(std::move(text));
+        }
+
+    //------------------------------------------------------
+    void batch_analyze::retain_file_text(const bool retain)
+        {
+        // the results may already refer to text that will no longer be retained
+        if (!retain && !m_retainedFileTexts.empty())
+            {
+            clear_results();
+            }
+        m_retainFileText = retain;
+        m_cpp->set_file_text_retained(retain);
+        m_rc->set_file_text_retained(retain);
+        m_po->set_file_text_retained(retain);
+        m_csharp->set_file_text_retained(retain);
+        }
+
+    //------------------------------------------------------
+    void batch_analyze::clear_results()
+        {
+        clear_analyzer_results();
+        remove_spilled_results();
+        }
+
+    //------------------------------------------------------
+    void batch_analyze::clear_analyzer_results()
+        {
+        m_cpp->clear_results();
+        m_rc->clear_results();
+        m_po->clear_results();
+        m_csharp->clear_results();
+        // the results no longer refer to the text, so it can be freed
+        m_retainedFileTexts.clear();
+        }
+
+    //------------------------------------------------------
+    batch_analyze::~batch_analyze()
+        {
+        if (!m_retainedFileTexts.empty())
+            {
+            clear_results();
+            }
+        remove_spilled_results();
+        }
+
+    //------------------------------------------------------
+    size_t batch_analyze::get_results_memory_usage() const noexcept
+        {
+        size_t usage{ m_cpp->get_results_memory_usage() + m_rc->get_results_memory_usage() +
+                      m_po->get_results_memory_usage() + m_csharp->get_results_memory_usage() };
+        for (const auto& text : m_retainedFileTexts)
+            {
+            usage += text.capacity() * sizeof(wchar_t);
+            }
+        return usage;
+        }
+
+    //------------------------------------------------------
+    void batch_analyze::spill_results()
+        {
+        const auto keepInMemory = [this]()
+        {
+            m_logReport.append(_WXTRANS_WSTR(L"Unable to write the results to a temporary file; "
+                                             "they will be kept in memory."))
+                .append(L"\n");
+            m_memoryLimit = 0;
+        };
+
+        if (m_spilledResults.m_file == nullptr)
+            {
+            m_spilledResults.m_file.reset(std::tmpfile());
+            if (m_spilledResults.m_file == nullptr)
+                {
+                keepInMemory();
+                return;
+                }
+            }
+
+        // the loaded strings need to be reviewed before their results can be written
+        const auto resetProgress = [](const size_t) {};
+        const auto updateProgress = [](const size_t, const std::filesystem::path&)
+        { return true; };
+        m_cpp->review_strings(resetProgress, updateProgress);
+        m_po->review_strings(resetProgress, updateProgress);
+
+        // the report is streamed into the file after a placeholder for its byte count,
+        // which is filled in afterwards
+        std::FILE* spillFile{ m_spilledResults.m_file.get() };
+        std::fpos_t byteCountPosition{};
+        uint64_t byteCount{ 0 };
+        bool written{ std::fgetpos(spillFile, &byteCountPosition) == 0 &&
+                      std::fwrite(&byteCount, sizeof(byteCount), 1, spillFile) == 1 };
+        if (written)
+            {
+            utf8_file_buffer fileBuffer{ spillFile };
+            std::wostream report{ &fileBuffer };
+            // the debug messages aren't cleared with the results, so they are reported at the end
+            format_analyzer_results(report, false);
+            report.flush();
+            byteCount = fileBuffer.get_byte_count();
+            written = !fileBuffer.has_failed() &&
+                      std::fsetpos(spillFile, &byteCountPosition) == 0 &&
+                      std::fwrite(&byteCount, sizeof(byteCount), 1, spillFile) == 1 &&
+                      std::fseek(spillFile, 0, SEEK_END) == 0;
+            }
+        if (!written)
+            {
+            // a partial write is ignored when reading (it is past m_size),
+            // and these (and later) results are kept in memory
+            keepInMemory();
+            return;
+            }
+        m_spilledResults.m_size += sizeof(byteCount) + byteCount;
+
+        m_spilledResults.m_cppStrings += m_cpp->get_localizable_strings().size();
+        m_spilledResults.m_csharpStrings += m_csharp->get_localizable_strings().size();
+        m_spilledResults.m_rcStrings += m_rc->get_localizable_strings().size();
+        m_spilledResults.m_catalogEntries += m_po->get_catalog_entry_count();
+        ++m_spilledResults.m_count;
+
+        clear_analyzer_results();
+        }
+
+    //------------------------------------------------------
+    void batch_analyze::read_spilled_results(std::wostream& report)
+        {
+        std::FILE* spillFile{ m_spilledResults.m_file.get() };
+        if (spillFile == nullptr)
+            {
+            return;
+            }
+
+        std::rewind(spillFile);
+        uint64_t byteCount{ 0 };
+        std::string utf8Str;
+        for (uint64_t bytesRead = 0; bytesRead < m_spilledResults.m_size;
+             bytesRead += sizeof(byteCount) + byteCount)
+            {
+            if (std::fread(&byteCount, sizeof(byteCount), 1, spillFile) != 1)
+                {
+                break;
+                }
+            utf8Str.resize(static_cast<size_t>(byteCount));
+            if (std::fread(utf8Str.data(), 1, utf8Str.length(), spillFile) != utf8Str.length())
+                {
+                break;
+                }
+            report << i18n_string_util::from_utf8(utf8Str);
+            }
+        // more results can be spilled after these
+        std::fseek(spillFile, 0, SEEK_END);
+        }
+
+    //------------------------------------------------------
+    void batch_analyze::remove_spilled_results()
+        {
+        // closing the file deletes it
+        m_spilledResults = spilled_results{};
+        }
+
+    //------------------------------------------------------
+    void batch_analyze::analyze_buffer(std::wstring_view text, const std::filesystem::path& file)
+        {
+        m_filesThatShouldBeConvertedToUTF8.clear();
+        m_filesThatContainUTF8Signature.clear();
+        clear_results();
+
+        // the caller owns the text (and may change it after this returns),
+        // so the results need their own copies of it even if file text is being retained
+        const auto setTextRetained = [this](const bool retained)
+        {
+            m_cpp->set_file_text_retained(retained);
+            m_rc->set_file_text_retained(retained);
+            m_po->set_file_text_retained(retained);
+            m_csharp->set_file_text_retained(retained);
+        };
+        setTextRetained(false);
+
+        try
+            {
+            review_text(text, file, get_file_type(file));
+
+            const auto resetProgress = [](const size_t) {};
+            const auto updateProgress = [](const size_t, const std::filesystem::path&)
+            { return true; };
+            m_cpp->review_strings(resetProgress, updateProgress);
+            m_po->review_strings(resetProgress, updateProgress);
+            }
+        catch (const std::exception& expt)
+            {
+            m_logReport.append(i18n_string_util::lazy_string_to_wstring(expt.what())).append(L"\n");
+            }
+
+        setTextRetained(m_retainFileText);
+        }
+
     //------------------------------------------------------
     std::wstringstream batch_analyze::format_summary(const bool verbose)
         {
@@ -417,364 +681,344 @@ namespace i18n_check
             }
         report << _(L"Statistics") << L"\n###################################################\n"
                << _(L"Strings available for translation within C/C++ source files: ")
-               << m_cpp->get_localizable_strings().size() << L"\n"
+               << m_spilledResults.m_cppStrings + m_cpp->get_localizable_strings().size()
+               << L"\n"
                << _(L"Strings available for translation within C# source files: ")
-               << m_csharp->get_localizable_strings().size() << L"\n"
+               << m_spilledResults.m_csharpStrings + m_csharp->get_localizable_strings().size()
+               << L"\n"
                << _(L"String table entries within Windows resource files: ")
-               << m_rc->get_localizable_strings().size() << L"\n"
+               << m_spilledResults.m_rcStrings + m_rc->get_localizable_strings().size() << L"\n"
                << _(L"Translation entries within PO message catalog files: ")
-               << m_po->get_catalog_entries().size() << L"\n";
+               << m_spilledResults.m_catalogEntries + m_po->get_catalog_entry_count() << L"\n";
 
         return report;
         }
 
     //------------------------------------------------------
-    std::wstringstream batch_analyze::format_results(const bool verbose /*= false*/)
+    void batch_analyze::for_each_result(const analysis_result_callback& callback,
+                                        const bool verbose) const
         {
-        const auto replaceSpecialSpaces = [](const std::wstring& str)
+        const auto replaceSpecialSpaces = [](std::wstring_view str)
         {
-            auto newStr{ str };
+            std::wstring newStr{ str };
             string_util::replace_all(newStr, L'\t', L' ');
             string_util::replace_all(newStr, L'\n', L' ');
             string_util::replace_all(newStr, L'\r', L' ');
             return newStr;
         };
 
-        std::wstringstream report;
-        report << _("File\tLine\tColumn\tValue\tExplanation\tWarningID\n");
+        const auto addResult = [&callback](const std::filesystem::path& file, const size_t line,
+                                           const size_t column, std::wstring value,
+                                           std::wstring explanation,
+                                           const std::wstring_view warningId)
+        {
+            callback(analysis_result{ &file, line, column, std::move(value),
+                                      std::move(explanation), warningId });
+        };
 
         // Windows resource file warnings
+        const auto rcFilePath = [this](const auto& result) -> const std::filesystem::path&
+        { return m_rc->get_file_path(result.m_file_id); };
         for (const auto& val : m_rc->get_unsafe_localizable_strings())
             {
-            report << val.m_file_name << L"\t" << val.m_line << L"\t\t\""
-                   << replaceSpecialSpaces(val.m_string) << L"\"\t\""
-                   << _(L"String available for translation that probably should not be.")
-                   << L"\"\t[suspectL10NString]\n";
+            addResult(rcFilePath(val), val.m_line, std::wstring::npos,
+                      replaceSpecialSpaces(val.m_string),
+                      _WXTRANS_WSTR(L"String available for translation that probably should "
+                                    "not be."),
+                      L"suspectL10NString");
             }
 
         for (const auto& val : m_rc->get_localizable_strings_with_urls())
             {
-            report << val.m_file_name << L"\t" << val.m_line << L"\t\t\""
-                   << replaceSpecialSpaces(val.m_string) << L"\"\t\""
-                   << _(L"String available for translation that contains an URL or email address.")
-                   << L"\"\t[urlInL10NString]\n";
+            addResult(rcFilePath(val), val.m_line, std::wstring::npos,
+                      replaceSpecialSpaces(val.m_string),
+                      _WXTRANS_WSTR(L"String available for translation that contains an URL or "
+                                    "email address."),
+                      L"urlInL10NString");
             }
 
         for (const auto& val : m_rc->get_localizable_strings_with_unlocalizable_content())
             {
-            report << val.m_file_name << L"\t" << val.m_line << L"\t\t\""
-                   << replaceSpecialSpaces(val.m_string) << L"\"\t\""
-                   << _(L"String available for translation that contains a "
-                        "large amount of non-translatable content")
-                   << L"\"\t[excessiveNonL10NContent]\n";
+            addResult(rcFilePath(val), val.m_line, std::wstring::npos,
+                      replaceSpecialSpaces(val.m_string),
+                      _WXTRANS_WSTR(L"String available for translation that contains a "
+                                    "large amount of non-translatable content"),
+                      L"excessiveNonL10NContent");
             }
 
         for (const auto& val : m_rc->get_localizable_strings_with_surrounding_spaces())
             {
-            report << val.m_file_name << L"\t" << val.m_line << L"\t\t\""
-                   << replaceSpecialSpaces(val.m_string) << L"\"\t\""
-                   << _(L"String available for translation that is surrounded by spaces. "
-                        "This string may be getting concatenated at runtime instead of using a "
-                        "formatting function.")
-                   << L"\"\t[spacesAroundL10NString]\n";
+            addResult(rcFilePath(val), val.m_line, std::wstring::npos,
+                      replaceSpecialSpaces(val.m_string),
+                      _WXTRANS_WSTR(L"String available for translation that is surrounded by "
+                                    "spaces. This string may be getting concatenated at runtime "
+                                    "instead of using a formatting function."),
+                      L"spacesAroundL10NString");
             }
 
         for (const auto& val : m_rc->get_bad_dialog_font_sizes())
             {
-            report << val.m_file_name << L"\t" << val.m_line << L"\t\t\""
-                   << replaceSpecialSpaces(val.m_string)
-                   << L"\"\t\""
-                   // this provides more detailed info about the issue
-                   << replaceSpecialSpaces(val.m_usage.m_value) << L"\"\t[fontIssue]\n";
+            // the usage provides more detailed info about the issue
+            addResult(rcFilePath(val), val.m_line, std::wstring::npos,
+                      replaceSpecialSpaces(val.m_string), replaceSpecialSpaces(val.m_usage.m_value),
+                      L"fontIssue");
             }
 
         for (const auto& val : m_rc->get_non_system_dialog_fonts())
             {
-            report << val.m_file_name << L"\t" << val.m_line << L"\t\t\""
-                   << replaceSpecialSpaces(val.m_string) << L"\"\t\""
-                   << replaceSpecialSpaces(val.m_usage.m_value) << L"\"\t[fontIssue]\n";
+            addResult(rcFilePath(val), val.m_line, std::wstring::npos,
+                      replaceSpecialSpaces(val.m_string), replaceSpecialSpaces(val.m_usage.m_value),
+                      L"fontIssue");
             }
 
         // gettext catalogs
-        for (const auto& catEntry : m_po->get_catalog_entries())
+        for (const auto& catalog : m_po->get_catalogs())
             {
-            for (const auto& issue : catEntry.second.m_issues)
+            const std::filesystem::path& catalogPath{ m_po->get_file_path(catalog.m_file_id) };
+            for (const auto& issue : catalog.m_issues)
+                {
+                const size_t line{ catalog.get_entry(issue).m_line };
+                const auto addCatalogResult =
+                    [&addResult, &catalogPath, &catalog, &issue, line](
+                        std::wstring explanation, const std::wstring_view warningId)
                 {
-                if (issue.first == translation_issue::printf_issue)
+                    addResult(catalogPath, line, std::wstring::npos, catalog.get_issue_value(issue),
+                              std::move(explanation), warningId);
+                };
+                if (issue.m_issue == translation_issue::printf_issue)
                     {
-                    report
-                        << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
-                        << issue.second << L"\"\t\""
-                        << _(L"Mismatching printf command between source and translation strings.")
-                        << "\"\t[printfMismatch]\n";
+                    addCatalogResult(_WXTRANS_WSTR(L"Mismatching printf command between source "
+                                                   "and translation strings."),
+                                     L"printfMismatch");
                     }
-                else if (issue.first == translation_issue::suspect_source_issue)
+                else if (issue.m_issue == translation_issue::suspect_source_issue)
                     {
-                    report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
-                           << issue.second << L"\"\t\""
-                           << _(L"String available for translation that probably should not be, or "
-                                "contains a hard-coded URL or email address.")
-                           << "\"\t[suspectL10NString]\n";
+                    addCatalogResult(
+                        _WXTRANS_WSTR(L"String available for translation that probably should not "
+                                      "be, or contains a hard-coded URL or email address."),
+                        L"suspectL10NString");
                     }
-                else if (issue.first == translation_issue::excessive_nonl10n_content)
+                else if (issue.m_issue == translation_issue::excessive_nonl10n_content)
                     {
-                    report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
-                           << issue.second << L"\"\t\""
-                           << _(L"String available for translation that contains a "
-                                "large amount of non-translatable content.")
-                           << "\"\t[excessiveNonL10NContent]\n";
+                    addCatalogResult(_WXTRANS_WSTR(L"String available for translation that "
+                                                   "contains a large amount of non-translatable "
+                                                   "content."),
+                                     L"excessiveNonL10NContent");
                     }
-                else if (issue.first == translation_issue::malformed_translation)
+                else if (issue.m_issue == translation_issue::malformed_translation)
                     {
-                    report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
-                           << issue.second << L"\"\t\""
-                           << _(L"String available for translation that is possibly malformed.")
-                           << "\"\t[malformedString]\n";
+                    addCatalogResult(_WXTRANS_WSTR(L"String available for translation that is "
+                                                   "possibly malformed."),
+                                     L"malformedString");
                     }
-                else if (issue.first == translation_issue::source_surrounding_spaces_issue)
+                else if (issue.m_issue == translation_issue::source_surrounding_spaces_issue)
                     {
-                    report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
-                           << issue.second << L"\"\t\""
-                           << _(L"String available for translation that is surrounded by spaces. "
-                                "This string may be getting concatenated at runtime instead of "
-                                "using a formatting function.")
-                           << "\"\t[spacesAroundL10NString]\n";
+                    addCatalogResult(
+                        _WXTRANS_WSTR(L"String available for translation that is surrounded by "
+                                      "spaces. This string may be getting concatenated at "
+                                      "runtime instead of using a formatting function."),
+                        L"spacesAroundL10NString");
                     }
-                else if (issue.first == translation_issue::source_needing_context_issue)
+                else if (issue.m_issue == translation_issue::source_needing_context_issue)
                     {
-                    report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
-                           << issue.second << L"\"\t\""
-                           << _(L"Ambiguous string available for translation that is "
-                                "lacking a translator comment.")
-                           << "\"\t[L10NStringNeedsContext]\n";
+                    addCatalogResult(_WXTRANS_WSTR(L"Ambiguous string available for translation "
+                                                   "that is lacking a translator comment."),
+                                     L"L10NStringNeedsContext");
                     }
-                else if (issue.first == translation_issue::accelerator_issue)
+                else if (issue.m_issue == translation_issue::accelerator_issue)
                     {
-                    report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
-                           << issue.second << L"\"\t\""
-                           << _(L"Mismatching keyboard accelerators between source "
-                                "and translation strings.")
-                           << "\"\t[acceleratorMismatch]\n";
+                    addCatalogResult(_WXTRANS_WSTR(L"Mismatching keyboard accelerators between "
+                                                   "source and translation strings."),
+                                     L"acceleratorMismatch");
                     }
-                else if (issue.first == translation_issue::number_issue)
+                else if (issue.m_issue == translation_issue::number_issue)
                     {
-                    report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
-                           << issue.second << L"\"\t\""
-                           << _(L"Mismatching numbers between source "
-                                "and translation strings.")
-                           << "\"\t[numberInconsistency]\n";
+                    addCatalogResult(_WXTRANS_WSTR(L"Mismatching numbers between source "
+                                                   "and translation strings."),
+                                     L"numberInconsistency");
                     }
-                else if (issue.first == translation_issue::length_issue)
+                else if (issue.m_issue == translation_issue::length_issue)
                     {
-                    report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
-                           << issue.second << L"\"\t\""
-                           << _(L"Translation is suspiciously longer than the source string.")
-                           << "\"\t[lengthInconsistency]\n";
+                    addCatalogResult(_WXTRANS_WSTR(L"Translation is suspiciously longer than the "
+                                                   "source string."),
+                                     L"lengthInconsistency");
                     }
-                else if (issue.first == translation_issue::consistency_issue)
+                else if (issue.m_issue == translation_issue::consistency_issue)
                     {
-                    report
-                        << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
-                        << issue.second << L"\"\t\""
-                        << _(L"Mismatching first character casing or trailing punctuation, spaces, "
-                             "or newlines between source and translation strings.")
-                        << "\"\t[transInconsistency]\n";
+                    addCatalogResult(
+                        _WXTRANS_WSTR(L"Mismatching first character casing or trailing "
+                                      "punctuation, spaces, or newlines between source and "
+                                      "translation strings."),
+                        L"transInconsistency");
                     }
                 }
             }
 
         // Source code warnings
-        const auto formatSourceFileWarnings =
-            [&replaceSpecialSpaces, &report, &verbose](const auto* sourceParser)
+        const auto addSourceFileResults = [&replaceSpecialSpaces, &addResult,
+                                           verbose](const auto* sourceParser)
         {
+            using usage_type = i18n_review::string_info::usage_info::usage_type;
+
+            const auto filePath = [sourceParser](const auto& result) -> const std::filesystem::path&
+            { return sourceParser->get_file_path(result.m_file_id); };
+            // a string's warning, with the column where it is
+            const auto addStringResult = [&addResult, &replaceSpecialSpaces, &filePath](
+                                             const i18n_review::string_info& val,
+                                             std::wstring explanation,
+                                             const std::wstring_view warningId)
+            {
+                addResult(filePath(val), val.m_line, val.m_column,
+                          replaceSpecialSpaces(val.m_string), std::move(explanation), warningId);
+            };
+            // an explanation that depends on how the string is used, followed by its usage
+            const auto usageExplanation =
+                [](const i18n_review::string_info& val, std::wstring functionExplanation,
+                   std::wstring variableExplanation, std::wstring otherExplanation)
+            {
+                std::wstring explanation{ (val.m_usage.m_type == usage_type::function) ?
+                                              std::move(functionExplanation) :
+                                          (val.m_usage.m_type == usage_type::variable) ?
+                                              std::move(variableExplanation) :
+                                              std::move(otherExplanation) };
+                return explanation.append(val.m_usage.m_value);
+            };
+
             for (const auto& val : sourceParser->get_unsafe_localizable_strings())
                 {
-                report << val.m_file_name << L"\t" << val.m_line << L"\t" << val.m_column << L"\t"
-                       << L"\"" << replaceSpecialSpaces(val.m_string) << L"\"\t\"";
-                if (val.m_usage.m_type ==
-                    i18n_review::string_info::usage_info::usage_type::function)
-                    {
-                    report << _(L"String available for translation that probably "
-                                "should not be in function call: ")
-                           << val.m_usage.m_value << L"\"\t";
-                    }
-                else if (val.m_usage.m_type ==
-                         i18n_review::string_info::usage_info::usage_type::variable)
-                    {
-                    report << _(L"String available for translation that probably "
-                                "should not be assigned to variable: ")
-                           << val.m_usage.m_value << L"\"\t";
-                    }
-                else
-                    {
-                    report << _(L"String available for translation that probably "
-                                "should not be within: ")
-                           << val.m_usage.m_value << L"\"\t";
-                    }
-                report << L"[suspectL10NString]\n";
+                addStringResult(val,
+                                usageExplanation(val,
+                                                 _WXTRANS_WSTR(L"String available for translation "
+                                                               "that probably should not be in "
+                                                               "function call: "),
+                                                 _WXTRANS_WSTR(L"String available for translation "
+                                                               "that probably should not be "
+                                                               "assigned to variable: "),
+                                                 _WXTRANS_WSTR(L"String available for translation "
+                                                               "that probably should not be "
+                                                               "within: ")),
+                                L"suspectL10NString");
                 }
 
             for (const auto& val : sourceParser->get_localizable_strings_with_urls())
                 {
-                report << val.m_file_name << L"\t" << val.m_line << L"\t" << val.m_column << L"\t"
-                       << L"\"" << replaceSpecialSpaces(val.m_string) << L"\"\t\"";
-                if (val.m_usage.m_type ==
-                    i18n_review::string_info::usage_info::usage_type::function)
-                    {
-                    report << _(L"String available for translation that contains an "
-                                "URL or email address in function call: ")
-                           << val.m_usage.m_value << L"\"\t";
-                    }
-                else if (val.m_usage.m_type ==
-                         i18n_review::string_info::usage_info::usage_type::variable)
-                    {
-                    report << _(L"String available for translation that contains an "
-                                "URL or email address assigned to variable: ")
-                           << val.m_usage.m_value << L"\"\t";
-                    }
-                else
-                    {
-                    report << _(L"String available for translation that contains an "
-                                "URL or email address within: ")
-                           << val.m_usage.m_value << L"\"\t";
-                    }
-                report << L"[urlInL10NString]\n";
+                addStringResult(val,
+                                usageExplanation(val,
+                                                 _WXTRANS_WSTR(L"String available for translation "
+                                                               "that contains an URL or email "
+                                                               "address in function call: "),
+                                                 _WXTRANS_WSTR(L"String available for translation "
+                                                               "that contains an URL or email "
+                                                               "address assigned to variable: "),
+                                                 _WXTRANS_WSTR(L"String available for translation "
+                                                               "that contains an URL or email "
+                                                               "address within: ")),
+                                L"urlInL10NString");
                 }
 
             for (const auto& val :
                  sourceParser->get_localizable_strings_with_unlocalizable_content())
                 {
-                report << val.m_file_name << L"\t" << val.m_line << L"\t" << val.m_column << L"\t"
-                       << L"\"" << replaceSpecialSpaces(val.m_string) << L"\"\t\"";
-                    report << _(L"String available for translation that contains a "
-                                "large amount of non-translatable.");
-                report << L"\t\"[excessiveNonL10NContent]\n";
+                addStringResult(val,
+                                _WXTRANS_WSTR(L"String available for translation that contains a "
+                                              "large amount of non-translatable."),
+                                L"excessiveNonL10NContent");
                 }
 
             for (const auto& val : sourceParser->get_suspect_i18n_usuage())
                 {
-                report << val.m_file_name << L"\t" << val.m_line << L"\t" << val.m_column << L"\t"
-                       << L"\"" << replaceSpecialSpaces(val.m_string) << L"\"\t\"";
-                report << val.m_usage.m_value;
-                report << L"\t\"[suspectI18NUsage]\n";
+                addStringResult(val, std::wstring{ val.m_usage.m_value }, L"suspectI18NUsage");
                 }
 
             for (const auto& val :
                  sourceParser->get_localizable_strings_ambiguous_needing_context())
                 {
-                report << val.m_file_name << L"\t" << val.m_line << L"\t" << val.m_column << L"\t"
-                       << L"\"" << replaceSpecialSpaces(val.m_string) << L"\"\t\"";
-                report << _(L"Ambiguous string available for translation that is "
-                            "lacking a translator comment.");
-                report << L"\t\"[L10NStringNeedsContext]\n";
+                addStringResult(val,
+                                _WXTRANS_WSTR(L"Ambiguous string available for translation that "
+                                              "is lacking a translator comment."),
+                                L"L10NStringNeedsContext");
                 }
 
             for (const auto& val : sourceParser->get_localizable_strings_with_surrounding_spaces())
                 {
-                report << val.m_file_name << L"\t" << val.m_line << L"\t" << val.m_column << L"\t"
-                       << L"\"" << replaceSpecialSpaces(val.m_string) << L"\"\t\"";
-                report << _(L"String available for translation that is surrounded by spaces. "
-                            "This string may be getting concatenated at runtime instead of "
-                            "using a formatting function.");
-                report << L"\"\t[spacesAroundL10NString]\n";
+                addStringResult(val,
+                                _WXTRANS_WSTR(L"String available for translation that is "
+                                              "surrounded by spaces. This string may be getting "
+                                              "concatenated at runtime instead of using a "
+                                              "formatting function."),
+                                L"spacesAroundL10NString");
                 }
 
             for (const auto& val : sourceParser->get_localizable_strings_in_internal_call())
                 {
-                report << val.m_file_name << L"\t" << val.m_line << L"\t" << val.m_column << L"\t"
-                       << L"\"" << replaceSpecialSpaces(val.m_string) << L"\"\t\"";
-                if (val.m_usage.m_type ==
-                    i18n_review::string_info::usage_info::usage_type::function)
-                    {
-                    report << _(L"Localizable string being used within non-user"
-                                " facing function call: ")
-                           << val.m_usage.m_value << L"\"\t";
-                    }
-                else if (val.m_usage.m_type ==
-                         i18n_review::string_info::usage_info::usage_type::variable)
-                    {
-                    report << _(L"Localizable string being assigned to non-user facing variable: ")
-                           << val.m_usage.m_value << L"\"\t";
-                    }
-                else
-                    {
-                    report << _(L"Localizable string being assigned to: ") << val.m_usage.m_value
-                           << L"\"\t";
-                    }
-                report << L"[suspectL10NUsage]\n";
+                addStringResult(val,
+                                usageExplanation(val,
+                                                 _WXTRANS_WSTR(L"Localizable string being used "
+                                                               "within non-user facing function "
+                                                               "call: "),
+                                                 _WXTRANS_WSTR(L"Localizable string being assigned "
+                                                               "to non-user facing variable: "),
+                                                 _WXTRANS_WSTR(L"Localizable string being "
+                                                               "assigned to: ")),
+                                L"suspectL10NUsage");
                 }
 
             for (const auto& val : sourceParser->get_not_available_for_localization_strings())
                 {
-                report << val.m_file_name << L"\t" << val.m_line << L"\t" << val.m_column << L"\t"
-                       << L"\"" << replaceSpecialSpaces(val.m_string) << L"\"\t\"";
-                if (val.m_usage.m_type ==
-                    i18n_review::string_info::usage_info::usage_type::function)
-                    {
-                    report << _(L"String not available for translation in function call: ")
-                           << val.m_usage.m_value << L"\"\t";
-                    }
-                else if (val.m_usage.m_type ==
-                         i18n_review::string_info::usage_info::usage_type::variable)
-                    {
-                    report << _(L"String not available for translation assigned to variable: ")
-                           << val.m_usage.m_value << L"\"\t";
-                    }
-                else
-                    {
-                    report << _(L"String not available for translation assigned to: ")
-                           << val.m_usage.m_value << L"\"\t";
-                    }
-                report << L"[notL10NAvailable]\n";
+                addStringResult(val,
+                                usageExplanation(val,
+                                                 _WXTRANS_WSTR(L"String not available for "
+                                                               "translation in function call: "),
+                                                 _WXTRANS_WSTR(L"String not available for "
+                                                               "translation assigned to "
+                                                               "variable: "),
+                                                 _WXTRANS_WSTR(L"String not available for "
+                                                               "translation assigned to: ")),
+                                L"notL10NAvailable");
                 }
 
             for (const auto& val : sourceParser->get_deprecated_macros())
                 {
-                report << val.m_file_name << L"\t" << val.m_line << L"\t" << val.m_column << L"\t\""
-                       << replaceSpecialSpaces(val.m_string) << L"\"\t\"" << val.m_usage.m_value
-                       << L"\"\t[deprecatedMacro]\n";
+                addStringResult(val, std::wstring{ val.m_usage.m_value }, L"deprecatedMacro");
                 }
 
             for (const auto& val : sourceParser->get_printf_single_numbers())
                 {
-                report << val.m_file_name << L"\t" << val.m_line << L"\t" << val.m_column << L"\t\""
-                       << replaceSpecialSpaces(val.m_string) << L"\"\t\""
-                       << _(L"Prefer using std::to_[w]string() instead of printf() to "
-                            "format a number.")
-                       << L"\"\t[printfSingleNumber]\n";
+                addStringResult(val,
+                                _WXTRANS_WSTR(L"Prefer using std::to_[w]string() instead of "
+                                              "printf() to format a number."),
+                                L"printfSingleNumber");
                 }
 
             for (const auto& val : sourceParser->get_duplicates_value_assigned_to_ids())
                 {
-                report << val.m_file_name << L"\t" << val.m_line << L"\t\t"
-                       << replaceSpecialSpaces(val.m_string) << L"\t\""
-                       << _(L"Verify that duplicate assignment was intended. "
-                            "If correct, consider assigning the first ID variable by name "
-                            "to the second one to make this intention clear.")
-                       << L"\"\t[dupValAssignedToIds]\n";
+                addResult(filePath(val), val.m_line, std::wstring::npos,
+                          replaceSpecialSpaces(val.m_string),
+                          _WXTRANS_WSTR(L"Verify that duplicate assignment was intended. "
+                                        "If correct, consider assigning the first ID variable by "
+                                        "name to the second one to make this intention clear."),
+                          L"dupValAssignedToIds");
                 }
 
             for (const auto& val : sourceParser->get_ids_assigned_number())
                 {
-                report << val.m_file_name << L"\t" << val.m_line << L"\t\t"
-                       << replaceSpecialSpaces(val.m_string) << L"\t\""
-                       << _(L"Prefer using ID constants provided by your framework when "
-                            "assigning values to an ID variable.")
-                       << L"\"\t[numberAssignedToId]\n";
+                addResult(filePath(val), val.m_line, std::wstring::npos,
+                          replaceSpecialSpaces(val.m_string),
+                          _WXTRANS_WSTR(L"Prefer using ID constants provided by your framework "
+                                        "when assigning values to an ID variable."),
+                          L"numberAssignedToId");
                 }
 
             for (const auto& val : sourceParser->get_malformed_strings())
                 {
-                report << val.m_file_name << L"\t" << val.m_line << L"\t" << val.m_column << L"\t\""
-                       << replaceSpecialSpaces(val.m_string) << L"\"\t\""
-                       << _(L"Malformed syntax in string.") << L"\"\t[malformedString]\n";
+                addStringResult(val, _WXTRANS_WSTR(L"Malformed syntax in string."),
+                                L"malformedString");
                 }
 
             for (const auto& val : sourceParser->get_unencoded_ext_ascii_strings())
                 {
                 std::wstringstream encodingRecommendations;
-                auto untabbedStr{ replaceSpecialSpaces(val.m_string) };
-                for (const auto& ch : untabbedStr)
+                for (const auto& ch : replaceSpecialSpaces(val.m_string))
                     {
                     if (ch > 127)
                         {
@@ -788,65 +1032,106 @@ namespace i18n_check
                         }
                     }
 
-                report << val.m_file_name << L"\t" << val.m_line << L"\t" << val.m_column << L"\t"
-                       << L"\"" << replaceSpecialSpaces(val.m_string) << L"\"\t\""
-                       << _(L"String contains extended ASCII characters that should be encoded. "
-                            "Recommended change: '")
-                       << encodingRecommendations.str() << L"'\"\t[unencodedExtASCII]\n";
+                addStringResult(val,
+                                _WXTRANS_WSTR(L"String contains extended ASCII characters that "
+                                              "should be encoded. Recommended change: '") +
+                                    encodingRecommendations.str() + L"'",
+                                L"unencodedExtASCII");
                 }
 
             for (const auto& val : sourceParser->get_trailing_spaces())
                 {
-                report << val.m_file_name << L"\t" << val.m_line << L"\t" << val.m_column << L"\t\""
-                       << replaceSpecialSpaces(val.m_string) << L"\"\t\""
-                       << _(L"Trailing space(s) detected at end of line.")
-                       << L"\"\t[trailingSpaces]\n";
+                addStringResult(val, _WXTRANS_WSTR(L"Trailing space(s) detected at end of line."),
+                                L"trailingSpaces");
                 }
 
             for (const auto& val : sourceParser->get_tabs())
                 {
-                report << val.m_file_name << L"\t" << val.m_line << L"\t" << val.m_column << L"\t\""
-                       << replaceSpecialSpaces(val.m_string) << L"\"\t\""
-                       << _(L"Tab detected in file; prefer using spaces.") << L"\"\t[tabs]\n";
+                addStringResult(val, _WXTRANS_WSTR(L"Tab detected in file; prefer using spaces."),
+                                L"tabs");
                 }
 
             for (const auto& val : sourceParser->get_wide_lines())
                 {
-                report << val.m_file_name << L"\t" << val.m_line << L"\t" << val.m_column << L"\t\""
-                       << replaceSpecialSpaces(val.m_string) << L"\"\t\"" << _(L"Line length: ")
-                       << val.m_usage.m_value << L"\"\t[wideLine]\n";
+                addStringResult(
+                    val, _WXTRANS_WSTR(L"Line length: ") + std::wstring{ val.m_usage.m_value },
+                    L"wideLine");
                 }
 
             for (const auto& val : sourceParser->get_comments_missing_space())
                 {
-                report << val.m_file_name << L"\t" << val.m_line << L"\t" << val.m_column << L"\t\""
-                       << replaceSpecialSpaces(val.m_string) << L"\"\t\""
-                       << _(L"Space should be inserted between comment tag and comment.")
-                       << L"\"\t[commentMissingSpace]\n";
+                addStringResult(val,
+                                _WXTRANS_WSTR(L"Space should be inserted between comment tag and "
+                                              "comment."),
+                                L"commentMissingSpace");
                 }
 
             if (verbose)
                 {
                 for (const auto& parseErr : sourceParser->get_error_log())
                     {
-                    report << parseErr.m_file_name << L"\t";
-                    if (parseErr.m_line != std::wstring::npos)
-                        {
-                        report << parseErr.m_line;
-                        }
-                    report << L"\t";
-                    if (parseErr.m_column != std::wstring::npos)
-                        {
-                        report << parseErr.m_column;
-                        }
-                    report << L"\t\"" << parseErr.m_resourceString << L"\"\t\""
-                           << parseErr.m_message << L"\"\t[debugParserInfo]\n";
+                    addResult(filePath(parseErr), parseErr.m_line, parseErr.m_column,
+                              std::wstring{ parseErr.m_resourceString },
+                              std::wstring{ parseErr.get_message() }, L"debugParserInfo");
+                    }
+                if (sourceParser->get_dropped_error_log_count() > 0)
+                    {
+                    addResult(std::filesystem::path{}, std::wstring::npos, std::wstring::npos,
+                              std::wstring{},
+                              std::to_wstring(sourceParser->get_dropped_error_log_count()) +
+                                  _WXTRANS_WSTR(L" additional messages were not logged."),
+                              L"debugParserInfo");
                     }
                 }
         };
 
-        formatSourceFileWarnings(m_cpp);
-        formatSourceFileWarnings(m_csharp);
+        addSourceFileResults(m_cpp);
+        addSourceFileResults(m_csharp);
+        }
+
+    //------------------------------------------------------
+    void batch_analyze::format_analyzer_results(std::wostream& report, const bool verbose)
+        {
+        for_each_result(
+            [&report](const analysis_result& result)
+            {
+                if (!result.m_file->empty())
+                    {
+                    report << *result.m_file;
+                    }
+                report << L"\t";
+                if (result.m_line != std::wstring::npos)
+                    {
+                    report << result.m_line;
+                    }
+                report << L"\t";
+                if (result.m_column != std::wstring::npos)
+                    {
+                    report << result.m_column;
+                    }
+                report << L"\t\"" << result.m_value << L"\"\t\"" << result.m_explanation
+                       << L"\"\t[" << result.m_warningId << L"]\n";
+            },
+            verbose);
+        }
+
+    //------------------------------------------------------
+    std::wstringstream batch_analyze::format_results(const bool verbose /*= false*/)
+        {
+        std::wstringstream report;
+        format_results(report, verbose);
+        return report;
+        }
+
+    //------------------------------------------------------
+    void batch_analyze::format_results(std::wostream& report, const bool verbose /*= false*/)
+        {
+        report << _("File\tLine\tColumn\tValue\tExplanation\tWarningID\n");
+
+        // results from earlier in the analysis that were moved out of memory
+        read_spilled_results(report);
+
+        format_analyzer_results(report, verbose);
 
         for (const auto& file : m_filesThatShouldBeConvertedToUTF8)
             {
@@ -864,7 +1149,151 @@ namespace i18n_check
                         "best compiler portability.")
                    << L"\"\t[UTF8FileWithBOM]\n";
             }
+        }
 
-        return report;
+    //------------------------------------------------------
+    report_reader::int_type report_reader::overflow(int_type ch)
+        {
+        if (!traits_type::eq_int_type(ch, traits_type::eof()))
+            {
+            const char_type chr{ traits_type::to_char_type(ch) };
+            xsputn(&chr, 1);
+            }
+        return traits_type::not_eof(ch);
+        }
+
+    //------------------------------------------------------
+    std::streamsize report_reader::xsputn(const char_type* text, std::streamsize count)
+        {
+        const std::wstring_view str{ text, static_cast<size_t>(count) };
+        size_t start{ 0 };
+        for (auto newLine = str.find(L'\n'); newLine != std::wstring_view::npos;
+             newLine = str.find(L'\n', start))
+            {
+            m_line.append(str.substr(start, newLine - start));
+            read_line();
+            start = newLine + 1;
+            }
+        m_line.append(str.substr(start));
+        return count;
+        }
+
+    //------------------------------------------------------
+    void report_reader::finish()
+        {
+        if (!m_line.empty())
+            {
+            read_line();
+            }
+        }
+
+    //------------------------------------------------------
+    void report_reader::read_line()
+        {
+        const auto toNumber = [](const std::wstring& str)
+        {
+            size_t value{ std::wstring::npos };
+            try
+                {
+                value = str.empty() ? std::wstring::npos : std::stoull(str);
+                }
+            catch (...)
+                {
+                }
+            return value;
+        };
+
+        // file paths are streamed quoted (with their quotes and backslashes escaped)
+        const auto unquotePath = [](const std::wstring_view str)
+        {
+            if (str.length() < 2 || str.front() != L'"' || str.back() != L'"')
+                {
+                return std::filesystem::path{ str };
+                }
+            std::wstring unquoted;
+            unquoted.reserve(str.length());
+            for (size_t i = 1; i < str.length() - 1; ++i)
+                {
+                if (str[i] == L'\\' && i + 2 < str.length())
+                    {
+                    ++i;
+                    }
+                unquoted += str[i];
+                }
+            return std::filesystem::path{ unquoted };
+        };
+
+        if (!m_headerRead)
+            {
+            m_headerRead = true;
+            if (m_headerCallback)
+                {
+                m_headerCallback(m_line);
+                }
+            m_line.clear();
+            return;
+            }
+
+        if (!m_currentRow.empty())
+            {
+            m_currentRow += L'\n';
+            }
+        m_currentRow += m_line;
+        m_line.clear();
+        const auto idStart = m_currentRow.rfind(L"\t[");
+        if (idStart == std::wstring::npos || !m_currentRow.ends_with(L']'))
+            {
+            return;
+            }
+
+        const auto lineStart = m_currentRow.find(L'\t');
+        const auto columnStart = (lineStart != std::wstring::npos) ?
+                                     m_currentRow.find(L'\t', lineStart + 1) :
+                                     std::wstring::npos;
+        const auto valueStart = (columnStart != std::wstring::npos) ?
+                                    m_currentRow.find(L'\t', columnStart + 1) :
+                                    std::wstring::npos;
+        if (valueStart != std::wstring::npos && valueStart < idStart)
+            {
+            report_row row;
+            row.m_file = unquotePath(std::wstring_view{ m_currentRow }.substr(0, lineStart));
+            row.m_line = toNumber(m_currentRow.substr(lineStart + 1, columnStart - lineStart - 1));
+            row.m_column =
+                toNumber(m_currentRow.substr(columnStart + 1, valueStart - columnStart - 1));
+            row.m_warningId =
+                m_currentRow.substr(idStart + 2, m_currentRow.length() - idStart - 3);
+            // the explanation is a fixed message, so the last quote/tab/quote
+            // is what separates it from the value
+            const std::wstring_view quotedFields{ std::wstring_view{ m_currentRow }.substr(
+                valueStart + 1, idStart - valueStart - 1) };
+            const auto separator = quotedFields.rfind(L"\"\t\"");
+            if (separator != std::wstring_view::npos && quotedFields.length() >= 4)
+                {
+                row.m_value = quotedFields.substr(1, separator - 1);
+                row.m_explanation =
+                    quotedFields.substr(separator + 3, quotedFields.length() - separator - 4);
+                }
+            row.m_text = std::move(m_currentRow);
+            m_rowCallback(std::move(row));
+            }
+        m_currentRow.clear();
+        }
+
+    //------------------------------------------------------
+    void parse_report(std::wistream& report, const report_row_callback& callback)
+        {
+        report_reader reader{ callback };
+        std::wostream rowStream{ &reader };
+        rowStream << report.rdbuf();
+        reader.finish();
+        }
+
+    //------------------------------------------------------
+    std::vector<report_row> parse_report(const std::wstring& report)
+        {
+        std::vector<report_row> rows;
+        std::wistringstream reportStream{ report };
+        parse_report(reportStream, [&rows](report_row&& row) { rows.push_back(std::move(row)); });
+        return rows;
         }
     } // namespace i18n_check
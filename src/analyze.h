@@ -26,10 +26,14 @@
 #include "rc_file_review.h"
 #include "unicode_extract_text.h"
 #include "utfcpp/source/utf8.h"
+#include <cstdio>
+#include <deque>
 #include <filesystem>
 #include <fstream>
 #include <functional>
+#include <memory>
 #include <sstream>
+#include <streambuf>
 #include <string>
 #include <vector>
 
@@ -85,6 +89,106 @@ namespace i18n_check
         return (fileType == file_review_type::cpp || fileType == file_review_type::cs);
         }
 
+    /// @brief A warning from the analyzers' results (see batch_analyze::for_each_result()).
+    struct analysis_result
+        {
+        /// @brief The file that the warning is in (empty if not connected to a file).
+        /// @details This is owned by the analyzer that found the warning.
+        const std::filesystem::path* m_file{ nullptr };
+        /// @brief The (one-indexed) line, or @c npos if not available.
+        size_t m_line{ std::wstring::npos };
+        /// @brief The (one-indexed) column, or @c npos if not available.
+        size_t m_column{ std::wstring::npos };
+        /// @brief The string (or other text) that the warning is about.
+        std::wstring m_value;
+        /// @brief A description of the warning.
+        std::wstring m_explanation;
+        /// @brief The warning ID (e.g., @c suspectL10NString).
+        std::wstring_view m_warningId;
+        };
+
+    /// @brief Callback that receives each warning from batch_analyze::for_each_result().
+    using analysis_result_callback = std::function<void(const analysis_result&)>;
+
+    /// @brief A warning read back from a report created by batch_analyze::format_results().
+    struct report_row
+        {
+        std::filesystem::path m_file;
+        /// @brief The (one-indexed) line, or @c npos if not available.
+        size_t m_line{ std::wstring::npos };
+        /// @brief The (one-indexed) column, or @c npos if not available.
+        size_t m_column{ std::wstring::npos };
+        std::wstring m_value;
+        std::wstring m_explanation;
+        /// @brief The warning ID (without its brackets).
+        std::wstring m_warningId;
+        /// @brief The row's original text (without its trailing newline).
+        std::wstring m_text;
+        };
+
+    /// @brief Callback that receives each warning read from a report
+    ///     (which it can take ownership of).
+    using report_row_callback = std::function<void(report_row&&)>;
+
+    /** @brief Reads the warnings from a report as it is being written
+            (e.g., by batch_analyze::format_results()), one row at a time.
+        @details Write the report to a @c std::wostream that uses this as its buffer,
+            and then call finish() after the report has been written.\n
+            Rows are "File\tLine\tColumn\t"Value"\t"Explanation"\t[WarningID]".
+            Because some values may contain newlines, a row is read until it ends with its ID.
+        @par Example:
+        @code
+            i18n_check::report_reader reader{ [](const i18n_check::report_row& row)
+                                              { std::wcout << row.m_value << L"\n"; } };
+            std::wostream rowStream{ &reader };
+            analyzer.format_results(rowStream);
+            reader.finish();
+        @endcode*/
+    class report_reader : public std::wstreambuf
+        {
+      public:
+        /** @brief Constructor.
+            @param rowCallback The function to send each warning to.
+            @param headerCallback The function to send the report's first line
+                (its column headers) to.*/
+        explicit report_reader(report_row_callback rowCallback,
+                               std::function<void(const std::wstring&)> headerCallback = {})
+            : m_rowCallback(std::move(rowCallback)), m_headerCallback(std::move(headerCallback))
+            {
+            }
+
+        /// @brief Reads the last line of the report (if it didn't end with a newline).
+        void finish();
+
+      protected:
+        /// @private
+        int_type overflow(int_type ch) override;
+        /// @private
+        std::streamsize xsputn(const char_type* text, std::streamsize count) override;
+
+      private:
+        void read_line();
+
+        report_row_callback m_rowCallback;
+        std::function<void(const std::wstring&)> m_headerCallback;
+        std::wstring m_line;
+        // the lines read so far of a row whose value spans multiple lines
+        std::wstring m_currentRow;
+        bool m_headerRead{ false };
+        };
+
+    /** @brief Parses the warnings from a report created by batch_analyze::format_results(),
+            one row at a time.
+        @param report The report (including its header).
+        @param callback The function to send each warning to.*/
+    void parse_report(std::wistream& report, const report_row_callback& callback);
+
+    /** @brief Parses the warnings from a report created by batch_analyze::format_results().
+        @param report The report's text (including its header).
+        @returns The warnings from the report.*/
+    [[nodiscard]]
+    std::vector<report_row> parse_report(const std::wstring& report);
+
     /// @brief Wrapper class to analyze and summarize a batch of files.
     class batch_analyze
         {
@@ -105,6 +209,62 @@ namespace i18n_check
         /// @private
         batch_analyze& operator=(const batch_analyze&) = delete;
 
+        /// @brief Destructor.
+        /// @details If file text was retained, then the analyzers' results are cleared
+        ///     (because they refer to the text that is being freed).
+        ~batch_analyze();
+
+        /** @brief Sets whether the text of each file should be kept after it is loaded
+                (until the next analysis), so that the analyzers' results can refer to it
+                rather than copying their strings.
+            @details This reduces the number of copies and allocations when there are many
+                results, but all of the files' text is kept in memory until the results
+                are cleared.\n
+                This does not affect analyze_buffer(), whose text is owned by the caller
+                (the analyzers copy its strings, regardless of this setting).
+            @param retain @c true to retain the text of the files.*/
+        void retain_file_text(const bool retain);
+
+        /// @returns @c true if the text of each file is kept for the analyzers' results.
+        [[nodiscard]]
+        bool is_retaining_file_text() const noexcept
+            {
+            return m_retainFileText;
+            }
+
+        /** @brief Sets the (approximate) amount of memory that the analyzers' results
+                can use during analyze().
+            @details When the results of the files analyzed so far (and any text retained
+                for them) reach this, they are reviewed, written to a temporary file, and
+                cleared from the analyzers. The written results are read back by
+                format_results(), so this bounds the memory used while analyzing a large
+                number of files, at the cost of some extra I/O.\n
+                The analyzers' error logs and file path tables are kept until the end of the
+                analysis, so they are not counted against this limit
+                (see i18n_review::get_results_memory_usage()).\n
+                Note that after an analysis that needed to do this, the analyzers only
+                hold the results of the last files analyzed, so format_results()
+                and format_summary() should be used (rather than the analyzers) to get
+                all of the results.
+            @param limit The memory limit (in bytes), or @c 0 for no limit (the default).*/
+        void set_memory_limit(const size_t limit) noexcept { m_memoryLimit = limit; }
+
+        /// @returns The (approximate) amount of memory that the analyzers' results can
+        ///     use during analyze(), or @c 0 if there is no limit.
+        [[nodiscard]]
+        size_t get_memory_limit() const noexcept
+            {
+            return m_memoryLimit;
+            }
+
+        /// @returns The number of times that results were written to a temporary file
+        ///     because of the memory limit (during the last call to analyze()).
+        [[nodiscard]]
+        size_t get_spill_count() const noexcept
+            {
+            return m_spilledResults.m_count;
+            }
+
         /** @brief Runs all analyzers on a set of files.
             @param filesToAnalyze The files to analyze.
             @param resetCallback Callback function to tell the progress system in @c callback
@@ -115,6 +275,17 @@ namespace i18n_check
         void analyze(const std::vector<std::filesystem::path>& filesToAnalyze,
                      analyze_callback_reset resetCallback, analyze_callback callback);
 
+        /** @brief Analyzes a single in-memory buffer (e.g., an unsaved document in an editor).
+            @details The analyzers' previous results are cleared, so afterwards
+                format_results() will only contain this buffer's results.\n
+                The analyzers (and their rule tables) are reused, so this is meant to be
+                called repeatedly as a document is edited.
+            @param text The text to analyze.
+            @param file The path of the document that @c text is from.
+                This is only used to determine the type of file and for reporting;
+                the file is not read.*/
+        void analyze_buffer(std::wstring_view text, const std::filesystem::path& file);
+
         /** @brief Pseudo translates a set of files.
             @details Copies of each file are made in the same folder with
                 'pseudo_' prepended to the file name.
@@ -135,6 +306,23 @@ namespace i18n_check
                               bool addSurroundingBrackets, int8_t widthChange, bool addTrackingIds,
                               analyze_callback_reset resetCallback, analyze_callback callback);
 
+        /** @brief Sends each of the analyzers' warnings to a callback.
+            @details These are the warnings that format_results() writes (other than those about
+                the files' encodings), without having to format and parse the report's text.
+            @note Only the results that the analyzers currently hold are included,
+                so results that were written to disk (see set_memory_limit()) are not.
+            @param callback The function to send each warning to.
+            @param verbose @c true to include debug output.*/
+        void for_each_result(const analysis_result_callback& callback,
+                             const bool verbose = false) const;
+
+        /** @brief Writes the results to a stream.
+            @details Results that were written to disk (see set_memory_limit()) are copied
+                to @c report a batch at a time, so the whole report is never held in memory.
+            @param[out] report The stream to write the results to.
+            @param verbose @c true to include debug output.*/
+        void format_results(std::wostream& report, const bool verbose = false);
+
         /** @returns A formatted summary of the results.
             @param verbose @c true to include debug output.*/
         [[nodiscard]]
@@ -168,6 +356,40 @@ namespace i18n_check
             }
 
       private:
+        /// @brief Sends text to the analyzer for its file type.
+        void review_text(std::wstring_view text, const std::filesystem::path& file,
+                         const file_review_type fileType);
+
+        /// @brief Takes ownership of a file's text if it should be retained.
+        /// @returns A view of the retained text (or @c text itself if it isn't being retained).
+        [[nodiscard]]
+        std::wstring_view retain_text(std::wstring& text);
+
+        /// @brief Clears the analyzers' results and any text retained for them
+        ///     (along with any results that were spilled to disk).
+        void clear_results();
+
+        /// @brief Clears the analyzers' results and any text retained for them.
+        void clear_analyzer_results();
+
+        /// @brief Closes (and thus deletes) the spill file and resets its statistics.
+        void remove_spilled_results();
+
+        /// @returns An estimate of the memory used by the analyzers' results
+        ///     and the text retained for them.
+        [[nodiscard]]
+        size_t get_results_memory_usage() const noexcept;
+
+        /// @brief Reviews the analyzers' results, writes their report to the spill file,
+        ///     and clears them.
+        void spill_results();
+
+        /// @brief Writes the results from the spill file to a report.
+        void read_spilled_results(std::wostream& report);
+
+        /// @brief Writes the analyzers' results to a report.
+        void format_analyzer_results(std::wostream& report, const bool verbose);
+
         i18n_check::cpp_i18n_review* m_cpp{ nullptr };
         i18n_check::rc_file_review* m_rc{ nullptr };
         i18n_check::po_file_review* m_po{ nullptr };
@@ -177,6 +399,37 @@ namespace i18n_check
         std::vector<std::filesystem::path> m_filesThatContainUTF8Signature;
 
         std::wstring m_logReport;
+
+        // A deque (rather than a vector) so that the strings are never moved,
+        // which would invalidate views of short strings stored in the object itself.
+        std::deque<std::wstring> m_retainedFileTexts;
+        bool m_retainFileText{ false };
+
+        size_t m_memoryLimit{ 0 };
+
+        struct file_closer
+            {
+            void operator()(std::FILE* file) const noexcept { std::fclose(file); }
+            };
+
+        // Results that were moved out of memory because of the memory limit.
+        // The report of each batch of files is written to a temporary file as a
+        // byte count followed by its UTF-8 text, and the statistics that
+        // format_summary() shows are kept here.
+        // The file is from std::tmpfile(), so it is created exclusively (with a unique name)
+        // and is deleted when it is closed (even if the program ends abnormally).
+        struct spilled_results
+            {
+            std::unique_ptr<std::FILE, file_closer> m_file;
+            // the number of bytes that were fully written to the file
+            uint64_t m_size{ 0 };
+            size_t m_count{ 0 };
+            size_t m_cppStrings{ 0 };
+            size_t m_csharpStrings{ 0 };
+            size_t m_rcStrings{ 0 };
+            size_t m_catalogEntries{ 0 };
+            };
+        spilled_results m_spilledResults;
         };
     } // namespace i18n_check
 
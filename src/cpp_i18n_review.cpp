@@ -19,8 +19,9 @@ namespace i18n_check
     void cpp_i18n_review::operator()(std::wstring_view srcText,
                                      const std::filesystem::path& fileName)
         {
-        m_file_name = fileName;
+        m_file_id = m_file_table.add(fileName);
         m_file_start = nullptr;
+        m_retained_file_text = std::wstring_view{};
 
         if (srcText.empty())
             {
@@ -31,6 +32,12 @@ namespace i18n_check
         wchar_t* cppText = cppBuffer.data();
 
         m_file_start = cppText;
+        // strings that aren't changed by the review can refer to the original text
+        m_retained_file_text = is_file_text_retained() ? srcText : std::wstring_view{};
+        const std::wstring_view fileText{ cppText, srcText.length() };
+        // positions of strings and other issues are converted to lines and columns
+        // throughout the review, so find where the lines start up front
+        m_line_index.assign(fileText);
         const wchar_t* const endSentinel =
             std::next(cppText, static_cast<ptrdiff_t>(srcText.length()));
 
@@ -132,9 +139,9 @@ namespace i18n_check
                         // something like "//--------" is OK
                         *std::next(cppText, 2) != L'-')
                         {
-                        m_comments_missing_space.push_back(
-                            string_info(std::wstring{}, string_info::usage_info{}, m_file_name,
-                                        get_line_and_column((cppText - m_file_start))));
+                        add_string(m_comments_missing_space, std::wstring_view{},
+                                   string_info::usage_info{}, m_file_id,
+                                   get_line_and_column((cppText - m_file_start)));
                         }
                     clear_section(cppText, std::next(cppText, static_cast<ptrdiff_t>(endPos)));
                     std::advance(cppText, endPos);
@@ -325,16 +332,13 @@ namespace i18n_check
                                 continue;
                                 }
                             // step over PRIu64 macro that appears between printf strings
-                            // Format macros for the std::fprintf family of functions that may
-                            // appear between quoted sections that will actually join the two quotes
-                            const std::wregex intPrintfMacro{
-                                LR"(PR[IN][uidoxX](8|16|32|64|FAST8|FAST16|FAST32|FAST64|LEAST8|LEAST16|LEAST32|LEAST64|MAX|PTR))"
-                            };
                             constexpr size_t int64PrintfMacroLength{ 6 };
                             if (std::next(connectedQuote, int64PrintfMacroLength) < endSentinel &&
-                                std::regex_match(
-                                    std::wstring{ connectedQuote, int64PrintfMacroLength },
-                                    intPrintfMacro))
+                                I18N_PROFILE_REGEX(
+                                    L"m_printf_int_macro_regex",
+                                    get_rule_tables().m_printf_int_macro_regex.matches(
+                                        std::wstring_view{ connectedQuote,
+                                                           int64PrintfMacroLength })))
                                 {
                                 clear_section(connectedQuote,
                                               std::next(connectedQuote, int64PrintfMacroLength));
@@ -388,26 +392,24 @@ namespace i18n_check
             // ";}" should have a space or newline between them
             else if (*cppText == L';' && *std::next(cppText) == L'}')
                 {
-                log_message(L"MISSING SPACE",
-                            L"Space or newline should be inserted between ';' and '}'.",
-                            (cppText - m_file_start));
+                log_message(parse_message_code::missing_space_before_closing_brace,
+                            L"MISSING SPACE", (cppText - m_file_start));
                 std::advance(cppText, 1);
                 }
             else
                 {
                 if (static_cast<bool>(m_review_styles & check_tabs) && *cppText == L'\t')
                     {
-                    m_tabs.push_back(string_info(std::wstring{}, string_info::usage_info{},
-                                                 m_file_name,
-                                                 get_line_and_column((cppText - m_file_start))));
+                    add_string(m_tabs, std::wstring_view{}, string_info::usage_info{}, m_file_id,
+                               get_line_and_column((cppText - m_file_start)));
                     }
                 else if (static_cast<bool>(m_review_styles & check_trailing_spaces) &&
                          *cppText == L' ' && std::next(cppText) < endSentinel &&
                          (*std::next(cppText) == L'\n' || *std::next(cppText) == L'\r'))
                     {
                     assert(cppText >= m_file_start);
-                    auto prevLineStart = std::wstring_view{ m_file_start }.find_last_of(
-                        L"\n\r", cppText - m_file_start);
+                    auto prevLineStart =
+                        fileText.find_last_of(L"\n\r", cppText - m_file_start);
                     if (prevLineStart == std::wstring::npos)
                         {
                         prevLineStart = 0;
@@ -418,16 +420,14 @@ namespace i18n_check
                         std::next(m_file_start, static_cast<ptrdiff_t>(prevLineStart)),
                         (cppText - std::next(m_file_start, static_cast<ptrdiff_t>(prevLineStart))));
                     string_util::ltrim(codeLine);
-                    m_trailing_spaces.push_back(
-                        string_info(codeLine, string_info::usage_info{}, m_file_name,
-                                    get_line_and_column((cppText - m_file_start))));
+                    add_string(m_trailing_spaces, codeLine, string_info::usage_info{}, m_file_id,
+                               get_line_and_column((cppText - m_file_start)));
                     }
                 else if (static_cast<bool>(m_review_styles & check_line_width) &&
                          (*cppText == L'\n' || *cppText == L'\r') && cppText > m_file_start)
                     {
                     const auto currentPos{ (cppText - m_file_start) };
-                    auto previousNewLine =
-                        std::wstring_view{ m_file_start }.find_last_of(L"\n\r", currentPos - 1);
+                    auto previousNewLine = fileText.find_last_of(L"\n\r", currentPos - 1);
                     if (previousNewLine == std::wstring::npos)
                         {
                         previousNewLine = 0;
@@ -446,7 +446,8 @@ namespace i18n_check
                         if (currentLine.find(L"R\"") == std::wstring::npos &&
                             currentLine.find(L'|') == std::wstring::npos)
                             {
-                            m_wide_lines.emplace_back(
+                            add_string(
+                                m_wide_lines,
                                 // truncate and add ellipsis
                                 std::wstring{ currentLine.substr(
                                                   0, std::min<size_t>(32, currentLine.length())) }
@@ -454,8 +455,8 @@ namespace i18n_check
                                     .append(L"..."),
                                 string_info::usage_info{
                                     string_info::usage_info::usage_type::orphan,
-                                    std::to_wstring(currentLineLength), std::wstring{} },
-                                m_file_name, get_line_and_column(currentPos));
+                                    std::to_wstring(currentLineLength), std::wstring_view{} },
+                                m_file_id, get_line_and_column(currentPos));
                             }
                         }
                     }
@@ -464,12 +465,14 @@ namespace i18n_check
             }
 
         // review full content again once comments and preprocessor blocks are cleared
-        load_id_assignments(cppBuffer, fileName);
-        load_deprecated_functions(cppBuffer, fileName);
-        load_suspect_i18n_ussage(cppBuffer, fileName);
+        load_id_assignments(cppBuffer, m_file_id);
+        load_deprecated_functions(cppBuffer, m_file_id);
+        load_suspect_i18n_ussage(cppBuffer, m_file_id);
 
-        m_file_name.clear();
+        m_file_id = file_table::npos;
         m_file_start = nullptr;
+        m_retained_file_text = std::wstring_view{};
+        m_line_index.clear();
         }
 
     //--------------------------------------------------
@@ -567,7 +570,7 @@ namespace i18n_check
                     string_util::find_matching_close_tag(std::next(asmStart), L'(', L')', false);
                 if (end == nullptr)
                     {
-                    log_message(L"asm", L"Missing closing ')' in asm block.",
+                    log_message(parse_message_code::missing_asm_closing_parenthesis, L"asm",
                                 (asmStart - m_file_start));
                     return std::next(asmStart, 1);
                     }
@@ -597,7 +600,7 @@ namespace i18n_check
                     string_util::find_matching_close_tag(std::next(asmStart), L'{', L'}', false);
                 if (end == nullptr)
                     {
-                    log_message(L"__asm", L"Missing closing '}' in __asm block.",
+                    log_message(parse_message_code::missing_asm_closing_brace, L"__asm",
                                 (asmStart - m_file_start));
                     return std::next(asmStart);
                     }
@@ -619,9 +622,10 @@ namespace i18n_check
     //--------------------------------------------------
     wchar_t* cpp_i18n_review::skip_preprocessor_define_block(wchar_t* directiveStart)
         {
-        const std::wregex debugRE{ L"[_]*DEBUG[_]*" };
-        const std::wregex debugLevelRE{ L"([a-zA-Z_]*DEBUG_LEVEL|0)" };
-        const std::wregex releaseRE{ L"[_]*RELEASE[_]*" };
+        const auto& rules = get_rule_tables();
+        const regex_pattern& debugRE{ rules.m_debug_define_regex };
+        const regex_pattern& debugLevelRE{ rules.m_debug_level_regex };
+        const regex_pattern& releaseRE{ rules.m_release_define_regex };
         const auto findSectionEnd = [](wchar_t* sectionStart) -> wchar_t*
         {
             const std::wstring_view elifCommand{ L"#elif" };
@@ -674,7 +678,9 @@ namespace i18n_check
                                           static_cast<size_t>(defSymbolEnd - directiveStart) };
             // NDEBUG (i.e., release) is a standard symbol;
             // if not defined, then this is a debug preprocessor section
-            return (defSymbol == L"NDEBUG" || std::regex_match(defSymbol, releaseRE)) ?
+            return (defSymbol == L"NDEBUG" ||
+                    I18N_PROFILE_REGEX(L"m_release_define_regex",
+                                       releaseRE.matches(defSymbol))) ?
                        findSectionEnd(defSymbolEnd) :
                        nullptr;
             }
@@ -693,7 +699,10 @@ namespace i18n_check
                 }
             const std::wstring defSymbol{ directiveStart,
                                           static_cast<size_t>(defSymbolEnd - directiveStart) };
-            return (std::regex_match(defSymbol, debugRE)) ? findSectionEnd(defSymbolEnd) : nullptr;
+            return I18N_PROFILE_REGEX(L"m_debug_define_regex",
+                                      debugRE.matches(defSymbol)) ?
+                       findSectionEnd(defSymbolEnd) :
+                       nullptr;
             }
         const std::wstring_view ifdefinedCommand{ _DT(L"if defined") };
         if (std::wstring_view{ directiveStart }.starts_with(ifdefinedCommand))
@@ -710,7 +719,10 @@ namespace i18n_check
                 }
             const std::wstring defSymbol{ directiveStart,
                                           static_cast<size_t>(defSymbolEnd - directiveStart) };
-            return (std::regex_match(defSymbol, debugRE)) ? findSectionEnd(defSymbolEnd) : nullptr;
+            return I18N_PROFILE_REGEX(L"m_debug_define_regex",
+                                      debugRE.matches(defSymbol)) ?
+                       findSectionEnd(defSymbolEnd) :
+                       nullptr;
             }
         const std::wstring_view ifCommand{ L"if" };
         if (std::wstring_view{ directiveStart }.starts_with(ifCommand))
@@ -727,8 +739,10 @@ namespace i18n_check
                 }
             const std::wstring defSymbol{ directiveStart,
                                           static_cast<size_t>(defSymbolEnd - directiveStart) };
-            return (std::regex_match(defSymbol, debugLevelRE)) ? findSectionEnd(defSymbolEnd) :
-                                                                 nullptr;
+            return I18N_PROFILE_REGEX(L"m_debug_level_regex",
+                                      debugLevelRE.matches(defSymbol)) ?
+                       findSectionEnd(defSymbolEnd) :
+                       nullptr;
             }
         return nullptr;
         }
@@ -843,9 +857,9 @@ namespace i18n_check
                     std::advance(endOfPossibleFuncName, 1);
                     }
                 if (*endOfPossibleFuncName == L'(' && *directiveStart != 0 &&
-                    m_ctors_to_ignore.find(
-                        std::wstring(directiveStart, endOfPossibleFuncName - directiveStart)) !=
-                        m_ctors_to_ignore.cend())
+                    m_ctors_to_ignore.contains(std::wstring_view(
+                        directiveStart,
+                        static_cast<size_t>(endOfPossibleFuncName - directiveStart))))
                     {
                     directiveStart = std::next(endOfPossibleFuncName);
                     }
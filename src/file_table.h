@@ -0,0 +1,94 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+/** @addtogroup Internationalization
+    @brief i18n classes.
+@{*/
+
+#ifndef __FILE_TABLE_H__
+#define __FILE_TABLE_H__
+
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <map>
+#include <vector>
+
+namespace i18n_check
+    {
+    /// @brief The ID of a file path in a file_table.
+    using file_id = uint32_t;
+
+    /** @brief A list of unique file paths, each identified by a small integer.
+        @details Results store a file's ID (rather than their own copy of its path),
+            and the path is looked up from the ID when the results are reported.*/
+    class file_table
+        {
+      public:
+        /// @brief The ID used when there is no file.
+        constexpr static file_id npos = std::numeric_limits<file_id>::max();
+
+        /** @brief Adds a file path to the table.
+            @param filePath The file path.
+            @returns The file's ID. If the path is already in the table,
+                then its existing ID is returned.*/
+        file_id add(const std::filesystem::path& filePath)
+            {
+            const auto [position, inserted] =
+                m_ids.try_emplace(filePath, static_cast<file_id>(m_paths.size()));
+            if (inserted)
+                {
+                m_paths.push_back(filePath);
+                }
+            return position->second;
+            }
+
+        /// @returns The path of a file, or an empty path if @c id is not in the table.
+        /// @param id The file's ID.
+        [[nodiscard]]
+        const std::filesystem::path& get_path(const file_id id) const noexcept
+            {
+            return (id < m_paths.size()) ? m_paths[id] : get_empty_path();
+            }
+
+        /// @returns The number of files in the table.
+        [[nodiscard]]
+        size_t size() const noexcept
+            {
+            return m_paths.size();
+            }
+
+        /// @brief Removes all files from the table.
+        /// @warning Any IDs from the table will no longer be valid.
+        void clear() noexcept
+            {
+            m_paths.clear();
+            m_ids.clear();
+            }
+
+      private:
+        [[nodiscard]]
+        static const std::filesystem::path& get_empty_path() noexcept
+            {
+            static const std::filesystem::path emptyPath;
+            return emptyPath;
+            }
+
+        std::vector<std::filesystem::path> m_paths;
+        std::map<std::filesystem::path, file_id> m_ids;
+        };
+    } // namespace i18n_check
+
+/** @}*/
+
+#endif //__FILE_TABLE_H__
@@ -1349,7 +1349,7 @@ void I18NFrame::SaveSourceFileIfNeeded()
             {
             std::wstring encoding{ L"utf-8" };
             const std::wstring fileText = m_editor->GetText().wc_string();
-            const std::wregex codePageRE{ _DT(LR"(#pragma code_page\(([0-9]+)\))") };
+            static const std::wregex codePageRE{ _DT(LR"(#pragma code_page\(([0-9]+)\))") };
             std::wsmatch matchResults;
             if (std::regex_search(fileText.cbegin(), fileText.cend(), matchResults, codePageRE) &&
                 matchResults.size() >= 2)
@@ -0,0 +1,936 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+#include "i18n_matchers.h"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <locale>
+
+namespace i18n_matchers
+    {
+    namespace
+        {
+        /// @brief Character classification and case folding, using the same
+        ///     facet that @c std::regex_traits<wchar_t> uses.
+        class char_classifier
+            {
+          public:
+            char_classifier()
+                : m_locale(), m_ctype(std::use_facet<std::ctype<wchar_t>>(m_locale))
+                {
+                // cache the classes of 7-bit characters, which is what most strings are
+                for (size_t i = 0; i < m_asciiMasks.size(); ++i)
+                    {
+                    for (const auto mask :
+                         { std::ctype_base::space, std::ctype_base::print, std::ctype_base::cntrl,
+                           std::ctype_base::upper, std::ctype_base::lower, std::ctype_base::alpha,
+                           std::ctype_base::digit, std::ctype_base::punct,
+                           std::ctype_base::xdigit, std::ctype_base::blank })
+                        {
+                        if (m_ctype.is(mask, static_cast<wchar_t>(i)))
+                            {
+                            m_asciiMasks[i] |= mask;
+                            }
+                        }
+                    m_asciiLower[i] = m_ctype.tolower(static_cast<wchar_t>(i));
+                    }
+                }
+
+            /// @returns @c true if @c ch is in any of the classes in @c mask.
+            [[nodiscard]]
+            bool is(const std::ctype_base::mask mask, const wchar_t ch) const
+                {
+                return is_ascii(ch) ? ((m_asciiMasks[static_cast<size_t>(ch)] & mask) != 0) :
+                                      m_ctype.is(mask, ch);
+                }
+
+            [[nodiscard]]
+            wchar_t to_lower(const wchar_t ch) const
+                {
+                return is_ascii(ch) ? m_asciiLower[static_cast<size_t>(ch)] : m_ctype.tolower(ch);
+                }
+
+            [[nodiscard]]
+            wchar_t to_upper(const wchar_t ch) const
+                {
+                return m_ctype.toupper(ch);
+                }
+
+          private:
+            [[nodiscard]]
+            constexpr static bool is_ascii(const wchar_t ch) noexcept
+                {
+                return static_cast<uint32_t>(ch) < 128;
+                }
+
+            std::locale m_locale;
+            const std::ctype<wchar_t>& m_ctype;
+            std::array<std::ctype_base::mask, 128> m_asciiMasks{};
+            std::array<wchar_t, 128> m_asciiLower{};
+            };
+
+        //--------------------------------------------------
+        const char_classifier& get_classifier()
+            {
+            static const char_classifier classifier;
+            return classifier;
+            }
+
+        //--------------------------------------------------
+        bool is_alnum(const wchar_t ch)
+            {
+            return get_classifier().is(std::ctype_base::alnum, ch);
+            }
+
+        /// @returns @c true if two characters are equal (case insensitively).
+        bool equal_icase(const wchar_t ch1, const wchar_t ch2)
+            {
+            return get_classifier().to_lower(ch1) == get_classifier().to_lower(ch2);
+            }
+
+        /// @returns @c true if a character matches ECMAScript's '.'.
+        constexpr bool is_not_line_terminator(const wchar_t ch) noexcept
+            {
+            return ch != L'\n' && ch != L'\r' && ch != 0x2028 && ch != 0x2029;
+            }
+
+        /// @returns @c true if no character in @c text is a line terminator (i.e., '.*' matches).
+        bool is_single_line(const std::wstring_view text)
+            {
+            for (const auto ch : text)
+                {
+                if (!is_not_line_terminator(ch))
+                    {
+                    return false;
+                    }
+                }
+            return true;
+            }
+
+        /// @returns @c true if @c text starts with @c prefix (case insensitively).
+        bool starts_with_icase(const std::wstring_view text, const std::wstring_view prefix)
+            {
+            if (text.length() < prefix.length())
+                {
+                return false;
+                }
+            for (size_t i = 0; i < prefix.length(); ++i)
+                {
+                if (!equal_icase(text[i], prefix[i]))
+                    {
+                    return false;
+                    }
+                }
+            return true;
+            }
+
+        /// @returns @c true if a character is in a case-insensitive bracket expression.
+        /// @details This matches how the regex engine compares (both the lowercased and
+        ///     uppercased versions of the character are tried).
+        template<typename predicateT>
+        bool is_in_icase(const wchar_t ch, predicateT isInSet)
+            {
+            return isInSet(get_classifier().to_lower(ch)) || isInSet(get_classifier().to_upper(ch));
+            }
+
+        /// @returns The number of alphanumeric characters at the start of @c text.
+        size_t count_alnum(const std::wstring_view text, size_t position = 0)
+            {
+            const size_t start{ position };
+            while (position < text.length() && is_alnum(text[position]))
+                {
+                ++position;
+                }
+            return position - start;
+            }
+
+        // [a-zA-Z0-9_:'"\.\[\]\/\{\}\-\\=]
+        constexpr bool is_xml_name_start(const wchar_t ch) noexcept
+            {
+            return (ch >= L'a' && ch <= L'z') || (ch >= L'A' && ch <= L'Z') ||
+                   (ch >= L'0' && ch <= L'9') ||
+                   std::wstring_view{ LR"(_:'".[]/{}-\=)" }.find(ch) != std::wstring_view::npos;
+            }
+
+        // [a-zA-Z0-9_\-]
+        constexpr bool is_html_name_char(const wchar_t ch) noexcept
+            {
+            return (ch >= L'a' && ch <= L'z') || (ch >= L'A' && ch <= L'Z') ||
+                   (ch >= L'0' && ch <= L'9') || ch == L'_' || ch == L'-';
+            }
+
+        //--------------------------------------------------
+        bool is_digit(const wchar_t ch)
+            {
+            return get_classifier().is(std::ctype_base::digit, ch);
+            }
+
+        /// @returns @c true if @c text has @c ch at @c position.
+        constexpr bool is_char_at(const std::wstring_view text, const size_t position,
+                                  const wchar_t ch) noexcept
+            {
+            return position < text.length() && text[position] == ch;
+            }
+
+        /// @returns Where the digits starting at @c position end.
+        size_t skip_digits(const std::wstring_view text, size_t position)
+            {
+            while (position < text.length() && is_digit(text[position]))
+                {
+                ++position;
+                }
+            return position;
+            }
+
+        // The printf specifier grammars below only need the greedy path of their
+        // expressions. Backtracking into a shorter width, precision, or positional
+        // argument leaves a digit, '*', '.', or '$' as the next character, which none of
+        // the following parts of the expressions can start with.
+
+        /// @returns Where `([[:digit:]]+[$])?` ends.
+        size_t skip_printf_position(const std::wstring_view text, const size_t position)
+            {
+            const size_t digitsEnd{ skip_digits(text, position) };
+            return (digitsEnd > position && is_char_at(text, digitsEnd, L'$')) ? digitsEnd + 1 :
+                                                                                  position;
+            }
+
+        /// @returns Where `([+]|[-] #0)?` ends.
+        size_t skip_printf_number_flags(const std::wstring_view text, const size_t position)
+            {
+            if (is_char_at(text, position, L'+'))
+                {
+                return position + 1;
+                }
+            return (text.substr(std::min(position, text.length()), 4) == L"- #0") ? position + 4 :
+                                                                                    position;
+            }
+
+        /// @returns Where `([*]|[[:digit:]]+)*` ends.
+        size_t skip_printf_width(const std::wstring_view text, size_t position)
+            {
+            while (position < text.length() && (text[position] == L'*' || is_digit(text[position])))
+                {
+                ++position;
+                }
+            return position;
+            }
+
+        /// @returns Where `(d|i|o|u|zu|c|C|e|E|x|X|l|I|I32|I64|<PRI(d|i|u|x)(32|64)>)` ends,
+        ///     or @c npos if it doesn't match.
+        /// @note "I32" and "I64" are never reached, as "I" comes first.
+        size_t skip_printf_int_type(const std::wstring_view text, const size_t position)
+            {
+            if (position >= text.length())
+                {
+                return std::wstring_view::npos;
+                }
+            if (std::wstring_view{ L"diouzcCeExXlI<" }.find(text[position]) ==
+                std::wstring_view::npos)
+                {
+                return std::wstring_view::npos;
+                }
+            if (text[position] == L'z')
+                {
+                return is_char_at(text, position + 1, L'u') ? position + 2 :
+                                                               std::wstring_view::npos;
+                }
+            if (text[position] == L'<')
+                {
+                const auto macro = text.substr(position, 8);
+                return (macro.length() == 8 && macro.substr(0, 4) == L"<PRI" &&
+                        std::wstring_view{ L"diux" }.find(macro[4]) != std::wstring_view::npos &&
+                        (macro.substr(5, 2) == L"32" || macro.substr(5, 2) == L"64") &&
+                        macro[7] == L'>') ?
+                           position + 8 :
+                           std::wstring_view::npos;
+                }
+            return position + 1;
+            }
+
+        /// @returns Where an integer specifier starting at @c position ('%') ends,
+        ///     or @c npos if there isn't one.
+        size_t match_printf_int(const std::wstring_view text, const size_t position)
+            {
+            size_t current = skip_printf_position(text, position + 1);
+            current = skip_printf_number_flags(text, current);
+            // ([*]|[[:digit:]]+)*[.]?[[:digit:]]*
+            current = skip_printf_width(text, current);
+            if (is_char_at(text, current, L'.'))
+                {
+                ++current;
+                }
+            current = skip_digits(text, current);
+            // (l)? followed by the type (which can also be 'l')
+            if (is_char_at(text, current, L'l'))
+                {
+                const auto typeEnd = skip_printf_int_type(text, current + 1);
+                if (typeEnd != std::wstring_view::npos)
+                    {
+                    return typeEnd;
+                    }
+                }
+            return skip_printf_int_type(text, current);
+            }
+
+        /// @returns Where a floating-point specifier starting at @c position ('%') ends,
+        ///     or @c npos if there isn't one.
+        size_t match_printf_float(const std::wstring_view text, const size_t position)
+            {
+            size_t current = skip_printf_position(text, position + 1);
+            current = skip_printf_number_flags(text, current);
+            current = skip_printf_width(text, current);
+            if (is_char_at(text, current, L'.'))
+                {
+                ++current;
+                }
+            current = skip_digits(text, current);
+            const auto isFloatType = [&text](const size_t typePosition)
+            {
+                return is_char_at(text, typePosition, L'f') ||
+                       is_char_at(text, typePosition, L'F');
+            };
+            if ((is_char_at(text, current, L'l') || is_char_at(text, current, L'L')) &&
+                isFloatType(current + 1))
+                {
+                return current + 2;
+                }
+            return isFloatType(current) ? current + 1 : std::wstring_view::npos;
+            }
+
+        /// @returns Where a string specifier starting at @c position ('%') ends,
+        ///     or @c npos if there isn't one.
+        size_t match_printf_string(const std::wstring_view text, const size_t position)
+            {
+            size_t current = skip_printf_position(text, position + 1);
+            if (is_char_at(text, current, L'-'))
+                {
+                ++current;
+                }
+            // (([*]|[[:digit:]]+)*[.][[:digit:]]*)? (where the '.' is required)
+            const size_t widthEnd = skip_printf_width(text, current);
+            if (is_char_at(text, widthEnd, L'.'))
+                {
+                const size_t precisionEnd = skip_digits(text, widthEnd + 1);
+                if (is_char_at(text, precisionEnd, L's'))
+                    {
+                    return precisionEnd + 1;
+                    }
+                }
+            return is_char_at(text, current, L's') ? current + 1 : std::wstring_view::npos;
+            }
+
+        /// @returns Where a pointer specifier starting at @c position ('%') ends,
+        ///     or @c npos if there isn't one.
+        /// @note The expression expects "%%p" (the specifier being the last two characters).
+        size_t match_printf_pointer(const std::wstring_view text, const size_t position)
+            {
+            if (!is_char_at(text, position + 1, L'%'))
+                {
+                return std::wstring_view::npos;
+                }
+            const size_t current = skip_printf_position(text, position + 2);
+            return is_char_at(text, current, L'p') ? current + 1 : std::wstring_view::npos;
+            }
+        } // namespace
+
+    //--------------------------------------------------
+    bool is_function_signature(const std::wstring_view text)
+        {
+        size_t position{ count_alnum(text) };
+        if (position < 2 || position >= text.length() || text[position] != L'(')
+            {
+            return false;
+            }
+        ++position;
+        // first argument
+        auto argLength = count_alnum(text, position);
+        if (argLength == 0)
+            {
+            return false;
+            }
+        position += argLength;
+        // any other arguments
+        while (position < text.length() && text[position] == L',')
+            {
+            ++position;
+            while (position < text.length() &&
+                   get_classifier().is(std::ctype_base::space, text[position]))
+                {
+                ++position;
+                }
+            argLength = count_alnum(text, position);
+            if (argLength == 0)
+                {
+                return false;
+                }
+            position += argLength;
+            }
+        return (position + 1 == text.length() && text[position] == L')');
+        }
+
+    //--------------------------------------------------
+    bool is_open_function_signature(const std::wstring_view text)
+        {
+        const size_t nameLength{ count_alnum(text) };
+        return (nameLength >= 2 && nameLength + 1 == text.length() && text.back() == L'(');
+        }
+
+    //--------------------------------------------------
+    bool is_plural_suffix(const std::wstring_view text)
+        {
+        const size_t nameLength{ count_alnum(text) };
+        return (nameLength >= 2 && nameLength + 3 == text.length() &&
+                text.substr(nameLength) == L"(s)");
+        }
+
+    //--------------------------------------------------
+    bool is_percentage(const std::wstring_view text)
+        {
+        if (text.length() < 2 || text.back() != L'%')
+            {
+            return false;
+            }
+        const auto value{ text.substr(0, text.length() - 1) };
+        // [0-9]+
+        if (value.find_first_not_of(L"0123456789") == std::wstring_view::npos)
+            {
+            return true;
+            }
+        // \{[a-z0-9]\}
+        if (value.length() == 3 && value[0] == L'{' && value[2] == L'}' &&
+            ((value[1] >= L'a' && value[1] <= L'z') || (value[1] >= L'0' && value[1] <= L'9')))
+            {
+            return true;
+            }
+        // %[udil]{1,2}
+        return ((value.length() == 2 || value.length() == 3) && value[0] == L'%' &&
+                value.find_first_not_of(L"udil", 1) == std::wstring_view::npos);
+        }
+
+    //--------------------------------------------------
+    bool is_hashtag(const std::wstring_view text)
+        {
+        return (text.length() >= 3 && text[0] == L'#' && count_alnum(text, 1) + 1 == text.length());
+        }
+
+    //--------------------------------------------------
+    bool is_key_shortcut(const std::wstring_view text)
+        {
+        const auto isModifier = [](const std::wstring_view key)
+        {
+            for (const std::wstring_view modifier : { L"CTRL", L"SHIFT", L"CMD", L"ALT" })
+                {
+                if (key.length() == modifier.length() && starts_with_icase(key, modifier))
+                    {
+                    return true;
+                    }
+                }
+            return false;
+        };
+
+        // keys are separated by '+', which can't be part of a key
+        size_t keyStart{ 0 };
+        size_t keyCount{ 0 };
+        bool inModifiers{ true };
+        size_t singleKeys{ 0 };
+        while (keyStart <= text.length())
+            {
+            auto keyEnd = text.find(L'+', keyStart);
+            if (keyEnd == std::wstring_view::npos)
+                {
+                keyEnd = text.length();
+                }
+            const auto key{ text.substr(keyStart, keyEnd - keyStart) };
+            // (CTRL|SHIFT|CMD|ALT) first, then ([+](CTRL|SHIFT|CMD|ALT))*
+            if (inModifiers && isModifier(key))
+                {
+                // the first key must be a modifier
+                }
+            // ...then ([+][[:alnum:]])+
+            else if (keyCount > 0 && key.length() == 1 && is_alnum(key[0]))
+                {
+                inModifiers = false;
+                ++singleKeys;
+                }
+            else
+                {
+                return false;
+                }
+            ++keyCount;
+            keyStart = keyEnd + 1;
+            }
+        return singleKeys > 0;
+        }
+
+    //--------------------------------------------------
+    bool is_sql_code(const std::wstring_view text)
+        {
+        if (!is_single_line(text))
+            {
+            return false;
+            }
+        for (size_t i = 0; i < text.length(); ++i)
+            {
+            for (const std::wstring_view keyword :
+                 { L"SELECT *", L"CREATE TABLE", L"CREATE INDEX", L"COLLATE NOCASE",
+                   L"ALTER TABLE", L"DROP TABLE", L"COLLATE DATABASE_DEFAULT" })
+                {
+                if (starts_with_icase(text.substr(i), keyword))
+                    {
+                    return true;
+                    }
+                }
+            }
+        return false;
+        }
+
+    //--------------------------------------------------
+    bool starts_with_line_icase(const std::wstring_view text, const std::wstring_view prefix)
+        {
+        return starts_with_icase(text, prefix) && is_single_line(text.substr(prefix.length()));
+        }
+
+    //--------------------------------------------------
+    bool starts_with_html_entity(const std::wstring_view text)
+        {
+        if (text.empty() || text[0] != L'&')
+            {
+            return false;
+            }
+        size_t position{ 1 };
+        while (position < text.length() && ((text[position] >= L'a' && text[position] <= L'z') ||
+                                            (text[position] >= L'A' && text[position] <= L'Z')))
+            {
+            ++position;
+            }
+        const size_t letterCount{ position - 1 };
+        return (letterCount >= 2 && letterCount <= 5 && position < text.length() &&
+                text[position] == L';' && is_single_line(text.substr(position + 1)));
+        }
+
+    //--------------------------------------------------
+    bool starts_with_html_numeric_entity(const std::wstring_view text)
+        {
+        if (text.length() < 2 || text[0] != L'&' || text[1] != L'#')
+            {
+            return false;
+            }
+        size_t position{ 2 };
+        while (position < text.length() &&
+               get_classifier().is(std::ctype_base::digit, text[position]))
+            {
+            ++position;
+            }
+        const size_t digitCount{ position - 2 };
+        return (digitCount >= 2 && digitCount <= 4 && position < text.length() &&
+                text[position] == L';' && is_single_line(text.substr(position + 1)));
+        }
+
+    //--------------------------------------------------
+    bool is_xml_element(const std::wstring_view text)
+        {
+        // The optional leading and trailing slashes are also in the character sets,
+        // so this is simply '<', a name-start character, one or more name characters, and '>'.
+        if (text.length() < 4 || !equal_icase(text.front(), L'<') ||
+            !equal_icase(text.back(), L'>'))
+            {
+            return false;
+            }
+        const auto name{ text.substr(1, text.length() - 2) };
+        if (!is_in_icase(name[0], is_xml_name_start))
+            {
+            return false;
+            }
+        for (size_t i = 1; i < name.length(); ++i)
+            {
+            if (!is_in_icase(name[i], [](const wchar_t ch)
+                             { return ch == L' ' || is_xml_name_start(ch); }))
+                {
+                return false;
+                }
+            }
+        return true;
+        }
+
+    //--------------------------------------------------
+    bool is_html_markup(const std::wstring_view text)
+        {
+        // skip the leading punctuation ([^[:alnum:]<]*) up to the first '<'
+        size_t position{ 0 };
+        while (position < text.length() && !equal_icase(text[position], L'<'))
+            {
+            if (is_alnum(text[position]))
+                {
+                return false;
+                }
+            ++position;
+            }
+        if (position >= text.length())
+            {
+            return false;
+            }
+        ++position;
+
+        // \x01 is [[:space:]] and \x02 is [[:digit:]]
+        constexpr std::array<std::wstring_view, 39> elements{
+            L"span",  L"object", L"property", L"div",   L"p",      L"ul",    L"ol",
+            L"li",    L"img",    L"html",     L"?xml",  L"meta",   L"body",  L"table",
+            L"tbody", L"tr",     L"td",       L"thead", L"head",   L"title", L"a\x01",
+            L"!--",   L"/",      L"!DOCTYPE", L"br",    L"center", L"dd",    L"em",
+            L"dl",    L"dt",     L"tt",       L"font",  L"form",   L"h\x02", L"hr",
+            L"main",  L"map",    L"pre",      L"script"
+        };
+        const auto elementMatches = [&text, position](const std::wstring_view element)
+        {
+            if (text.length() - position < element.length())
+                {
+                return false;
+                }
+            for (size_t i = 0; i < element.length(); ++i)
+                {
+                const wchar_t ch{ text[position + i] };
+                if (element[i] == L'\x01' ? !get_classifier().is(std::ctype_base::space, ch) :
+                    element[i] == L'\x02' ? !get_classifier().is(std::ctype_base::digit, ch) :
+                                            !equal_icase(ch, element[i]))
+                    {
+                    return false;
+                    }
+                }
+            return true;
+        };
+
+        const auto rest{ text.substr(position) };
+        for (const auto& element : elements)
+            {
+            if (elementMatches(element) && is_single_line(rest.substr(element.length())))
+                {
+                return true;
+                }
+            }
+        return false;
+        }
+
+    //--------------------------------------------------
+    bool is_html_element_with_content(const std::wstring_view text)
+        {
+        const auto isNameChar = [](const wchar_t ch) { return is_in_icase(ch, is_html_name_char); };
+
+        // opening tag
+        if (text.length() < 7 || !equal_icase(text.front(), L'<') ||
+            !equal_icase(text.back(), L'>'))
+            {
+            return false;
+            }
+        size_t contentStart{ 1 };
+        while (contentStart < text.length() && isNameChar(text[contentStart]))
+            {
+            ++contentStart;
+            }
+        if (contentStart == 1 || contentStart >= text.length() ||
+            !equal_icase(text[contentStart], L'>'))
+            {
+            return false;
+            }
+        ++contentStart;
+
+        // closing tag (the name has to be the whole run of name characters before the final '>',
+        // since the character before it must be a '/')
+        size_t closingNameStart{ text.length() - 1 };
+        while (closingNameStart > 0 && isNameChar(text[closingNameStart - 1]))
+            {
+            --closingNameStart;
+            }
+        if (closingNameStart == text.length() - 1 || closingNameStart < contentStart + 2 ||
+            !equal_icase(text[closingNameStart - 1], L'/') ||
+            !equal_icase(text[closingNameStart - 2], L'<'))
+            {
+            return false;
+            }
+
+        // content
+        for (size_t i = contentStart; i < closingNameStart - 2; ++i)
+            {
+            if (!get_classifier().is(std::ctype_base::print | std::ctype_base::cntrl, text[i]))
+                {
+                return false;
+                }
+            }
+        return true;
+        }
+
+    //--------------------------------------------------
+    std::vector<printf_specifier> find_cpp_printf_specifiers(const std::wstring_view text)
+        {
+        using match_function = size_t (*)(std::wstring_view, size_t);
+        struct specifier_scanner
+            {
+            match_function m_match{ nullptr };
+            // where the pointer specifier starts, relative to its leading '%'
+            size_t m_offset{ 0 };
+            // where the next search starts (i.e., the end of the previous match)
+            size_t m_search_start{ 0 };
+            std::vector<printf_specifier> m_results;
+            };
+
+        std::array<specifier_scanner, 4> scanners{
+            specifier_scanner{ match_printf_int, 0, 0, {} },
+            specifier_scanner{ match_printf_float, 0, 0, {} },
+            specifier_scanner{ match_printf_string, 0, 0, {} },
+            specifier_scanner{ match_printf_pointer, 1, 0, {} }
+        };
+
+        const auto isWordChar = [](const wchar_t ch) { return ch == L'_' || is_alnum(ch); };
+
+        for (size_t leadPosition = 0; leadPosition < text.length(); ++leadPosition)
+            {
+            // quick check, as all specifiers need a '%' here or right after this
+            if (text[leadPosition] != L'%' && !is_char_at(text, leadPosition + 1, L'%'))
+                {
+                continue;
+                }
+            for (auto& scanner : scanners)
+                {
+                if (leadPosition < scanner.m_search_start)
+                    {
+                    continue;
+                    }
+                // The lead-in is `(^|\b|[%]{2}|[^%])`. '^' only matches where the
+                // search started, and '\b' (in front of a '%') needs a word character
+                // before it (which isn't looked at where the search started).
+                size_t specifierStart{ std::wstring_view::npos };
+                size_t specifierEnd{ std::wstring_view::npos };
+                if (text[leadPosition] == L'%')
+                    {
+                    if (leadPosition == scanner.m_search_start ||
+                        isWordChar(text[leadPosition - 1]))
+                        {
+                        specifierStart = leadPosition;
+                        specifierEnd = scanner.m_match(text, specifierStart);
+                        }
+                    if (specifierEnd == std::wstring_view::npos &&
+                        is_char_at(text, leadPosition + 1, L'%') &&
+                        is_char_at(text, leadPosition + 2, L'%'))
+                        {
+                        specifierStart = leadPosition + 2;
+                        specifierEnd = scanner.m_match(text, specifierStart);
+                        }
+                    }
+                else
+                    {
+                    specifierStart = leadPosition + 1;
+                    specifierEnd = scanner.m_match(text, specifierStart);
+                    }
+
+                if (specifierEnd != std::wstring_view::npos)
+                    {
+                    scanner.m_results.push_back(
+                        printf_specifier{ specifierStart + scanner.m_offset,
+                                          specifierEnd - (specifierStart + scanner.m_offset),
+                                          leadPosition });
+                    scanner.m_search_start = specifierEnd;
+                    }
+                }
+            }
+
+        std::vector<printf_specifier> results;
+        for (auto& scanner : scanners)
+            {
+            results.insert(results.end(), scanner.m_results.cbegin(), scanner.m_results.cend());
+            }
+        return results;
+        }
+
+    //--------------------------------------------------
+    std::pair<std::wstring_view, std::wstring_view>
+    split_positional_printf_specifier(const std::wstring_view specifier)
+        {
+        if (specifier.empty() || specifier.front() != L'%')
+            {
+            return {};
+            }
+        const size_t digitsEnd{ skip_digits(specifier, 1) };
+        if (digitsEnd == 1 || !is_char_at(specifier, digitsEnd, L'$'))
+            {
+            return {};
+            }
+        // (.*) stops at a line terminator
+        size_t remainderEnd{ digitsEnd + 1 };
+        while (remainderEnd < specifier.length() && is_not_line_terminator(specifier[remainderEnd]))
+            {
+            ++remainderEnd;
+            }
+        return { specifier.substr(1, digitsEnd - 1),
+                 specifier.substr(digitsEnd + 1, remainderEnd - (digitsEnd + 1)) };
+        }
+
+    //--------------------------------------------------
+    std::vector<id_assignment> find_id_assignments(const std::wstring_view text)
+        {
+        // [a-zA-Z0-9_]
+        const auto isWordChar = [](const wchar_t ch) noexcept
+        {
+            return (ch >= L'a' && ch <= L'z') || (ch >= L'A' && ch <= L'Z') ||
+                   (ch >= L'0' && ch <= L'9') || ch == L'_';
+        };
+        // [a-zA-Z0-9_ \+\-\'<>:\.]
+        const auto isValueChar = [&isWordChar](const wchar_t ch) noexcept
+        {
+            return isWordChar(ch) ||
+                   std::wstring_view{ L" +-'<>:." }.find(ch) != std::wstring_view::npos;
+        };
+        const auto isSpace = [](const wchar_t ch)
+        { return get_classifier().is(std::ctype_base::space, ch); };
+
+        const auto skipWhile = [&text](size_t position, const auto& predicate)
+        {
+            while (position < text.length() && predicate(text[position]))
+                {
+                ++position;
+                }
+            return position;
+        };
+
+        std::vector<id_assignment> assignments;
+        size_t position{ 0 };
+        while (position < text.length())
+            {
+            const size_t declarationStart{ position };
+            size_t current{ position };
+            bool isDeclaration{ false };
+            if (isWordChar(text[position]))
+                {
+                current = skipWhile(position, isWordChar);
+                const std::wstring_view word{ text.substr(position, current - position) };
+                isDeclaration = (word == L"int" || word == L"uint32_t" || word == L"INT" ||
+                                 word == L"UINT" || word == L"wxWindowID");
+                }
+            else if (text.substr(position, 7) == L"#define" &&
+                     (position + 7 == text.length() || !isWordChar(text[position + 7])))
+                {
+                current = position + 7;
+                isDeclaration = true;
+                }
+            else
+                {
+                ++current;
+                }
+            position = current;
+            if (!isDeclaration)
+                {
+                continue;
+                }
+
+            // ([[:space:]]|const)*
+            size_t nameStart{ skipWhile(current, isSpace) };
+            while (text.substr(nameStart, 5) == L"const" &&
+                   (nameStart + 5 == text.length() || !isWordChar(text[nameStart + 5])))
+                {
+                nameStart = skipWhile(nameStart + 5, isSpace);
+                }
+            const size_t nameEnd{ skipWhile(nameStart, isWordChar) };
+            const std::wstring_view name{ text.substr(nameStart, nameEnd - nameStart) };
+            if (name.find(L"ID") == std::wstring_view::npos)
+                {
+                continue;
+                }
+
+            // [[:space:]]*[=\({]?[[:space:]\({]*
+            size_t valueStart{ skipWhile(nameEnd, isSpace) };
+            if (valueStart < text.length() &&
+                (text[valueStart] == L'=' || text[valueStart] == L'(' || text[valueStart] == L'{'))
+                {
+                ++valueStart;
+                }
+            valueStart = skipWhile(valueStart, [&isSpace](const wchar_t ch)
+                                   { return isSpace(ch) || ch == L'(' || ch == L'{'; });
+            const size_t valueEnd{ skipWhile(valueStart, isValueChar) };
+            if (valueEnd == valueStart)
+                {
+                continue;
+                }
+            // (.?), which doesn't include line terminators
+            const wchar_t followingChar{ (valueEnd < text.length() &&
+                                          is_not_line_terminator(text[valueEnd])) ?
+                                             text[valueEnd] :
+                                             L'\0' };
+            assignments.push_back(id_assignment{ declarationStart, name,
+                                                 text.substr(valueStart, valueEnd - valueStart),
+                                                 followingChar });
+            position = (followingChar != L'\0') ? valueEnd + 1 : valueEnd;
+            }
+        return assignments;
+        }
+
+    //--------------------------------------------------
+    std::optional<int32_t> read_integer(std::wstring_view text, const int base /*= 10*/)
+        {
+        text.remove_prefix(std::min(text.find_first_not_of(L" \t\n\r\f\v"), text.length()));
+        bool isNegative{ false };
+        if (!text.empty() && (text.front() == L'-' || text.front() == L'+'))
+            {
+            isNegative = (text.front() == L'-');
+            text.remove_prefix(1);
+            }
+        const auto digitValue = [base](const wchar_t ch) -> int
+        {
+            if (ch >= L'0' && ch <= L'9')
+                {
+                return ch - L'0';
+                }
+            if (base == 16 && ch >= L'a' && ch <= L'f')
+                {
+                return ch - L'a' + 10;
+                }
+            if (base == 16 && ch >= L'A' && ch <= L'F')
+                {
+                return ch - L'A' + 10;
+                }
+            return -1;
+        };
+        if (base == 16 && text.length() > 2 && text[0] == L'0' &&
+            (text[1] == L'x' || text[1] == L'X') && digitValue(text[2]) >= 0)
+            {
+            text.remove_prefix(2);
+            }
+        if (text.empty() || digitValue(text.front()) < 0)
+            {
+            return std::nullopt;
+            }
+
+        int64_t value{ 0 };
+        for (const auto ch : text)
+            {
+            const int digit{ digitValue(ch) };
+            if (digit < 0)
+                {
+                break;
+                }
+            value = (value * base) + digit;
+            if (value > std::numeric_limits<uint32_t>::max())
+                {
+                return std::nullopt;
+                }
+            }
+        value = isNegative ? -value : value;
+        if (value < std::numeric_limits<int32_t>::min() ||
+            value > std::numeric_limits<int32_t>::max())
+            {
+            return std::nullopt;
+            }
+        return static_cast<int32_t>(value);
+        }
+    } // namespace i18n_matchers
@@ -0,0 +1,196 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+/** @addtogroup Internationalization
+    @brief i18n classes.
+@{*/
+
+#ifndef __I18N_MATCHERS_H__
+#define __I18N_MATCHERS_H__
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/** @brief Hand-written replacements for the regular expressions that are run against
+        every string being reviewed.
+    @details Each function returns the same result as calling @c std::regex_match()
+        with the (ECMAScript) expression shown in its documentation, but in a single
+        linear pass and without the regex engine's backtracking.\n
+        Character classes (e.g., @c [[:alnum:]]) and case-insensitive comparisons use the
+        same @c std::ctype facet (from the global locale) that @c std::wregex uses,
+        and @c '.' does not match line terminators, as with ECMAScript.*/
+namespace i18n_matchers
+    {
+    /// @returns @c true if @c text matches
+    ///     `[[:alnum:]]{2,}[(][[:alnum:]]+(,[[:space:]]*[[:alnum:]]+)*[)]`.
+    /// @param text The text to review.
+    [[nodiscard]]
+    bool is_function_signature(std::wstring_view text);
+
+    /// @returns @c true if @c text matches `[[:alnum:]]{2,}[(]`.
+    /// @param text The text to review.
+    [[nodiscard]]
+    bool is_open_function_signature(std::wstring_view text);
+
+    /// @returns @c true if @c text matches `[[:alnum:]]{2,}[(]s[)]` (e.g., "Item(s)").
+    /// @param text The text to review.
+    [[nodiscard]]
+    bool is_plural_suffix(std::wstring_view text);
+
+    /// @returns @c true if @c text matches
+    ///     `([0-9]+|\{[a-z0-9]\}|%[udil]{1,2})%`.
+    /// @param text The text to review.
+    [[nodiscard]]
+    bool is_percentage(std::wstring_view text);
+
+    /// @returns @c true if @c text matches `#[[:alnum:]]{2,}`.
+    /// @param text The text to review.
+    [[nodiscard]]
+    bool is_hashtag(std::wstring_view text);
+
+    /// @returns @c true if @c text matches (case insensitively)
+    ///     `(CTRL|SHIFT|CMD|ALT)([+](CTRL|SHIFT|CMD|ALT))*([+][[:alnum:]])+`.
+    /// @param text The text to review.
+    [[nodiscard]]
+    bool is_key_shortcut(std::wstring_view text);
+
+    /// @returns @c true if @c text matches (case insensitively)
+    ///     `.*(SELECT \*|CREATE TABLE|CREATE INDEX|COLLATE NOCASE|ALTER TABLE|DROP TABLE|
+    ///     COLLATE DATABASE_DEFAULT).*`.
+    /// @param text The text to review.
+    [[nodiscard]]
+    bool is_sql_code(std::wstring_view text);
+
+    /// @returns @c true if @c text matches (case insensitively) @c prefix followed by
+    ///     `.*` (e.g., "Lorem ipsum.*").
+    /// @param text The text to review.
+    /// @param prefix The literal text (with no special characters) that @c text must start with.
+    [[nodiscard]]
+    bool starts_with_line_icase(std::wstring_view text, std::wstring_view prefix);
+
+    /// @returns @c true if @c text matches `&[a-zA-Z]{2,5};.*`.
+    /// @param text The text to review.
+    [[nodiscard]]
+    bool starts_with_html_entity(std::wstring_view text);
+
+    /// @returns @c true if @c text matches `&#[[:digit:]]{2,4};.*`.
+    /// @param text The text to review.
+    [[nodiscard]]
+    bool starts_with_html_numeric_entity(std::wstring_view text);
+
+    /// @returns @c true if @c text matches (case insensitively)
+    ///     `<\/?[a-zA-Z0-9_:'"\.\[\]\/\{\}\-\\=][a-zA-Z0-9_:'"\.\[\]\/\{\}\- \\=]+\/?>`.
+    /// @param text The text to review.
+    [[nodiscard]]
+    bool is_xml_element(std::wstring_view text);
+
+    /// @returns @c true if @c text matches (case insensitively)
+    ///     `[^[:alnum:]<]*<(span|object|property|div|p|ul|ol|li|img|html|[?]xml|meta|body|
+    ///     table|tbody|tr|td|thead|head|title|a[[:space:]]|!--|/|!DOCTYPE|br|center|dd|em|dl|
+    ///     dt|tt|font|form|h[[:digit:]]|hr|main|map|pre|script).*`.
+    /// @param text The text to review.
+    [[nodiscard]]
+    bool is_html_markup(std::wstring_view text);
+
+    /// @returns @c true if @c text matches (case insensitively)
+    ///     `<[a-zA-Z0-9_\-]+>[[:print:][:cntrl:]]*</[a-zA-Z0-9_\-]+>`.
+    /// @param text The text to review.
+    [[nodiscard]]
+    bool is_html_element_with_content(std::wstring_view text);
+
+    /// @brief A @c printf format specifier found in a string.
+    struct printf_specifier
+        {
+        /// @brief Where the specifier (e.g., "%5.2f") starts.
+        size_t m_position{ 0 };
+        /// @brief The length of the specifier.
+        size_t m_length{ 0 };
+        /// @brief Where the text in front of the specifier (checked to make sure that its
+        ///     '%' isn't escaped) starts.
+        size_t m_lead_position{ 0 };
+        };
+
+    /** @brief Finds the C/C++ @c printf format specifiers in a string in a single pass.
+        @param text The text to review.
+        @returns The specifiers, grouped by type (integer, floating point, string, and pointer),
+            each group being in the order found in the text.
+        @details The results are the same as searching with @c std::regex_search()
+            (and continuing from the end of each match) for each of these expressions,
+            where the second capture group is the specifier:\n
+            `(^|\b|[%]{2}|[^%])([%]([[:digit:]]+[$])?([+]|[-] #0)?(([*]|[[:digit:]]+)*[.]?[[:digit:]]*)?(l)?(d|i|o|u|zu|c|C|e|E|x|X|l|I|I32|I64|<PRI(d|i|u|x)(32|64)>))`\n
+            `(^|\b|[%]{2}|[^%])([%]([[:digit:]]+[$])?([+]|[-] #0)?(([*]|[[:digit:]]+)*[.]?[[:digit:]]*)?(l|L)?(f|F))`\n
+            `(^|\b|[%]{2}|[^%])([%]([[:digit:]]+[$])?[-]?(([*]|[[:digit:]]+)*[.][[:digit:]]*)?s)`\n
+            `(^|\b|[%]{2}|[^%])[%]([%]([[:digit:]]+[$])?p)`\n
+            The first capture group ensures that the specifier is not preceded
+            by a negating '%'.
+        @note A space flag is OK for numbers, but not strings and pointers:\n
+            "space: if the result of a signed conversion does not start with a sign character,
+            or is empty, space is prepended to the result. It is ignored if + flag is present."\n
+            Also, '<PRId64>' type specifiers are written as part of a printf string
+            (it's a macro outside of the string that the preprocessor maps to something else),
+            but PO files will embed these into the translations and source strings.*/
+    [[nodiscard]]
+    std::vector<printf_specifier> find_cpp_printf_specifiers(std::wstring_view text);
+
+    /** @brief Splits a positional @c printf specifier (e.g., "%2$s") into its position and
+            the rest of the specifier, the same as matching `^%([[:digit:]]+)[$](.*)`.
+        @param specifier The specifier.
+        @returns The digits of the position (empty if not a positional specifier) and
+            the rest of the specifier (after the '$').*/
+    [[nodiscard]]
+    std::pair<std::wstring_view, std::wstring_view>
+    split_positional_printf_specifier(std::wstring_view specifier);
+
+    /// @brief A value assigned to an ID variable (or constant) in C/C++ code.
+    struct id_assignment
+        {
+        /// @brief Where the declaration (e.g., "int" or "#define") starts.
+        size_t m_position{ 0 };
+        /// @brief The variable's name, which contains "ID".
+        std::wstring_view m_name;
+        /// @brief The value assigned to the variable (e.g., "1'000" or "wxID_HIGHEST + 1").
+        std::wstring_view m_value;
+        /// @brief The character after the value (e.g., '(' if the value is a function call),
+        ///     or @c 0 if at the end of the line or text.
+        wchar_t m_following_char{ 0 };
+        };
+
+    /** @brief Finds the values assigned to ID variables in C/C++ code in a single pass.
+        @param text The code to review.
+        @returns The assignments, in the order found in the text.
+        @details This finds declarations such as `UINT MENU_ID_PRINT = 1'000;` or
+            `#define IDD_ABOUTBOX 100`, the same as this expression:
+
+            `(int|uint32_t|INT|UINT|wxWindowID|#define)([[:space:]]|const)*([a-zA-Z0-9_]*ID[a-zA-Z0-9_]*)[[:space:]]*[=\({]?[[:space:]\({]*([a-zA-Z0-9_ \+\-\'<>:\.]+){1}(.?)`
+
+            except that the type and @c const must be whole words, and the variable name
+            and its value are never split from a single word.*/
+    [[nodiscard]]
+    std::vector<id_assignment> find_id_assignments(std::wstring_view text);
+
+    /** @brief Reads an integer from the start of @c text, like @c std::wcstol()
+            (without the exceptions that @c std::stol() throws).
+        @param text The text to read.
+        @param base The base of the number (10 or 16, where a "0x" prefix is allowed).
+        @returns The number, or an empty value if @c text doesn't start with one
+            or it doesn't fit in 32 bits.*/
+    [[nodiscard]]
+    std::optional<int32_t> read_integer(std::wstring_view text, int base = 10);
+    } // namespace i18n_matchers
+
+/** @}*/
+
+#endif //__I18N_MATCHERS_H__
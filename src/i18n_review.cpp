@@ -12,130 +12,73 @@
  ********************************************************************************/
 
 #include "i18n_review.h"
+#include "i18n_matchers.h"
 
 namespace i18n_check
     {
-    const std::wregex i18n_review::m_file_filter_regex{ LR"(([*][.][[:alnum:]\*]{1,5}[;]?)+$)" };
+    const regex_pattern i18n_review::m_file_filter_regex{ LR"(([*][.][[:alnum:]\*]{1,5}[;]?)+$)" };
 
-    const std::wregex i18n_review::m_url_email_regex{
+    const regex_pattern i18n_review::m_url_email_regex{
         LR"(((http|ftp)s?:\/\/)?(www\.)[-a-zA-Z0-9@:%._\+~#=]{1,256}\.[a-zA-Z0-9()]{1,6}\b([-a-zA-Z0-9()@:%_\+.~#?&//=]*))"
     };
 
-    const std::wregex i18n_review::m_us_phone_number_regex{
+    const regex_pattern i18n_review::m_us_phone_number_regex{
         LR"((\+\d{1,2}\s)?\(?\d{3}\)?[\s.-]\d{3}[\s.-]\d{4})"
     };
 
-    const std::wregex i18n_review::m_non_us_phone_number_regex{
+    const regex_pattern i18n_review::m_non_us_phone_number_regex{
         LR"((\+0?1\s)?\(?\d{3}\)?[\s.-]\d{3}[\s.-]\d{4})"
     };
 
-    const std::wregex i18n_review::m_malformed_html_tag_bad_amp{ LR"(&amp;[a-zA-Z]{3,5};)" };
+    const regex_pattern i18n_review::m_malformed_html_tag_bad_amp{ LR"(&amp;[a-zA-Z]{3,5};)" };
 
-    const std::wregex i18n_review::m_malformed_html_tag{ LR"(&(nbsp|amp|quot)[^;])" };
+    const regex_pattern i18n_review::m_malformed_html_tag{ LR"(&(nbsp|amp|quot)[^;])" };
 
-    const std::wregex i18n_review::m_sql_code{
-        LR"(.*(SELECT \*|CREATE TABLE|CREATE INDEX|COLLATE NOCASE|ALTER TABLE|DROP TABLE|COLLATE DATABASE_DEFAULT).*)",
-        std::regex_constants::icase
-    };
-
-    // UINT MENU_ID_PRINT = 1'000;
-    const std::wregex i18n_review::m_id_assignment_regex{
-        LR"((int|uint32_t|INT|UINT|wxWindowID|#define)([[:space:]]|const)*([a-zA-Z0-9_]*ID[a-zA-Z0-9_]*)[[:space:]]*[=\({]?[[:space:]\({]*([a-zA-Z0-9_ \+\-\'<>:\.]+){1}(.?))"
-    };
-
-    const std::wregex i18n_review::m_diagnostic_function_regex{
+    const regex_pattern i18n_review::m_diagnostic_function_regex{
         LR"(([a-zA-Z0-9_]*|^)(ASSERT|VERIFY|PROFILE|CHECK)([a-zA-Z0-9_]*|$))"
     };
 
-    const std::wregex i18n_review::m_plural_regex{ LR"([[:alnum:]]{2,}[(]s[)])" };
-    const std::wregex i18n_review::m_open_function_signature_regex{ LR"([[:alnum:]]{2,}[(])" };
-    const std::wregex i18n_review::m_html_tag_regex{ LR"(&[a-zA-Z]{2,5};.*)" };
-    const std::wregex i18n_review::m_html_tag_unicode_regex{ LR"(&#[[:digit:]]{2,4};.*)" };
     // contains Western European, Czech, Polish, and Russian extended ASCII characters:
     // ŽžŸÀ-ÖØ-öø-ÿżźćńółęąśŻŹĆĄŚĘŁÓŃěščřžýáíéóúůďťňĎŇŤŠČŘŽÝÁÍÉÚŮĚÓАБВГДЕЁЖЗИЙКЛМНОПРСТУФХЦЧШЩЪЫЬЭЮЯабвгдеёжзийклмнопрстуфхцчшщъыьэюяІі
     // [:alpha:] supports all languages with MSVC, but GCC and Clang limit this to 7-bit ASCII (even
     // when calling setlocale), so we need to include other charsets explicitly here when trying to
     // include them in source strings.
     // quneiform-suppress-begin
-    const std::wregex i18n_review::m_2letter_regex{
+    const regex_pattern i18n_review::m_2letter_regex{
         LR"([[:alpha:]ŽžŸÀ-ÖØ-öø-ÿżźćńółęąśŻŹĆĄŚĘŁÓŃěščřžýáíéóúůďťňĎŇŤŠČŘŽÝÁÍÉÚŮĚÓАБВГДЕЁЖЗИЙКЛМНОПРСТУФХЦЧШЩЪЫЬЭЮЯабвгдеёжзийклмнопрстуфхцчшщъыьэюяІі]{2,})"
     };
-    const std::wregex i18n_review::m_1word_regex{
+    const regex_pattern i18n_review::m_1word_regex{
         LR"((\b|\s|^)([[:alpha:]_ŽžŸÀ-ÖØ-öø-ÿżźćńółęąśŻŹĆĄŚĘŁÓŃěščřžýáíéóúůďťňĎŇŤŠČŘŽÝÁÍÉÚŮĚÓАБВГДЕЁЖЗИЙКЛМНОПРСТУФХЦЧШЩЪЫЬЭЮЯабвгдеёжзийклмнопрстуфхцчшщъыьэюяІі&'\.@]+)(2D|3D)?(\b|\s|$))"
     };
-    const std::wregex i18n_review::m_keyboard_accelerator_regex{ LR"((^|[^&])&[^\s&])" };
+    const regex_pattern i18n_review::m_keyboard_accelerator_regex{ LR"((^|[^&])&[^\s&])" };
     // quneiform-suppress-end
-    const std::wregex i18n_review::m_hashtag_regex{ LR"(#[[:alnum:]]{2,})" };
-    const std::wregex i18n_review::m_key_shortcut_regex{
-        LR"((CTRL|SHIFT|CMD|ALT)([+](CTRL|SHIFT|CMD|ALT))*([+][[:alnum:]])+)",
-        std::regex_constants::icase
-    };
-    const std::wregex i18n_review::m_function_signature_regex{
-        LR"([[:alnum:]]{2,}[(][[:alnum:]]+(,[[:space:]]*[[:alnum:]]+)*[)])"
-    };
-
-    // HTML, but also includes some GTK formatting tags
-    const std::wregex i18n_review::m_html_regex{
-        LR"([^[:alnum:]<]*<(span|object|property|div|p|ul|ol|li|img|html|[?]xml|meta|body|table|tbody|tr|td|thead|head|title|a[[:space:]]|!--|/|!DOCTYPE|br|center|dd|em|dl|dt|tt|font|form|h[[:digit:]]|hr|main|map|pre|script).*)",
-        std::regex_constants::icase
-    };
-    // <doc-val>Some text</doc-val>
-    const std::wregex i18n_review::m_html_element_with_content_regex{
-        LR"(<[a-zA-Z0-9_\-]+>[[:print:][:cntrl:]]*</[a-zA-Z0-9_\-]+>)", std::regex_constants::icase
-    };
 
     // <s:complex name=\"{{GetFunctionName}}_{{GetParameterName}}_Array\">
-    const std::wregex i18n_review::m_xml_element_regex{
+    // (see also i18n_matchers::is_xml_element(), which is used when only matching)
+    const regex_pattern i18n_review::m_xml_element_regex{
         LR"(<\/?[a-zA-Z0-9_:'"\.\[\]\/\{\}\-\\=][a-zA-Z0-9_:'"\.\[\]\/\{\}\- \\=]+\/?>)",
         std::regex_constants::icase
     };
 
     // not really XML/HTMl ("<No Name Specified>")
-    const std::wregex i18n_review::m_not_xml_element_regex{
+    const regex_pattern i18n_review::m_not_xml_element_regex{
         LR"(<\/?(([a-zA-Z0-9]){2,}\s+){1,}([a-zA-Z0-9]){2,}[[:punct:]]?\/?>)",
         std::regex_constants::icase
     };
 
     // <results> or <Results>, which should be OK to translate
-    const std::wregex i18n_review::m_angle_braced_one_word_regex{ LR"(<[a-zA-Z][a-z\-]+>)" };
+    const regex_pattern i18n_review::m_angle_braced_one_word_regex{ LR"(<[a-zA-Z][a-z\-]+>)" };
 
     // allowable HTML-like elements that are known
-    const std::wregex i18n_review::m_html_known_elements_regex{
+    const regex_pattern i18n_review::m_html_known_elements_regex{
         LR"(<(span|object|property|div|p|ul|ol|li|img|html|xml|meta|body|table|tbody|tr|td|thead|head|title|br|center|dd|em|dl|dt|tt|font|form|hr|main|map|pre|script)>)"
     };
 
-    // first capture group ensures that printf command is not proceeded by a negating '%'
-    // second capture group is the actual printf command
-    //
-    // Note: a space specifier is OK for numbers, but not strings and pointers:
-    //
-    // "space: if the result of a signed conversion does not start with a sign character,
-    //  or is empty, space is prepended to the result. It is ignored if + flag is present."
-    //
-    // Note: '<PRId64>' type specifiers are written as part of a printf string
-    // (it's a macro outside of the string that the preprocessor maps to something else),
-    // but PO files will embed these into the translations and source strings.
-    const std::wregex i18n_review::m_printf_cpp_int_regex{
-        LR"((^|\b|[%]{2}|[^%])([%]([[:digit:]]+[$])?([+]|[-] #0)?(([*]|[[:digit:]]+)*[.]?[[:digit:]]*)?(l)?(d|i|o|u|zu|c|C|e|E|x|X|l|I|I32|I64|<PRI(d|i|u|x)(32|64)>)))"
-    };
-
-    const std::wregex i18n_review::m_printf_cpp_float_regex{
-        LR"((^|\b|[%]{2}|[^%])([%]([[:digit:]]+[$])?([+]|[-] #0)?(([*]|[[:digit:]]+)*[.]?[[:digit:]]*)?(l|L)?(f|F)))"
-    };
-
-    const std::wregex i18n_review::m_printf_cpp_string_regex{
-        LR"((^|\b|[%]{2}|[^%])([%]([[:digit:]]+[$])?[-]?(([*]|[[:digit:]]+)*[.][[:digit:]]*)?s))"
-    };
-
-    const std::wregex i18n_review::m_printf_cpp_pointer_regex{
-        LR"((^|\b|[%]{2}|[^%])[%]([%]([[:digit:]]+[$])?p))"
-    };
-
     // %1, %L1, %n, %Ln
-    const std::wregex i18n_review::m_positional_command_regex{ LR"([%](n|[L]?[0-9]+|Ln))" };
+    const regex_pattern i18n_review::m_positional_command_regex{ LR"([%](n|[L]?[0-9]+|Ln))" };
 
     // common font faces that we would usually ignore (client can add to this)
-    std::set<string_util::case_insensitive_wstring> i18n_review::m_font_names = { // NOLINT
+    case_insensitive_name_set i18n_review::m_font_names = { // NOLINT
         L"Arial",
         L"Seaford",
         L"Skeena",
@@ -201,7 +144,7 @@ namespace i18n_check
     };
 
     // documents
-    std::set<string_util::case_insensitive_wstring> i18n_review::m_file_extensions = { // NOLINT
+    case_insensitive_name_set i18n_review::m_file_extensions = { // NOLINT
         L"xml", L"html", L"htm", L"xhtml", L"rtf", L"doc", L"docx", L"dot", L"docm", L"txt", L"ppt",
         L"pptx", L"pdf", L"ps", L"odt", L"ott", L"odp", L"otp", L"pptm", L"md", L"xaml",
         // Visual Studio files
@@ -238,8 +181,14 @@ namespace i18n_check
 
     std::set<std::wstring> i18n_review::m_untranslatable_exceptions = { L"PhD" };
 
+    regex_set i18n_review::m_untranslatable_patterns;
+
     std::vector<std::wregex> i18n_review::m_variable_name_patterns_to_ignore;
 
+#ifdef QUNEIFORM_REGEX_PROFILING
+    std::vector<std::wstring> i18n_review::m_variable_name_pattern_profile_names;
+#endif
+
     // variables whose CTORs take a string that should never be translated
     std::set<std::wstring> i18n_review::m_variable_types_to_ignore = {
         L"wxUxThemeHandle",
@@ -288,8 +237,10 @@ namespace i18n_check
     };
 
     //--------------------------------------------------
-    i18n_review::i18n_review(const bool verbose)
+    i18n_review::rule_tables::rule_tables()
         {
+        const auto startTime{ std::chrono::steady_clock::now() };
+
         m_deprecated_string_macros = {
             { L"wxT", _WXTRANS_WSTR(L"wxT() macro can be removed.") },
             { L"wxT_2", _WXTRANS_WSTR(L"wxT_2() macro can be removed.") },
@@ -460,293 +411,213 @@ namespace i18n_check
             { L"*wxConvCurrent", _WXTRANS_WSTR(L"Prefer using a wxConvAuto object instead.") }
         };
 
-        if (verbose)
-            {
-            // not i18n related, just legacy wx functions that can be modernized
-            if (m_min_cpp_version >= 2011)
-                {
-                m_deprecated_string_functions.insert(
-                    { L"_STATIC_ASSERT",
-                      _WXTRANS_WSTR(L"Use static_assert() instead of _STATIC_ASSERT().") });
-                m_deprecated_string_functions.insert(
-                    { L"wxMEMBER_DELETE",
-                      _WXTRANS_WSTR(L"Use '= delete' instead of wxMEMBER_DELETE.") });
-                m_deprecated_string_functions.insert(
-                    { L"wxOVERRIDE",
-                      _WXTRANS_WSTR(L"Use override or final instead of wxOVERRIDE.") });
-                }
-            if (m_min_cpp_version >= 2017)
-                {
-                m_deprecated_string_functions.insert(
-                    { L"wxNODISCARD",
-                      _WXTRANS_WSTR(L"Use [[nodiscard]] instead of wxNODISCARD.") });
-                m_deprecated_string_functions.insert(
-                    { L"WXSIZEOF", _WXTRANS_WSTR(L"Use std::size() instead of WXSIZEOF().") });
-                m_deprecated_string_functions.insert(
-                    { L"wxUnusedVar",
-                      _WXTRANS_WSTR(L"Use [[maybe_unused]] instead of wxUnusedVar.") });
-                m_deprecated_string_functions.insert(
-                    { L"WXUNUSED", _WXTRANS_WSTR(L"Use [[maybe_unused]] instead of WXUNUSED().") });
-                }
-            m_deprecated_string_functions.insert(
-                { L"wxEXPAND",
-                  _WXTRANS_WSTR(L"Call wxSizer::Add() with a wxSizerFlags object using Expand() "
-                                "instead of wxEXPAND.") });
-            m_deprecated_string_functions.insert(
-                { L"wxGROW",
-                  _WXTRANS_WSTR(L"Call wxSizer::Add() with a wxSizerFlags object using Expand() "
-                                "instead of wxGROW.") });
-            m_deprecated_string_functions.insert(
-                { L"DECLARE_NO_COPY_CLASS",
-                  _WXTRANS_WSTR(L"Delete the copy CTOR and assignment operator "
-                                "instead of DECLARE_NO_COPY_CLASS.") });
-            m_deprecated_string_functions.insert(
-                { L"wxDECLARE_NO_COPY_CLASS",
-                  _WXTRANS_WSTR(L"Delete the copy CTOR and assignment operator instead of "
-                                "wxDECLARE_NO_COPY_CLASS.") });
-            m_deprecated_string_functions.insert(
-                { L"wxMin", _WXTRANS_WSTR(L"Use std::min() instead of wxMin().") });
-            m_deprecated_string_functions.insert(
-                { L"wxMax", _WXTRANS_WSTR(L"Use std::max() instead of wxMax().") });
-            m_deprecated_string_functions.insert(
-                { L"wxRound", _WXTRANS_WSTR(L"Use std::lround() instead of wxRound().") });
-            m_deprecated_string_functions.insert(
-                { L"wxIsNan", _WXTRANS_WSTR(L"Use std::isnan() instead of wxIsNan().") });
-            m_deprecated_string_functions.insert(
-                { L"wxNOEXCEPT", _WXTRANS_WSTR(L"Use noexcept instead of wxNOEXCEPT.") });
-            m_deprecated_string_functions.insert(
-                { L"__WXMAC__", _WXTRANS_WSTR(L"Use __WXOSX__ instead of __WXMAC__.") });
-            }
-
-        m_translatable_regexes = { std::wregex(LR"(Q[0-9](F|A)Y)") };
+        m_translatable_regexes = { { LR"(Q[0-9](F|A)Y)" } };
 
         m_untranslatable_regexes = {
             // nothing but numbers, punctuation, or control characters?
-            std::wregex(LR"(([[:digit:][:space:][:punct:][:cntrl:]]|\\[rnt])+)"),
+            { LR"(([[:digit:][:space:][:punct:][:cntrl:]]|\\[rnt])+)" },
             // placeholder text
-            std::wregex(LR"(Lorem ipsum.*)", std::regex_constants::icase),
-            std::wregex(LR"(The quick brown fox.*)", std::regex_constants::icase),
+            { LR"(Lorem ipsum.*)", std::regex_constants::icase },
+            { LR"(The quick brown fox.*)", std::regex_constants::icase },
             // webpage content type
-            std::wregex(
-                LR"([A-Za-z0-9\-]+/[A-Za-z0-9\-]+;[[:space:]]*[A-Za-z0-9\-]+=[A-Za-z0-9\-]+)"),
+            { LR"([A-Za-z0-9\-]+/[A-Za-z0-9\-]+;[[:space:]]*[A-Za-z0-9\-]+=[A-Za-z0-9\-]+)" },
             // SQL code
-            m_sql_code,
-            std::wregex(LR"(^(INSERT INTO|DELETE ([*] )?FROM).*)", std::regex_constants::icase),
-            std::wregex(LR"(^ORDER BY.*)"), // more strict
-            std::wregex(LR"([(]*SELECT[[:space:]]+(COUNT|MIN|MAX|SUM|AVG)[(].*)"),
-            std::wregex(LR"([(]*SELECT[[:space:]]+[A-Z_0-9\.]+,.*)"), std::wregex(LR"(^DSN=.*)"),
-            std::wregex(LR"(^Provider=(SQLOLEDB|Search).*)"),
-            std::wregex(LR"(^Connection: Keep-Alive$)"), std::wregex(LR"(ODBC;DSN=.*)"),
+            { LR"(.*(SELECT \*|CREATE TABLE|CREATE INDEX|COLLATE NOCASE|ALTER TABLE|DROP TABLE|COLLATE DATABASE_DEFAULT).*)",
+              std::regex_constants::icase },
+            { LR"(^(INSERT INTO|DELETE ([*] )?FROM).*)", std::regex_constants::icase },
+            { LR"(^ORDER BY.*)" }, // more strict
+            { LR"([(]*SELECT[[:space:]]+(COUNT|MIN|MAX|SUM|AVG)[(].*)" },
+            { LR"([(]*SELECT[[:space:]]+[A-Z_0-9\.]+,.*)" }, { LR"(^DSN=.*)" },
+            { LR"(^Provider=(SQLOLEDB|Search).*)" },
+            { LR"(^Connection: Keep-Alive$)" }, { LR"(ODBC;DSN=.*)" },
             // a regex expression
-            std::wregex(LR"([(][?]i[)].*)"),
+            { LR"([(][?]i[)].*)" },
             // single file filter that just has a file extension as its "name"
             // PNG (*.png)
             // PNG (*.png)|*.png
             // TIFF (*.tif;*.tiff)|*.tif;*.tiff
             // special case for the word "bitmap" also, wouldn't normally translate that
-            std::wregex(LR"(([A-Z]+|[bB]itmap) [(]([*][.][A-Za-z0-9]{1,7}[)]))"),
-            std::wregex(
-                LR"((([A-Z]+|[bB]itmap) [(]([*][.][A-Za-z0-9]{1,7})(;[*][.][A-Za-z0-9]{1,7})*[)][|]([*][.][A-Za-z0-9]{1,7})(;[*][.][A-Za-z0-9]{1,7})*[|]{0,2})+)"),
+            { LR"(([A-Z]+|[bB]itmap) [(]([*][.][A-Za-z0-9]{1,7}[)]))" },
+            { LR"((([A-Z]+|[bB]itmap) [(]([*][.][A-Za-z0-9]{1,7})(;[*][.][A-Za-z0-9]{1,7})*[)][|]([*][.][A-Za-z0-9]{1,7})(;[*][.][A-Za-z0-9]{1,7})*[|]{0,2})+)" },
             // multiple file filters next to each other
-            std::wregex(LR"(([*][.][A-Za-z0-9]{1,7}[;]?[[:space:]]*)+)"),
+            { LR"(([*][.][A-Za-z0-9]{1,7}[;]?[[:space:]]*)+)" },
             // clang-tidy commands
-            std::wregex(LR"(\-checks=.*)"),
+            { LR"(\-checks=.*)" },
             // generic measuring string (or regex expression)
-            std::wregex(LR"([[:space:]]*(ABCDEFG|abcdefg|AEIOU|aeiou).*)"),
+            { LR"([[:space:]]*(ABCDEFG|abcdefg|AEIOU|aeiou).*)" },
             // debug messages
-            std::wregex(LR"(Assert(ion)? (f|F)ail.*)"), std::wregex(LR"(ASSERT *)"),
+            { LR"(Assert(ion)? (f|F)ail.*)" }, { LR"(ASSERT *)" },
             // HTML doc start
-            std::wregex(LR"(<!DOCTYPE html)"),
+            { LR"(<!DOCTYPE html)" },
             // HTML entities
-            std::wregex(LR"(&[#]?[xX]?[A-Za-z0-9]+;)"), std::wregex(LR"(<a href=.*)"),
+            { LR"(&[#]?[xX]?[A-Za-z0-9]+;)" }, { LR"(<a href=.*)" },
             // HTML comment
-            std::wregex(LR"(<![-]{2,}.*)"),
+            { LR"(<![-]{2,}.*)" },
             // anchor
-            std::wregex(LR"(#[a-zA-Z0-9\-]{3,})"),
+            { LR"(#[a-zA-Z0-9\-]{3,})" },
             // CSS
-            std::wregex(LR"(a[:](hover|link))", std::regex_constants::icase),
-            std::wregex(
-                LR"([\s\S]*(\{[[:space:]]*[a-zA-Z\-]+[[:space:]]*[:][[:space:]]*[0-9a-zA-Z\- \(\)\\;\:%#'",]+[[:space:]]*\})+[\s\S]*)"),
-            std::wregex(
-                LR"((margin[-](top|bottom|left|right)|text[-]indent)[:][[:space:]]*[[:alnum:]%]+;)"),
+            { LR"(a[:](hover|link))", std::regex_constants::icase },
+            { LR"([\s\S]*(\{[[:space:]]*[a-zA-Z\-]+[[:space:]]*[:][[:space:]]*[0-9a-zA-Z\- \(\)\\;\:%#'",]+[[:space:]]*\})+[\s\S]*)" },
+            { LR"((margin[-](top|bottom|left|right)|text[-]indent)[:][[:space:]]*[[:alnum:]%]+;)" },
             // JS
-            std::wregex(LR"(class[[:space:]]*=[[:space:]]*['"][A-Za-z0-9\- _]*['"])"),
+            { LR"(class[[:space:]]*=[[:space:]]*['"][A-Za-z0-9\- _]*['"])" },
             // An opening HTML element
-            std::wregex(LR"(<(body|html|img|head|meta|style|span|p|tr|td))"),
+            { LR"(<(body|html|img|head|meta|style|span|p|tr|td))" },
             // PostScript element
-            std::wregex(LR"(%%[a-zA-Z]+:.*)"),
-            std::wregex(LR"((<< [\/()A-Za-z0-9[:space:]]*(\\n|[[:space:]])*)+)"),
-            std::wregex(
-                LR"((\/[A-Za-z0-9[:space:]]* \[[A-Za-z0-9[:space:]%]+\](\\n|[[:space:]])*)+)"),
+            { LR"(%%[a-zA-Z]+:.*)" },
+            { LR"((<< [\/()A-Za-z0-9[:space:]]*(\\n|[[:space:]])*)+)" },
+            { LR"((\/[A-Za-z0-9[:space:]]* \[[A-Za-z0-9[:space:]%]+\](\\n|[[:space:]])*)+)" },
             // C
-            std::wregex(
-                LR"(^#(include|define|if|ifdef|ifndef|endif|elif|pragma|warning)[[:space:]].*)"),
+            { LR"(^#(include|define|if|ifdef|ifndef|endif|elif|pragma|warning)[[:space:]].*)" },
             // C++
-            std::wregex(LR"([a-zA-Z0-9_]+([-][>]|::)[a-zA-Z0-9_]+([(][)];)?)"),
-            std::wregex(LR"(#(define|pragma) .*)"),
+            { LR"([a-zA-Z0-9_]+([-][>]|::)[a-zA-Z0-9_]+([(][)];)?)" },
+            { LR"(#(define|pragma) .*)" },
             // command lines
-            std::wregex(LR"([-]D [A-Z_]{2,}[ =].*)"), std::wregex(LR"([-]dynamiclib .*)"),
-            std::wregex(LR"([-]{2}[a-z]{2,}[ :].*)"),
+            { LR"([-]D [A-Z_]{2,}[ =].*)" }, { LR"([-]dynamiclib .*)" },
+            { LR"([-]{2}[a-z]{2,}[ :].*)" },
             // registry keys
-            std::wregex(LR"(SOFTWARE[\\]{1,2}(Policies|Microsoft|Classes).*)",
-                        std::regex_constants::icase),
-            std::wregex(LR"(SYSTEM[\\]{1,2}(CurrentControlSet).*)", std::regex_constants::icase),
-            std::wregex(LR"(HKEY_.*)"),
+            { LR"(SOFTWARE[\\]{1,2}(Policies|Microsoft|Classes).*)", std::regex_constants::icase },
+            { LR"(SYSTEM[\\]{1,2}(CurrentControlSet).*)", std::regex_constants::icase },
+            { LR"(HKEY_.*)" },
             // web query
-            std::wregex(LR"(search.aspx\?.*)"),
+            { LR"(search.aspx\?.*)" },
             // XML elements
-            std::wregex(LR"(version[ ]?=\\"[0-9\.]+\\")"),
-            std::wregex(LR"(<([A-Za-z])+([A-Za-z0-9_/\\\-\.'"=;:#[:space:]])+[>]?)"),
-            std::wregex(LR"(xml[ ]*version[ ]*=[ ]*\\["'][0-9\.]+\\["'][>]?)"), // partial header
-            std::wregex(LR"(<[\\]?\?xml[ a-zA-Z0-9=\\"'%\.\-]*[\?]?>.*)"),      // full header and
-                                                                                // content after it
-            std::wregex(
-                LR"(<[A-Za-z]+[A-Za-z0-9_/\\\-\.'"=;:[:space:]]+>[[:space:][:digit:][:punct:]]*<[A-Za-z0-9_/\-.']*>)"),
-            std::wregex(LR"(<[A-Za-z]+([A-Za-z0-9_\-\.]+[[:space:]]*){1,2}=[[:punct:]A-Za-z0-9]*)"),
-            std::wregex(LR"(^[[:space:]]*xmlns(:[[:alnum:]]+)?=.*)"),
-            std::wregex(LR"(^[[:space:]]*<soap(\.udp)?\:[[:alnum:]]+.*)"),
-            std::wregex(LR"(^[[:space:]]*<port\b.*)"), std::wregex(LR"(ms-app(data|x))"),
-            std::wregex(LR"(^\{\{.*)"),                      // soap syntax
-            std::wregex(LR"(&[a-zA-Z0-9]+=[a-zA-Z0-9]+.*)"), // args passed to an URL
-            std::wregex(LR"([cC]ontent-[tT]ype: [a-zA-Z]{3,}\/.*)"),
-            std::wregex(LR"([cC]ontent-[dD]isposition: [a-zA-Z\-]{3,};.*)"),
+            { LR"(version[ ]?=\\"[0-9\.]+\\")" },
+            { LR"(<([A-Za-z])+([A-Za-z0-9_/\\\-\.'"=;:#[:space:]])+[>]?)" },
+            { LR"(xml[ ]*version[ ]*=[ ]*\\["'][0-9\.]+\\["'][>]?)" }, // partial header
+            { LR"(<[\\]?\?xml[ a-zA-Z0-9=\\"'%\.\-]*[\?]?>.*)" },      // full header and
+                                                                      // content after it
+            { LR"(<[A-Za-z]+[A-Za-z0-9_/\\\-\.'"=;:[:space:]]+>[[:space:][:digit:][:punct:]]*<[A-Za-z0-9_/\-.']*>)" },
+            { LR"(<[A-Za-z]+([A-Za-z0-9_\-\.]+[[:space:]]*){1,2}=[[:punct:]A-Za-z0-9]*)" },
+            { LR"(^[[:space:]]*xmlns(:[[:alnum:]]+)?=.*)" },
+            { LR"(^[[:space:]]*<soap(\.udp)?\:[[:alnum:]]+.*)" },
+            { LR"(^[[:space:]]*<port\b.*)" }, { LR"(ms-app(data|x))" },
+            { LR"(^\{\{.*)" },                      // soap syntax
+            { LR"(&[a-zA-Z0-9]+=[a-zA-Z0-9]+.*)" }, // args passed to an URL
+            { LR"([cC]ontent-[tT]ype: [a-zA-Z]{3,}\/.*)" },
+            { LR"([cC]ontent-[dD]isposition: [a-zA-Z\-]{3,};.*)" },
             // <image x=%d y=\"%d\" width = '%dpx' height="%dpx"
-            std::wregex(
-                LR"(<[A-Za-z0-9_\-\.]+[[:space:]]*([A-Za-z0-9_\-\.]+[[:space:]]*=[[:space:]]*[\"'\\]{0,2}[a-zA-Z0-9\-]*[\"'\\]{0,2}[[:space:]]*)+)"),
-            std::wregex(L"charset[[:space:]]*=.*", std::regex_constants::icase),
+            { LR"(<[A-Za-z0-9_\-\.]+[[:space:]]*([A-Za-z0-9_\-\.]+[[:space:]]*=[[:space:]]*[\"'\\]{0,2}[a-zA-Z0-9\-]*[\"'\\]{0,2}[[:space:]]*)+)" },
+            { L"charset[[:space:]]*=.*", std::regex_constants::icase },
             // all 'X'es, spaces, and commas are usually a placeholder of some sort
-            std::wregex(LR"((([\+\-]?[xX\.]+)[ ,]*)+)"),
+            { LR"((([\+\-]?[xX\.]+)[ ,]*)+)" },
             // placeholders
-            std::wregex(LR"(asdfs.*)"),
+            { LR"(asdfs.*)" },
             // program version string
-            std::wregex(LR"([a-zA-Z\-]+ v(ersion)?[ ]?[0-9\.]+)"),
+            { LR"([a-zA-Z\-]+ v(ersion)?[ ]?[0-9\.]+)" },
             // bash command (e.g., "lpstat -p") and system variables
-            std::wregex(LR"([a-zA-Z]{3,} [\-][a-zA-Z]+)"), std::wregex(LR"(sys[$].*)"),
+            { LR"([a-zA-Z]{3,} [\-][a-zA-Z]+)" }, { LR"(sys[$].*)" },
             // Pascal-case words (e.g., "GetValueFromUser");
             // surrounding punctuation is stripped first.
-            std::wregex(LR"([[:punct:]]*[A-Z]+[a-z0-9]+([A-Z]+[a-z0-9]+)+[[:punct:]]*)"),
+            { LR"([[:punct:]]*[A-Z]+[a-z0-9]+([A-Z]+[a-z0-9]+)+[[:punct:]]*)" },
             // camel-case words (e.g., "getValueFromUser", "unencodedExtASCII");
             // surrounding punctuation is stripped first.
-            std::wregex(LR"([[:punct:]]*[a-z]+[[:digit:]]*([A-Z]+[a-z0-9]*)+[[:punct:]]*)"),
-            std::wregex(LR"([[:punct:]]*[a-z]+[[:digit:]]*_([A-Z]+[a-z0-9]*)+[[:punct:]]*)"),
+            { LR"([[:punct:]]*[a-z]+[[:digit:]]*([A-Z]+[a-z0-9]*)+[[:punct:]]*)" },
+            { LR"([[:punct:]]*[a-z]+[[:digit:]]*_([A-Z]+[a-z0-9]*)+[[:punct:]]*)" },
             // reverse camel-case (e.g., "UTF8FileWithBOM")
-            std::wregex(LR"([[:punct:]]*[A-Z]+[[:digit:]]*([a-z0-9]+[A-Z]+)+[[:punct:]]*)"),
+            { LR"([[:punct:]]*[A-Z]+[[:digit:]]*([a-z0-9]+[A-Z]+)+[[:punct:]]*)" },
             // formulas (e.g., ABS(-2.7), POW(-4, 2), =SUM(1; 2) )
-            std::wregex(LR"((=)?[A-Za-z0-9_]{3,}[(]([RC0-9\-\.,;:\[\] ])*[)])"),
+            { LR"((=)?[A-Za-z0-9_]{3,}[(]([RC0-9\-\.,;:\[\] ])*[)])" },
             // formulas (e.g., ComputeNumbers() )
-            std::wregex(LR"([A-Za-z0-9_]{3,}[(][)])"),
-            std::wregex(LR"([A-Za-z0-9_]{3,}[:]{2}[A-Za-z0-9_]{3,}[(][)])"),
+            { LR"([A-Za-z0-9_]{3,}[(][)])" },
+            { LR"([A-Za-z0-9_]{3,}[:]{2}[A-Za-z0-9_]{3,}[(][)])" },
             // equal sign followed by a single word is probably some sort of
             // config file tag or formula.
-            std::wregex(LR"(=[A-Za-z0-9_]+)"),
+            { LR"(=[A-Za-z0-9_]+)" },
             // character encodings
-            std::wregex(
-                LR"((utf[-]?[[:digit:]]+|Shift[-_]JIS|us-ascii|windows-[[:digit:]]{4}|KOI8-R|Big5|GB2312|iso-[[:digit:]]{4}-[[:digit:]]+))",
-                std::regex_constants::icase),
+            { LR"((utf[-]?[[:digit:]]+|Shift[-_]JIS|us-ascii|windows-[[:digit:]]{4}|KOI8-R|Big5|GB2312|iso-[[:digit:]]{4}-[[:digit:]]+))",
+              std::regex_constants::icase },
             // wxWidgets constants
-            std::wregex(LR"((wx|WX)[A-Z_0-9]{2,})"),
+            { LR"((wx|WX)[A-Z_0-9]{2,})" },
             // ODCTask --surrounding punctuation is stripped first
-            std::wregex(LR"([[:punct:]]*[A-Z]{3,}[a-z_0-9]{2,}[[:punct:]]*)"),
+            { LR"([[:punct:]]*[A-Z]{3,}[a-z_0-9]{2,}[[:punct:]]*)" },
             // snake case words
             // Note that "P_rinter" would be OK, as the '_' may be a hot-key accelerator
-            std::wregex(LR"([_]*[a-z0-9]+(_[a-z0-9]+)+[_]*)"), // user_level_permission
-            std::wregex(LR"([_]*[A-Z0-9]+(_[A-Z0-9]+)+[_]*)"), // __HIGH_SCORE__
-            std::wregex(LR"([_]*[A-Z0-9][a-z0-9]+(_[A-Z0-9][a-z0-9]+)+[_]*)"), // Config_File_Path
+            { LR"([_]*[a-z0-9]+(_[a-z0-9]+)+[_]*)" }, // user_level_permission
+            { LR"([_]*[A-Z0-9]+(_[A-Z0-9]+)+[_]*)" }, // __HIGH_SCORE__
+            { LR"([_]*[A-Z0-9][a-z0-9]+(_[A-Z0-9][a-z0-9]+)+[_]*)" }, // Config_File_Path
             // CSS strings
-            std::wregex(
-                LR"(font-(style|weight|family|size|face-name|underline|point-size|variant)[[:space:]]*[:]?.*)",
-                std::regex_constants::icase),
-            std::wregex(
-                LR"(border-(block|bottom|color|collapse|right|left|top|collapse|image|inline|start|end|width|style)[[:space:]]*[:]?.*)",
-                std::regex_constants::icase),
-            std::wregex(
-                LR"(background-(clip|color|image|origin|position|repeat|size)[[:space:]]*[:]?.*)",
-                std::regex_constants::icase),
-            std::wregex(LR"(padding-(block|inline|left|right|top|bottom)[[:space:]]*[:]?.*)",
-                        std::regex_constants::icase),
-            std::wregex(LR"(page-break[[:space:]]*[:]?.*)", std::regex_constants::icase),
-            std::wregex(LR"(line-(break|height|style|through)[[:space:]]*[:]?.*)",
-                        std::regex_constants::icase),
-            std::wregex(LR"((vertical|horizontal)-align[[:space:]]*[:]?.*)",
-                        std::regex_constants::icase),
-            std::wregex(LR"(flex-(basis|direction|flow|grow|shrink|wrap)[[:space:]]*[:]?.*)",
-                        std::regex_constants::icase),
-            std::wregex(
-                LR"(text-(color|background|decoration|align|size|layout|transform|indent|justify|orientation|overflow|underline|shadow|emphasis)[[:space:]]*[:]?.*)",
-                std::regex_constants::icase),
-            std::wregex(LR"((background-)?color[[:space:]]*:.*)", std::regex_constants::icase),
-            std::wregex(LR"(style[[:space:]]*=["']?.*)", std::regex_constants::icase),
+            { LR"(font-(style|weight|family|size|face-name|underline|point-size|variant)[[:space:]]*[:]?.*)",
+              std::regex_constants::icase },
+            { LR"(border-(block|bottom|color|collapse|right|left|top|collapse|image|inline|start|end|width|style)[[:space:]]*[:]?.*)",
+              std::regex_constants::icase },
+            { LR"(background-(clip|color|image|origin|position|repeat|size)[[:space:]]*[:]?.*)",
+              std::regex_constants::icase },
+            { LR"(padding-(block|inline|left|right|top|bottom)[[:space:]]*[:]?.*)",
+              std::regex_constants::icase },
+            { LR"(page-break[[:space:]]*[:]?.*)", std::regex_constants::icase },
+            { LR"(line-(break|height|style|through)[[:space:]]*[:]?.*)",
+              std::regex_constants::icase },
+            { LR"((vertical|horizontal)-align[[:space:]]*[:]?.*)", std::regex_constants::icase },
+            { LR"(flex-(basis|direction|flow|grow|shrink|wrap)[[:space:]]*[:]?.*)",
+              std::regex_constants::icase },
+            { LR"(text-(color|background|decoration|align|size|layout|transform|indent|justify|orientation|overflow|underline|shadow|emphasis)[[:space:]]*[:]?.*)",
+              std::regex_constants::icase },
+            { LR"((background-)?color[[:space:]]*:.*)", std::regex_constants::icase },
+            { LR"(style[[:space:]]*=["']?.*)", std::regex_constants::icase },
             // local file paths & file names
-            std::wregex(LR"((WINDIR|Win32|System32|Kernel32|/etc|/tmp))",
-                        std::regex_constants::icase),
-            std::wregex(LR"((so|dll|exe|dylib|jpg|bmp|png|gif|txt|doc))",
-                        std::regex_constants::icase), // common file extension that might be missing
-                                                      // the period
-            std::wregex(LR"([.][a-zA-Z0-9]{1,5})"),   // file extension
-            std::wregex(LR"([.]DS_Store)"),           // macOS file
+            { LR"((WINDIR|Win32|System32|Kernel32|/etc|/tmp))", std::regex_constants::icase },
+            // common file extension that might be missing the period
+            { LR"((so|dll|exe|dylib|jpg|bmp|png|gif|txt|doc))", std::regex_constants::icase },
+            { LR"([.][a-zA-Z0-9]{1,5})" }, // file extension
+            { LR"([.]DS_Store)" },         // macOS file
             // file name (supports multiple extensions)
-            std::wregex(LR"([\\/]?[[:alnum:]_~!@#$%&;',+={}().^\[\]\-]+([.][a-zA-Z0-9]{1,4})+)"),
+            { LR"([\\/]?[[:alnum:]_~!@#$%&;',+={}().^\[\]\-]+([.][a-zA-Z0-9]{1,4})+)" },
             // ultra simple relative file path (e.g., "shaders/player1.vert")
-            std::wregex(LR"(([[:alnum:]_-]+[\\/]){1,2}[[:alnum:]_-]+([.][a-zA-Z0-9]{1,4})+)"),
-            std::wregex(LR"(\*[.][a-zA-Z0-9]{1,5})"), // wild card file extension
+            { LR"(([[:alnum:]_-]+[\\/]){1,2}[[:alnum:]_-]+([.][a-zA-Z0-9]{1,4})+)" },
+            { LR"(\*[.][a-zA-Z0-9]{1,5})" }, // wild card file extension
             // UNIX or web folder (needs at least 1 folder in path)
-            std::wregex(LR"((\/{1,2}[[:alnum:]_~!@#$%&;',+={}().^\[\]\-]+){2,}/?)"),
+            { LR"((\/{1,2}[[:alnum:]_~!@#$%&;',+={}().^\[\]\-]+){2,}/?)" },
             // Windows folder
-            std::wregex(LR"([a-zA-Z][:]([\\]{1,2}[[:alnum:]_~!@#$%&;',+={}().^\[\]\-]*)+)"),
-            std::wregex(LR"(\/?sys\$.*)"),
+            { LR"([a-zA-Z][:]([\\]{1,2}[[:alnum:]_~!@#$%&;',+={}().^\[\]\-]*)+)" },
+            { LR"(\/?sys\$.*)" },
             // Debug message
-            std::wregex(LR"(^DEBUG:[\s\S].*)"),
+            { LR"(^DEBUG:[\s\S].*)" },
             // mail protocols
-            std::wregex(LR"(^(RCPT TO|MAIL TO|MAIL FROM):.*)"),
+            { LR"(^(RCPT TO|MAIL TO|MAIL FROM):.*)" },
             // GUIDs
-            std::wregex(
-                LR"(^(CLSID[\\]{1,2})?[\{]?[a-fA-F0-9]{8}\-[a-fA-F0-9]{4}\-[a-fA-F0-9]{4}\-[a-fA-F0-9]{4}\-[a-fA-F0-9]{12}[\}]?$)"),
-            std::wregex(LR"(CLSID[\\]{1,2}.*)"),
+            { LR"(^(CLSID[\\]{1,2})?[\{]?[a-fA-F0-9]{8}\-[a-fA-F0-9]{4}\-[a-fA-F0-9]{4}\-[a-fA-F0-9]{4}\-[a-fA-F0-9]{12}[\}]?$)" },
+            { LR"(CLSID[\\]{1,2}.*)" },
             // encoding
-            std::wregex(LR"(^(base[0-9]+|uuencode|quoted-printable)$)"),
-            std::wregex(LR"(^(250\-AUTH)$)"),
+            { LR"(^(base[0-9]+|uuencode|quoted-printable)$)" },
+            { LR"(^(250\-AUTH)$)" },
             // MIME types
-            std::wregex(LR"((application|text)\/(x\-)?[a-z\-]+)"),
-            std::wregex(LR"(application\/(x\-)?[a-z\-]+\+[a-z\-]+)"),
-            std::wregex(LR"(image\/(x\-)?[a-z\-]+)"), std::wregex(LR"(video\/(x\-)?[a-z\-]+)"),
+            { LR"((application|text)\/(x\-)?[a-z\-]+)" },
+            { LR"(application\/(x\-)?[a-z\-]+\+[a-z\-]+)" },
+            { LR"(image\/(x\-)?[a-z\-]+)" }, { LR"(video\/(x\-)?[a-z\-]+)" },
             // MIME headers
-            std::wregex(LR"(^MIME-Version:.*)"), std::wregex(LR"(^X-Priority:.*)"),
-            std::wregex(
-                LR"(^(application\/octet-stream|video\/([:alnum:]+)|audio\/([:alnum:]+)|image\/([:alnum:]+)|text\/(css|csv|plain|html|xml|rawdata|javascript))$)"),
-            std::wregex(LR"(.*\bContent-Type:[[:space:]]*[[:alnum:]]+/[[:alnum:]]+;.*)"),
-            std::wregex(LR"(.*\bContent-Transfer-Encoding:[[:space:]]*[[:alnum:]]+.*)"),
+            { LR"(^MIME-Version:.*)" }, { LR"(^X-Priority:.*)" },
+            { LR"(^(application\/octet-stream|video\/([:alnum:]+)|audio\/([:alnum:]+)|image\/([:alnum:]+)|text\/(css|csv|plain|html|xml|rawdata|javascript))$)" },
+            { LR"(.*\bContent-Type:[[:space:]]*[[:alnum:]]+/[[:alnum:]]+;.*)" },
+            { LR"(.*\bContent-Transfer-Encoding:[[:space:]]*[[:alnum:]]+.*)" },
             // URL
-            std::wregex(
-                LR"(((http|ftp)s?:\/\/)?(www\.)[-a-zA-Z0-9@:%._\+~#=]{1,256}\.[a-zA-Z0-9()]{1,6}\b([-a-zA-Z0-9()@:%_\+.~#?&//=]*))"),
+            { LR"(((http|ftp)s?:\/\/)?(www\.)[-a-zA-Z0-9@:%._\+~#=]{1,256}\.[a-zA-Z0-9()]{1,6}\b([-a-zA-Z0-9()@:%_\+.~#?&//=]*))" },
             // HTTP requests
-            std::wregex(LR"(Sec[-]Fetch[-]Mode|User[-]Agent)"),
+            { LR"(Sec[-]Fetch[-]Mode|User[-]Agent)" },
             // email address
-            std::wregex(
-                LR"(^[a-zA-Z0-9.!#$%&'*+/=?^_`{|}~-]+@[a-zA-Z0-9](?:[a-zA-Z0-9-]{0,61}[a-zA-Z0-9])?(?:\.[a-zA-Z0-9](?:[a-zA-Z0-9-]{0,61}[a-zA-Z0-9])?)*$)"),
-            std::wregex(
-                LR"(^[\w ]*<[a-zA-Z0-9.!#$%&'*+/=?^_`{|}~-]+@[a-zA-Z0-9](?:[a-zA-Z0-9-]{0,61}[a-zA-Z0-9])?(?:\.[a-zA-Z0-9](?:[a-zA-Z0-9-]{0,61}[a-zA-Z0-9])?)*>$)"),
-            std::wregex(LR"(urn[:][a-zA-Z0-9]+.*)"),
+            { LR"(^[a-zA-Z0-9.!#$%&'*+/=?^_`{|}~-]+@[a-zA-Z0-9](?:[a-zA-Z0-9-]{0,61}[a-zA-Z0-9])?(?:\.[a-zA-Z0-9](?:[a-zA-Z0-9-]{0,61}[a-zA-Z0-9])?)*$)" },
+            { LR"(^[\w ]*<[a-zA-Z0-9.!#$%&'*+/=?^_`{|}~-]+@[a-zA-Z0-9](?:[a-zA-Z0-9-]{0,61}[a-zA-Z0-9])?(?:\.[a-zA-Z0-9](?:[a-zA-Z0-9-]{0,61}[a-zA-Z0-9])?)*>$)" },
+            { LR"(urn[:][a-zA-Z0-9]+.*)" },
             // Windows HTML clipboard data
-            std::wregex(LR"(.*(End|Start)(HTML|Fragment)[:]?[[:digit:]]*.*)"),
+            { LR"(.*(End|Start)(HTML|Fragment)[:]?[[:digit:]]*.*)" },
             // printer commands (e.g., @PAGECOUNT@)
-            std::wregex(LR"(@[A-Z0-9]+@)"),
+            { LR"(@[A-Z0-9]+@)" },
             // [CMD]
-            std::wregex(LR"(\[[A-Z0-9]+\])"),
+            { LR"(\[[A-Z0-9]+\])" },
             // Windows OS names
-            std::wregex(
-                LR"((Microsoft )?Windows (95|98|NT|ME|2000|Server|Vista|Longhorn|XP|[[:digit:]]{1,2}[.]?[[:digit:]]{0,2})[[:space:]]*[[:digit:]]{0,4}[[:space:]]*(R|SP)?[[:digit:]]{0,2})"),
+            { LR"((Microsoft )?Windows (95|98|NT|ME|2000|Server|Vista|Longhorn|XP|[[:digit:]]{1,2}[.]?[[:digit:]]{0,2})[[:space:]]*[[:digit:]]{0,4}[[:space:]]*(R|SP)?[[:digit:]]{0,2})" },
             // products and standards
-            std::wregex(LR"(UTF[-](8|16|32)(BE|LE)?)"),
-            std::wregex(LR"(Pentium( (II|III|M|Xeon|Pro))?)"),
-            std::wregex(LR"((Misra|MISRA) C( [0-9]+)?)"),
-            std::wregex(LR"(Borland C\+\+ Builder( [0-9]+)?)"), std::wregex(LR"(Qt Creator)"),
-            std::wregex(LR"((Microsoft )VS Code)"), std::wregex(LR"((Microsoft )?Visual Studio)"),
-            std::wregex(LR"((Microsoft )?Visual C\+\+)"),
-            std::wregex(LR"((Microsoft )?Visual Basic)"), std::wregex(LR"(GNU gdb debugger)"),
+            { LR"(UTF[-](8|16|32)(BE|LE)?)" },
+            { LR"(Pentium( (II|III|M|Xeon|Pro))?)" },
+            { LR"((Misra|MISRA) C( [0-9]+)?)" },
+            { LR"(Borland C\+\+ Builder( [0-9]+)?)" }, { LR"(Qt Creator)" },
+            { LR"((Microsoft )VS Code)" }, { LR"((Microsoft )?Visual Studio)" },
+            { LR"((Microsoft )?Visual C\+\+)" },
+            { LR"((Microsoft )?Visual Basic)" }, { LR"(GNU gdb debugger)" },
             // culture language tags
-            std::wregex(LR"([a-z]{2,3}[\-_][A-Z]{2,3})"),
+            { LR"([a-z]{2,3}[\-_][A-Z]{2,3})" },
             // image formats
-            std::wregex(LR"(TARGA|PNG|JPEG|JPG|BMP|GIF)")
+            { LR"(TARGA|PNG|JPEG|JPG|BMP|GIF)" }
         };
 
         // functions/macros that indicate that a string will be localizable
@@ -1031,24 +902,151 @@ namespace i18n_check
         // keywords in the language that can appear in front of a string only
         m_keywords = { L"return", L"else", L"if", L"goto", L"new", L"delete", L"throw" };
 
+        add_variable_name_pattern_to_ignore(LR"(^debug.*)", std::regex_constants::icase);
+        add_variable_name_pattern_to_ignore(LR"(^stacktrace.*)", std::regex_constants::icase);
+        add_variable_name_pattern_to_ignore(LR"(([[:alnum:]_\-])*xpm)",
+                                            std::regex_constants::icase);
+        add_variable_name_pattern_to_ignore(LR"(xpm([[:alnum:]_\-])*)",
+                                            std::regex_constants::icase);
         add_variable_name_pattern_to_ignore(
-            std::wregex(LR"(^debug.*)", std::regex_constants::icase));
-        add_variable_name_pattern_to_ignore(
-            std::wregex(LR"(^stacktrace.*)", std::regex_constants::icase));
-        add_variable_name_pattern_to_ignore(
-            std::wregex(LR"(([[:alnum:]_\-])*xpm)", std::regex_constants::icase));
-        add_variable_name_pattern_to_ignore(
-            std::wregex(LR"(xpm([[:alnum:]_\-])*)", std::regex_constants::icase));
-        add_variable_name_pattern_to_ignore(
-            std::wregex(LR"((sql|db|database)(Table|Update|Query|Command|Upgrade)?[[:alnum:]_\-]*)",
-                        std::regex_constants::icase));
-        add_variable_name_pattern_to_ignore(std::wregex(LR"(log)"));
-        add_variable_name_pattern_to_ignore(std::wregex(LR"([Cc]ommand(_)?[Ss]tring)"));
-        add_variable_name_pattern_to_ignore(std::wregex(LR"(wxColourDialogNames)"));
-        add_variable_name_pattern_to_ignore(std::wregex(LR"(wxColourTable)"));
-        add_variable_name_pattern_to_ignore(std::wregex(LR"(QT_MESSAGE_PATTERN)"));
+            LR"((sql|db|database)(Table|Update|Query|Command|Upgrade)?[[:alnum:]_\-]*)",
+            std::regex_constants::icase);
+        add_variable_name_pattern_to_ignore(LR"(log)");
+        add_variable_name_pattern_to_ignore(LR"([Cc]ommand(_)?[Ss]tring)");
+        add_variable_name_pattern_to_ignore(LR"(wxColourDialogNames)");
+        add_variable_name_pattern_to_ignore(LR"(wxColourTable)");
+        add_variable_name_pattern_to_ignore(LR"(QT_MESSAGE_PATTERN)");
         // console objects
-        add_variable_name_pattern_to_ignore(std::wregex(LR"((std::)?[w]?(cout|cerr))"));
+        add_variable_name_pattern_to_ignore(LR"((std::)?[w]?(cout|cerr))");
+
+#ifdef QUNEIFORM_REGEX_PROFILING
+        m_translatable_regexes.set_profile_name(L"translatable");
+        m_untranslatable_regexes.set_profile_name(L"untranslatable");
+        m_untranslatable_patterns.set_profile_name(L"untranslatable (client)");
+#endif
+
+        // Format macros for the std::fprintf family of functions that may
+        // appear between quoted sections that will actually join the two quotes
+        m_printf_int_macro_regex = regex_pattern{
+            LR"(PR[IN][uidoxX](8|16|32|64|FAST8|FAST16|FAST32|FAST64|LEAST8|LEAST16|LEAST32|LEAST64|MAX|PTR))"
+        };
+        // preprocessor symbols for debug and release sections
+        m_debug_define_regex = regex_pattern{ L"[_]*DEBUG[_]*" };
+        m_debug_level_regex = regex_pattern{ L"([a-zA-Z_]*DEBUG_LEVEL|0)" };
+        m_release_define_regex = regex_pattern{ L"[_]*RELEASE[_]*" };
+        // only looking at integral values (i.e., no floating-point precision)
+        m_single_int_printf_regex =
+            regex_pattern{ LR"([%]([+]|[-] #0)?(l)?(d|i|o|u|zu|c|C|e|E|x|X|l|I|I32|I64))" };
+        m_single_float_printf_regex = regex_pattern{ LR"([%]([+]|[-] #0)?(l|L)?(f|F))" };
+        m_load_string_regex = regex_pattern{
+            LR"(([:]{2,2})?LoadString(A|W)?[(](\s*[a-zA-Z0-9_]+\s*,){3}\s*[a-zA-Z0-9_]+[)])"
+        };
+        // HTML content to strip when seeing if a string has translatable content
+        m_html_break_regex = regex_pattern{ LR"(<br[[:space:]]*\/>)" };
+        m_html_script_regex = regex_pattern{ LR"(<script[\d\D]*?>[\d\D]*?</script>)" };
+        m_html_style_regex = regex_pattern{ LR"(<style[\d\D]*?>[\d\D]*?</style>)" };
+        m_html_tag_regex =
+            regex_pattern{ L"<[?]?[A-Za-z0-9+_/\\-\\.'\"=;:!%[:space:]\\\\,()]+[?]?>" };
+        m_html_entity_regex = regex_pattern{ L"&[a-zA-Z]{2,5};" };
+        m_html_numeric_entity_regex = regex_pattern{ L"&#[[:digit:]]{2,4};" };
+        m_punctuation_only_regex = regex_pattern{ L"[[:punct:]]+" };
+        // quotes (and the whitespace between them) joining a string that spans multiple lines
+        m_multiline_string_regex = regex_pattern{ LR"(([^\\])("[\s]+"))" };
+        // numbers like "36 600" (non-breaking space only), "36,600", and "36.600"
+        // (7-bit, full-width, and Hindi digits), and the separators to normalize them with
+        m_number_regex = regex_pattern{
+            LR"([[:digit:]\u0966-\u096F\uFF10-\uFF19]+([ ,\.][[:digit:]\u0966-\u096F\uFF10-\uFF19]+)*)"
+        };
+        m_number_separators_regex = regex_pattern{ LR"([ ,\.])" };
+        m_positional_number_regex = regex_pattern{ L"[%][L]?[0-9]{1,}" };
+
+        m_build_time = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - startTime);
+        }
+
+    //--------------------------------------------------
+    const i18n_review::rule_tables& i18n_review::get_rule_tables()
+        {
+        // built upon first use and then shared by every reviewer
+        static const rule_tables tables;
+        return tables;
+        }
+
+    //--------------------------------------------------
+    i18n_review::i18n_review(const bool verbose)
+        {
+        const auto& rules = get_rule_tables();
+
+        m_deprecated_string_macros = rules.m_deprecated_string_macros;
+        m_deprecated_string_functions = rules.m_deprecated_string_functions;
+        m_localization_functions = extendable_name_table{ rules.m_localization_functions };
+        m_localization_with_context_functions =
+            extendable_name_table{ rules.m_localization_with_context_functions };
+        m_non_localizable_functions = extendable_name_table{ rules.m_non_localizable_functions };
+        m_ctors_to_ignore = extendable_name_table{ rules.m_ctors_to_ignore };
+        m_internal_functions = extendable_name_table{ rules.m_internal_functions };
+        m_log_functions = extendable_name_table{ rules.m_log_functions };
+        m_exceptions = extendable_name_table{ rules.m_exceptions };
+        m_keywords = extendable_name_table{ rules.m_keywords };
+
+        if (verbose)
+            {
+            m_log_level = log_level::diagnostics;
+            // not i18n related, just legacy wx functions that can be modernized
+            if (m_min_cpp_version >= 2011)
+                {
+                m_deprecated_string_functions.insert(
+                    { L"_STATIC_ASSERT",
+                      _WXTRANS_WSTR(L"Use static_assert() instead of _STATIC_ASSERT().") });
+                m_deprecated_string_functions.insert(
+                    { L"wxMEMBER_DELETE",
+                      _WXTRANS_WSTR(L"Use '= delete' instead of wxMEMBER_DELETE.") });
+                m_deprecated_string_functions.insert(
+                    { L"wxOVERRIDE",
+                      _WXTRANS_WSTR(L"Use override or final instead of wxOVERRIDE.") });
+                }
+            if (m_min_cpp_version >= 2017)
+                {
+                m_deprecated_string_functions.insert(
+                    { L"wxNODISCARD",
+                      _WXTRANS_WSTR(L"Use [[nodiscard]] instead of wxNODISCARD.") });
+                m_deprecated_string_functions.insert(
+                    { L"WXSIZEOF", _WXTRANS_WSTR(L"Use std::size() instead of WXSIZEOF().") });
+                m_deprecated_string_functions.insert(
+                    { L"wxUnusedVar",
+                      _WXTRANS_WSTR(L"Use [[maybe_unused]] instead of wxUnusedVar.") });
+                m_deprecated_string_functions.insert(
+                    { L"WXUNUSED", _WXTRANS_WSTR(L"Use [[maybe_unused]] instead of WXUNUSED().") });
+                }
+            m_deprecated_string_functions.insert(
+                { L"wxEXPAND",
+                  _WXTRANS_WSTR(L"Call wxSizer::Add() with a wxSizerFlags object using Expand() "
+                                "instead of wxEXPAND.") });
+            m_deprecated_string_functions.insert(
+                { L"wxGROW",
+                  _WXTRANS_WSTR(L"Call wxSizer::Add() with a wxSizerFlags object using Expand() "
+                                "instead of wxGROW.") });
+            m_deprecated_string_functions.insert(
+                { L"DECLARE_NO_COPY_CLASS",
+                  _WXTRANS_WSTR(L"Delete the copy CTOR and assignment operator "
+                                "instead of DECLARE_NO_COPY_CLASS.") });
+            m_deprecated_string_functions.insert(
+                { L"wxDECLARE_NO_COPY_CLASS",
+                  _WXTRANS_WSTR(L"Delete the copy CTOR and assignment operator instead of "
+                                "wxDECLARE_NO_COPY_CLASS.") });
+            m_deprecated_string_functions.insert(
+                { L"wxMin", _WXTRANS_WSTR(L"Use std::min() instead of wxMin().") });
+            m_deprecated_string_functions.insert(
+                { L"wxMax", _WXTRANS_WSTR(L"Use std::max() instead of wxMax().") });
+            m_deprecated_string_functions.insert(
+                { L"wxRound", _WXTRANS_WSTR(L"Use std::lround() instead of wxRound().") });
+            m_deprecated_string_functions.insert(
+                { L"wxIsNan", _WXTRANS_WSTR(L"Use std::isnan() instead of wxIsNan().") });
+            m_deprecated_string_functions.insert(
+                { L"wxNOEXCEPT", _WXTRANS_WSTR(L"Use noexcept instead of wxNOEXCEPT.") });
+            m_deprecated_string_functions.insert(
+                { L"__WXMAC__", _WXTRANS_WSTR(L"Use __WXOSX__ instead of __WXMAC__.") });
+            }
         }
 
     //--------------------------------------------------
@@ -1106,102 +1104,118 @@ namespace i18n_check
         {
         process_strings();
 
-        std::wsmatch results;
-        for (const auto& str : m_localizable_strings)
+        for (size_t i = 0; i < m_localizable_strings.size(); ++i)
             {
+            const auto& str{ m_localizable_strings[i] };
+            const string_reference strReference{ string_list::localizable,
+                                                 static_cast<uint32_t>(i) };
             const auto [isunTranslatable, translatableContentLength] =
-                is_untranslatable_string(str.m_string, false);
+                is_untranslatable_string(std::wstring{ str.m_string }, false);
             if ((m_review_styles & check_l10n_contains_excessive_nonl10n_content) &&
                 !isunTranslatable && str.m_string.length() > (translatableContentLength * 3) &&
                 !str.m_usage.m_hasContext)
                 {
-                m_localizable_strings_with_unlocalizable_content.push_back(str);
+                add_string_issue(string_issue::unlocalizable_content, strReference);
                 }
             if ((m_review_styles & check_l10n_strings) && str.m_string.length() > 0 &&
                 isunTranslatable)
                 {
-                m_unsafe_localizable_strings.push_back(str);
+                add_string_issue(string_issue::unsafe_localizable, strReference);
                 }
             if ((m_review_styles & check_l10n_contains_url) &&
-                (std::regex_search(str.m_string, results, m_url_email_regex) ||
-                 std::regex_search(str.m_string, results, m_us_phone_number_regex) ||
-                 std::regex_search(str.m_string, results, m_non_us_phone_number_regex)))
+                (I18N_PROFILE_REGEX(L"m_url_email_regex",
+                                    m_url_email_regex.contains(str.m_string)) ||
+                 I18N_PROFILE_REGEX(L"m_us_phone_number_regex",
+                                    m_us_phone_number_regex.contains(str.m_string)) ||
+                 I18N_PROFILE_REGEX(L"m_non_us_phone_number_regex",
+                                    m_non_us_phone_number_regex.contains(str.m_string))))
                 {
-                m_localizable_strings_with_urls.push_back(str);
+                add_string_issue(string_issue::url, strReference);
                 }
             if ((m_review_styles & check_needing_context) && !str.m_usage.m_hasContext &&
                 is_string_ambiguous(str.m_string))
                 {
-                m_localizable_strings_ambiguous_needing_context.push_back(str);
+                add_string_issue(string_issue::ambiguous_needing_context, strReference);
                 }
             if ((m_review_styles & check_l10n_has_surrounding_spaces) &&
                 has_surrounding_spaces(str.m_string))
                 {
-                m_localizable_strings_with_surrounding_spaces.push_back(str);
+                add_string_issue(string_issue::surrounding_spaces, strReference);
                 }
             }
 
         if (m_review_styles & check_malformed_strings)
             {
-            const auto& classifyMalformedStrings = [this](const auto& strings)
+            const auto& classifyMalformedStrings = [this](const string_list list)
             {
-                for (const auto& str : strings)
+                const auto& strings{ get_string_list(list) };
+                for (size_t i = 0; i < strings.size(); ++i)
                     {
-                    if (std::regex_search(str.m_string, m_malformed_html_tag) ||
-                        std::regex_search(str.m_string, m_malformed_html_tag_bad_amp))
+                    if (I18N_PROFILE_REGEX(L"m_malformed_html_tag",
+                                           m_malformed_html_tag.contains(strings[i].m_string)) ||
+                        I18N_PROFILE_REGEX(
+                            L"m_malformed_html_tag_bad_amp",
+                            m_malformed_html_tag_bad_amp.contains(strings[i].m_string)))
                         {
-                        m_malformed_strings.push_back(str);
+                        add_string_issue(string_issue::malformed,
+                                         string_reference{ list, static_cast<uint32_t>(i) });
                         }
                     }
             };
 
-            classifyMalformedStrings(m_localizable_strings);
-            classifyMalformedStrings(m_marked_as_non_localizable_strings);
-            classifyMalformedStrings(m_internal_strings);
-            classifyMalformedStrings(m_not_available_for_localization_strings);
+            classifyMalformedStrings(string_list::localizable);
+            classifyMalformedStrings(string_list::marked_as_non_localizable);
+            classifyMalformedStrings(string_list::internal);
+            classifyMalformedStrings(string_list::not_available_for_localization);
             }
 
         if (m_review_styles & check_unencoded_ext_ascii)
             {
-            const auto& classifyUnencodedStrings = [this](const auto& strings)
+            const auto& classifyUnencodedStrings = [this](const string_list list)
             {
-                for (const auto& str : strings)
+                const auto& strings{ get_string_list(list) };
+                for (size_t i = 0; i < strings.size(); ++i)
                     {
-                    for (const auto& ch : str.m_string)
+                    for (const auto& ch : strings[i].m_string)
                         {
                         if (ch >= 128)
                             {
-                            m_unencoded_strings.push_back(str);
+                            add_string_issue(string_issue::unencoded_ext_ascii,
+                                             string_reference{ list, static_cast<uint32_t>(i) });
                             break;
                             }
                         }
                     }
             };
 
-            classifyUnencodedStrings(m_localizable_strings);
-            classifyUnencodedStrings(m_marked_as_non_localizable_strings);
-            classifyUnencodedStrings(m_internal_strings);
-            classifyUnencodedStrings(m_not_available_for_localization_strings);
+            classifyUnencodedStrings(string_list::localizable);
+            classifyUnencodedStrings(string_list::marked_as_non_localizable);
+            classifyUnencodedStrings(string_list::internal);
+            classifyUnencodedStrings(string_list::not_available_for_localization);
             }
 
         if (m_review_styles & check_printf_single_number)
             {
-            // only looking at integral values (i.e., no floating-point precision)
-            std::wregex intPrintf{ LR"([%]([+]|[-] #0)?(l)?(d|i|o|u|zu|c|C|e|E|x|X|l|I|I32|I64))" };
-            std::wregex floatPrintf{ LR"([%]([+]|[-] #0)?(l|L)?(f|F))" };
-            const auto& classifyPrintfIntStrings = [&, this](const auto& strings)
+            const auto& rules = get_rule_tables();
+            const auto& classifyPrintfIntStrings = [&, this](const string_list list)
             {
-                for (const auto& str : strings)
+                const auto& strings{ get_string_list(list) };
+                for (size_t i = 0; i < strings.size(); ++i)
                     {
-                    if (std::regex_match(str.m_string, intPrintf) ||
-                        std::regex_match(str.m_string, floatPrintf))
+                    if (I18N_PROFILE_REGEX(
+                            L"m_single_int_printf_regex",
+                            rules.m_single_int_printf_regex.matches(strings[i].m_string)) ||
+                        I18N_PROFILE_REGEX(
+                            L"m_single_float_printf_regex",
+                            rules.m_single_float_printf_regex.matches(strings[i].m_string)))
                         {
-                        m_printf_single_numbers.push_back(str);
+                        add_string_issue(string_issue::printf_single_number,
+                                         string_reference{ list, static_cast<uint32_t>(i) });
                         }
                     }
             };
-            classifyPrintfIntStrings(m_internal_strings);
-            classifyPrintfIntStrings(m_localizable_strings_in_internal_call);
+            classifyPrintfIntStrings(string_list::internal);
+            classifyPrintfIntStrings(string_list::localizable_in_internal_call);
             }
 
         // log any parsing errors
@@ -1214,23 +1228,23 @@ namespace i18n_check
         if (m_review_styles & check_not_available_for_l10n)
             {
             if (!should_exceptions_be_translatable() &&
-                (m_exceptions.find(str.m_usage.m_value) != m_exceptions.cend() ||
-                 m_exceptions.find(str.m_usage.m_variableType) != m_exceptions.cend()))
+                (m_exceptions.contains(str.m_usage.m_value) ||
+                 m_exceptions.contains(str.m_usage.m_variableType)))
                 {
                 return;
                 }
-            if (m_log_functions.find(str.m_usage.m_value) != m_log_functions.cend())
+            if (m_log_functions.contains(str.m_usage.m_value))
                 {
                 return;
                 }
 
-            if (is_untranslatable_string(str.m_string, true).first)
+            if (is_untranslatable_string(std::wstring{ str.m_string }, true).first)
                 {
-                m_internal_strings.push_back(str);
+                add_string(m_internal_strings, str);
                 }
             else
                 {
-                m_not_available_for_localization_strings.push_back(str);
+                add_string(m_not_available_for_localization_strings, str);
                 }
             }
         }
@@ -1257,8 +1271,7 @@ namespace i18n_check
         }
 
     //--------------------------------------------------
-    void i18n_review::load_deprecated_functions(const std::wstring_view fileText,
-                                                const std::filesystem::path& fileName)
+    void i18n_review::load_deprecated_functions(const std::wstring_view fileText, const file_id fileId)
         {
         if (!static_cast<bool>(m_review_styles & check_deprecated_macros))
             {
@@ -1275,11 +1288,11 @@ namespace i18n_check
                      !is_valid_name_char(fileText[i + func.first.length()])) &&
                     (i == 0 || !is_valid_name_char(fileText[i - 1])))
                     {
-                    m_deprecated_macros.push_back(string_info(
-                        std::wstring{ func.first.data(), func.first.length() },
-                        string_info::usage_info(string_info::usage_info::usage_type::function,
-                                                std::wstring(func.second), std::wstring{}),
-                        fileName, get_line_and_column(i, fileText.data())));
+                    add_string(m_deprecated_macros, func.first,
+                               string_info::usage_info(
+                                   string_info::usage_info::usage_type::function, func.second,
+                                   std::wstring_view{}),
+                               fileId, get_line_and_column(i, fileText));
                     i += func.first.length();
                     continue;
                     }
@@ -1289,172 +1302,116 @@ namespace i18n_check
         }
 
     //--------------------------------------------------
-    void i18n_review::load_suspect_i18n_ussage(const std::wstring_view fileText,
-                                               const std::filesystem::path& fileName)
+    void i18n_review::load_suspect_i18n_ussage(const std::wstring_view fileText, const file_id fileId)
         {
         if (!static_cast<bool>(m_review_styles & check_suspect_i18n_usage))
             {
             return;
             }
 
-        const std::wregex loadStringRegEx{
-            LR"(([:]{2,2})?LoadString(A|W)?[(](\s*[a-zA-Z0-9_]+\s*,){3}\s*[a-zA-Z0-9_]+[)])"
-        };
+        const regex_pattern& loadStringRegEx{ get_rule_tables().m_load_string_regex };
         auto currentTextBlock{ fileText };
-        std::match_results<decltype(currentTextBlock)::const_iterator> stPositions;
         size_t currentBlockOffset{ 0 };
-        while (std::regex_search(currentTextBlock.cbegin(), currentTextBlock.cend(), stPositions,
-                                 loadStringRegEx))
+        while (const auto stPositions = I18N_PROFILE_REGEX(
+                   L"m_load_string_regex", loadStringRegEx.search(currentTextBlock)))
             {
-            currentTextBlock = currentTextBlock.substr(stPositions.position());
-            currentBlockOffset += stPositions.position();
+            currentTextBlock = currentTextBlock.substr(stPositions->m_position);
+            currentBlockOffset += stPositions->m_position;
             if (currentBlockOffset == 0 ||
                 !(i18n_string_util::is_alpha_7bit(fileText[currentBlockOffset - 1]) ||
                   fileText[currentBlockOffset - 1] == L'.'))
                 {
-                m_suspect_i18n_usage.push_back(string_info(
-                    std::wstring{ currentTextBlock.substr(0, stPositions.length()) },
-                    string_info::usage_info(string_info::usage_info::usage_type::function,
+                add_string(m_suspect_i18n_usage, currentTextBlock.substr(0, stPositions->m_length),
+                           string_info::usage_info(
+                               string_info::usage_info::usage_type::function,
 #ifdef wxVERSION_NUMBER
-                                            _(L"Prefer using CString::LoadString() (if using MFC) "
-                                              "or a different framework's string "
-                                              "loading function. Calling ::LoadString() requires a "
-                                              "fixed-size buffer and may result "
-                                              "in truncating translated strings.")
-                                                .wc_str(),
+                               _(L"Prefer using CString::LoadString() (if using MFC) "
+                                 "or a different framework's string "
+                                 "loading function. Calling ::LoadString() requires a "
+                                 "fixed-size buffer and may result "
+                                 "in truncating translated strings.")
+                                   .wc_str(),
 #else
-                                            L"Prefer using CString::LoadString() (if using MFC) or "
-                                            "a different framework's string "
-                                            "loading function. Calling ::LoadString() requires a "
-                                            "fixed-size buffer and may result "
-                                            "in truncating translated strings.",
+                               L"Prefer using CString::LoadString() (if using MFC) or "
+                               "a different framework's string "
+                               "loading function. Calling ::LoadString() requires a "
+                               "fixed-size buffer and may result "
+                               "in truncating translated strings.",
 #endif
-                                            std::wstring{}),
-                    fileName, get_line_and_column(currentBlockOffset, fileText.data())));
+                               std::wstring_view{}),
+                           fileId, get_line_and_column(currentBlockOffset, fileText));
                 }
-            currentTextBlock = currentTextBlock.substr(stPositions.length());
-            currentBlockOffset += stPositions.length();
+            currentTextBlock = currentTextBlock.substr(stPositions->m_length);
+            currentBlockOffset += stPositions->m_length;
             }
         }
 
     //--------------------------------------------------
-    void i18n_review::load_id_assignments(const std::wstring_view fileText,
-                                          const std::filesystem::path& fileName)
+    void i18n_review::load_id_assignments(const std::wstring_view fileText, const file_id fileId)
         {
         if (!(static_cast<bool>(m_review_styles & check_duplicate_value_assigned_to_ids) ||
               static_cast<bool>(m_review_styles & check_number_assigned_to_id)))
             {
             return;
             }
-        std::vector<std::pair<size_t, std::wstring>> matches;
-
-        auto currentTextBlock{ fileText };
-        std::match_results<decltype(currentTextBlock)::const_iterator> stPositions;
-        size_t currentBlockOffset{ 0 };
-        while (std::regex_search(currentTextBlock.cbegin(), currentTextBlock.cend(), stPositions,
-                                 m_id_assignment_regex))
-            {
-            currentBlockOffset += stPositions.position();
-            currentTextBlock = currentTextBlock.substr(stPositions.position());
-
-            matches.emplace_back(
-                currentBlockOffset,
-                currentTextBlock.substr(0, stPositions.position() + stPositions.length()));
-
-            currentBlockOffset += stPositions.length();
-
-            currentTextBlock = currentTextBlock.substr(stPositions.length());
-            }
-
-        const std::wregex varNamePartsRE{ L"([a-zA-Z0-9_]*)(ID)([a-zA-Z0-9_]*)" };
-        const std::wregex varNameIDPartsRE{ L"([a-zA-Z0-9_]*)(ID[A-Z]?[_]?)([a-zA-Z0-9_]*)" };
-        // no std::from_chars for wchar_t :(
-        const std::wregex numRE{ LR"(^[\-0-9']+$)" };
+        const auto matches = i18n_matchers::find_id_assignments(fileText);
         if (!matches.empty())
             {
             std::vector<std::tuple<size_t, std::wstring, std::wstring>> idAssignments;
             idAssignments.reserve(matches.size());
-            std::vector<std::wstring> subMatches;
-            std::vector<std::wstring> idNameParts;
             // ID and variable name assigned to
             std::map<std::wstring, std::wstring> assignedIds;
             for (const auto& match : matches)
                 {
-                subMatches.clear();
-                idNameParts.clear();
-                auto varAssignment{ match.second };
-                // get the var name and ID
-                std::copy(std::regex_token_iterator<
-                              std::remove_reference_t<decltype(varAssignment)>::const_iterator>(
-                              varAssignment.cbegin(), varAssignment.cend(), m_id_assignment_regex,
-                              { 3, 4, 5 }),
-                          std::regex_token_iterator<
-                              std::remove_reference_t<decltype(varAssignment)>::const_iterator>{},
-                          std::back_inserter(subMatches));
                 // ignore function calls or constructed objects assigning an ID
-                if (subMatches[2] == L"(" || subMatches[2] == L"{")
+                if (match.m_following_char == L'(' || match.m_following_char == L'{')
                     {
                     continue;
                     }
                 // clean up ID (e.g., 1'000 -> 1000)
-                string_util::remove_all(subMatches[1], L'\'');
-                string_util::trim(subMatches[1]);
-                string_util::remove_all(subMatches[1], L' ');
+                std::wstring idValue{ match.m_value };
+                string_util::remove_all(idValue, L'\'');
+                string_util::remove_all(idValue, L' ');
                 // break the ID into parts and see what's around "ID";
                 // we don't want "ID" if it is part of a word like "WIDTH"
-                std::copy(std::regex_token_iterator<
-                              std::remove_reference_t<decltype(subMatches[0])>::const_iterator>(
-                              subMatches[0].cbegin(), subMatches[0].cend(), varNamePartsRE,
-                              { 1, 2, 3, 4, 5 }),
-                          std::regex_token_iterator<
-                              std::remove_reference_t<decltype(subMatches[0])>::const_iterator>{},
-                          std::back_inserter(idNameParts));
+                const size_t idPos{ match.m_name.rfind(L"ID") };
+                const std::wstring_view namePrefix{ match.m_name.substr(0, idPos) };
+                const std::wstring_view nameSuffix{ match.m_name.substr(idPos + 2) };
                 // MFC IDs
-                if ((idNameParts[0].empty() ||
-                     (idNameParts[0].length() > 0 &&
-                      !static_cast<bool>(std::iswupper(idNameParts[0].back())))) &&
-                    (idNameParts[2].starts_with(L"R_") || idNameParts[2].starts_with(L"D_") ||
-                     idNameParts[2].starts_with(L"C_") || idNameParts[2].starts_with(L"I_") ||
-                     idNameParts[2].starts_with(L"B_") || idNameParts[2].starts_with(L"S_") ||
-                     idNameParts[2].starts_with(L"M_") || idNameParts[2].starts_with(L"P_")))
+                if ((namePrefix.empty() || !static_cast<bool>(std::iswupper(namePrefix.back()))) &&
+                    (nameSuffix.starts_with(L"R_") || nameSuffix.starts_with(L"D_") ||
+                     nameSuffix.starts_with(L"C_") || nameSuffix.starts_with(L"I_") ||
+                     nameSuffix.starts_with(L"B_") || nameSuffix.starts_with(L"S_") ||
+                     nameSuffix.starts_with(L"M_") || nameSuffix.starts_with(L"P_")))
                     {
-                    idAssignments.push_back({ match.first, subMatches[0], subMatches[1] });
+                    idAssignments.emplace_back(match.m_position, match.m_name, std::move(idValue));
                     continue;
                     }
-                if ((idNameParts[0].length() > 0 &&
-                     static_cast<bool>(std::iswupper(idNameParts[0].back()))) ||
-                    (idNameParts[2].length() > 0 &&
-                     static_cast<bool>(std::iswupper(idNameParts[2].front()))))
+                if ((!namePrefix.empty() && static_cast<bool>(std::iswupper(namePrefix.back()))) ||
+                    (!nameSuffix.empty() && static_cast<bool>(std::iswupper(nameSuffix.front()))))
                     {
                     continue;
                     }
 
-                idAssignments.push_back({ match.first, subMatches[0], subMatches[1] });
+                idAssignments.emplace_back(match.m_position, match.m_name, std::move(idValue));
                 }
             for (const auto& [position, string1, string2] : idAssignments)
                 {
-                idNameParts.clear();
-                std::copy(std::regex_token_iterator<
-                              std::remove_reference_t<decltype(string1)>::const_iterator>(
-                              string1.cbegin(), string1.cend(), varNameIDPartsRE, { 1, 2, 3 }),
-                          std::regex_token_iterator<
-                              std::remove_reference_t<decltype(string1)>::const_iterator>(),
-                          std::back_inserter(idNameParts));
-                const auto idVal = [&string2 = string2]()
-                {
-                    try
-                        {
-                        if (string2.starts_with(L"0x"))
-                            {
-                            return std::optional<int32_t>(std::stol(string2, nullptr, 16));
-                            }
-                        return std::optional<int32_t>(std::stol(string2));
-                        }
-                    catch (...)
-                        {
-                        return std::optional<int32_t>{ std::nullopt };
-                        }
-                }();
+                // the "ID" (and any MFC prefix, like "IDR_") in the name
+                const size_t idPos{ string1.rfind(L"ID") };
+                size_t idPrefixEnd{ idPos + 2 };
+                if (idPrefixEnd < string1.length() && std::iswupper(string1[idPrefixEnd]))
+                    {
+                    ++idPrefixEnd;
+                    }
+                if (idPrefixEnd < string1.length() && string1[idPrefixEnd] == L'_')
+                    {
+                    ++idPrefixEnd;
+                    }
+                const std::wstring_view idPrefix{ std::wstring_view{ string1 }.substr(
+                    idPos, idPrefixEnd - idPos) };
+                const auto idVal =
+                    i18n_matchers::read_integer(string2, string2.starts_with(L"0x") ? 16 : 10);
                 const int32_t idRangeStart{ 1 };
                 const int32_t menuIdRangeEnd{ 0x6FFF };
                 const int32_t stringIdRangeEnd{ 0x7FFF };
@@ -1462,82 +1419,88 @@ namespace i18n_check
                 const int32_t dialogIdRangeEnd{ 0xDFFF };
                 if (static_cast<bool>(m_review_styles & check_number_assigned_to_id) && idVal &&
                     !(idVal.value() >= idRangeStart && idVal.value() <= menuIdRangeEnd) &&
-                    (idNameParts[1] == L"IDR_" || idNameParts[1] == L"IDD_" ||
-                     idNameParts[1] == L"IDM_" || idNameParts[1] == L"IDC_" ||
-                     idNameParts[1] == L"IDI_" || idNameParts[1] == L"IDB_"))
+                    (idPrefix == L"IDR_" || idPrefix == L"IDD_" || idPrefix == L"IDM_" ||
+                     idPrefix == L"IDC_" || idPrefix == L"IDI_" || idPrefix == L"IDB_"))
                     {
-                    m_ids_assigned_number.push_back(string_info(
+                    add_string(m_ids_assigned_number,
 #ifdef wxVERSION_NUMBER
-                        wxString::Format(_(L"%s assigned to %s; value should be between 1 and "
-                                           "0x6FFF if this is an MFC project."),
-                                         string2, string1)
-                            .wc_string(),
+                               wxString::Format(
+                                   _(L"%s assigned to %s; value should be between 1 and "
+                                     "0x6FFF if this is an MFC project."),
+                                   string2, string1)
+                                   .wc_string(),
 #else
-                        string2 + _DT(L" assigned to ") + string1 +
-                            _DT(L"; value should be between 1 and 0x6FFF if "
-                                L"this is an MFC project."),
+                               string2 + _DT(L" assigned to ") + string1 +
+                                   _DT(L"; value should be between 1 and 0x6FFF if "
+                                       L"this is an MFC project."),
 #endif
-                        string_info::usage_info{}, fileName,
-                        std::make_pair(get_line_and_column(position, fileText).first,
-                                       std::wstring::npos)));
+                               string_info::usage_info{}, fileId,
+                               std::make_pair(get_line_and_column(position, fileText).first,
+                                              std::wstring::npos));
                     }
                 else if (static_cast<bool>(m_review_styles & check_number_assigned_to_id) &&
                          idVal &&
                          !(idVal.value() >= idRangeStart && idVal.value() <= stringIdRangeEnd) &&
-                         (idNameParts[1] == L"IDS_" || idNameParts[1] == L"IDP_"))
+                         (idPrefix == L"IDS_" || idPrefix == L"IDP_"))
                     {
-                    m_ids_assigned_number.emplace_back(
+                    add_string(m_ids_assigned_number,
 #ifdef wxVERSION_NUMBER
-                        wxString::Format(_(L"%s assigned to %s; value should be between 1 and "
-                                           "0x7FFF if this is an MFC project."),
-                                         string2, string1)
-                            .wc_string(),
+                               wxString::Format(
+                                   _(L"%s assigned to %s; value should be between 1 and "
+                                     "0x7FFF if this is an MFC project."),
+                                   string2, string1)
+                                   .wc_string(),
 #else
-                        string2 + _DT(L" assigned to ") + string1 +
-                            _DT(L"; value should be between 1 and 0x7FFF if "
-                                "this is an MFC project."),
+                               string2 + _DT(L" assigned to ") + string1 +
+                                   _DT(L"; value should be between 1 and 0x7FFF if "
+                                       "this is an MFC project."),
 #endif
-                        string_info::usage_info{}, fileName,
-                        std::make_pair(get_line_and_column(position, fileText).first,
-                                       std::wstring::npos));
+                               string_info::usage_info{}, fileId,
+                               std::make_pair(get_line_and_column(position, fileText).first,
+                                              std::wstring::npos));
                     }
                 else if (static_cast<bool>(m_review_styles & check_number_assigned_to_id) &&
                          idVal &&
                          !(idVal.value() >= dialogIdRangeStart &&
                            idVal.value() <= dialogIdRangeEnd) &&
-                         idNameParts[1] == L"IDC_")
+                         idPrefix == L"IDC_")
                     {
-                    m_ids_assigned_number.emplace_back(
+                    add_string(m_ids_assigned_number,
 #ifdef wxVERSION_NUMBER
-                        wxString::Format(_(L"%s assigned to %s; value should be between 8 and "
-                                           "0xDFFF if this is an MFC project."),
-                                         string2, string1)
-                            .wc_string(),
+                               wxString::Format(
+                                   _(L"%s assigned to %s; value should be between 8 and "
+                                     "0xDFFF if this is an MFC project."),
+                                   string2, string1)
+                                   .wc_string(),
 #else
-                        string2 + _DT(L" assigned to ") + string1 +
-                            _DT(L"; value should be between 8 and 0xDFFF if "
-                                "this is an MFC project."),
+                               string2 + _DT(L" assigned to ") + string1 +
+                                   _DT(L"; value should be between 8 and 0xDFFF if "
+                                       "this is an MFC project."),
 #endif
-                        string_info::usage_info{}, fileName,
-                        std::make_pair(get_line_and_column(position, fileText).first,
-                                       std::wstring::npos));
+                               string_info::usage_info{}, fileId,
+                               std::make_pair(get_line_and_column(position, fileText).first,
+                                              std::wstring::npos));
                     }
                 else if (static_cast<bool>(m_review_styles & check_number_assigned_to_id) &&
-                         idNameParts[1].length() <= 3 && // ignore MFC IDs (handled above)
-                         std::regex_match(string2, numRE) &&
+                         idPrefix.length() <= 3 && // ignore MFC IDs (handled above)
+                         !string2.empty() &&
+                         std::all_of(string2.cbegin(), string2.cend(),
+                                     [](const wchar_t chr)
+                                     { return chr == L'-' || (chr >= L'0' && chr <= L'9'); }) &&
                          // -1 or 0 are usually generic IDs for the framework or
                          // temporary init values
                          string2 != L"-1" && string2 != L"0")
                     {
-                    m_ids_assigned_number.emplace_back(
+                    add_string(m_ids_assigned_number,
 #ifdef wxVERSION_NUMBER
-                        wxString::Format(_(L"%s assigned to %s"), string2, string1).wc_string(),
+                               wxString::Format(_(L"%s assigned to %s"), string2, string1)
+                                   .wc_string(),
 #else
-                        string2 + _DT(L" assigned to ") + string1,
+                               string2 + _DT(L" assigned to ") + string1,
 #endif
-                        string_info::usage_info{}, fileName,
-                        std::make_pair(get_line_and_column(position, fileText).first,
-                                       std::wstring::npos));
+                               string_info::usage_info{}, fileId,
+                               std::make_pair(get_line_and_column(position, fileText).first,
+                                              std::wstring::npos));
                     }
 
                 const auto [pos, inserted] = assignedIds.insert(std::make_pair(string2, string1));
@@ -1548,17 +1511,17 @@ namespace i18n_check
                     string1 != pos->second && string2 != L"wxID_ANY" && string2 != L"wxID_NONE" &&
                     string2 != L"-1" && string2 != L"0")
                     {
-                    m_duplicates_value_assigned_to_ids.push_back(string_info(
+                    add_string(m_duplicates_value_assigned_to_ids,
 #ifdef wxVERSION_NUMBER
-                        wxString::Format(_(L"%s has been assigned to multiple ID variables."),
-                                         string2)
-                            .wc_string(),
+                               wxString::Format(
+                                   _(L"%s has been assigned to multiple ID variables."), string2)
+                                   .wc_string(),
 #else
-                        string2 + _DT(L" has been assigned to multiple ID variables."),
+                               string2 + _DT(L" has been assigned to multiple ID variables."),
 #endif
-                        string_info::usage_info{}, fileName,
-                        std::make_pair(get_line_and_column(position, fileText).first,
-                                       std::wstring::npos)));
+                               string_info::usage_info{}, fileId,
+                               std::make_pair(get_line_and_column(position, fileText).first,
+                                              std::wstring::npos));
                     }
                 }
             }
@@ -1673,36 +1636,34 @@ namespace i18n_check
                                     const std::wstring& deprecatedMacroEncountered,
                                     const size_t parameterPosition)
         {
+        const std::wstring_view quoteText{ currentTextPos,
+                                           static_cast<size_t>(quoteEnd - currentTextPos) };
         if (deprecatedMacroEncountered.length() > 0 &&
             static_cast<bool>(m_review_styles & check_deprecated_macros))
             {
             const auto foundMessage = m_deprecated_string_macros.find(deprecatedMacroEncountered);
-            m_deprecated_macros.emplace_back(
-                deprecatedMacroEncountered,
-                string_info::usage_info(string_info::usage_info::usage_type::function,
-                                        (foundMessage != m_deprecated_string_macros.cend()) ?
-                                            std::wstring{ foundMessage->second } :
-                                            std::wstring{},
-                                        std::wstring{}),
-                m_file_name, get_line_and_column(currentTextPos - m_file_start));
+            add_string(m_deprecated_macros, deprecatedMacroEncountered,
+                       string_info::usage_info(string_info::usage_info::usage_type::function,
+                                               (foundMessage != m_deprecated_string_macros.cend()) ?
+                                                   std::wstring_view{ foundMessage->second } :
+                                                   std::wstring_view{},
+                                               std::wstring_view{}),
+                       m_file_id, get_line_and_column(currentTextPos - m_file_start));
             }
 
         if (variableName.length() > 0)
             {
-            process_variable(
-                variableType, variableName,
-                std::wstring_view{ currentTextPos, static_cast<size_t>(quoteEnd - currentTextPos) },
-                (currentTextPos - m_file_start));
+            process_variable(variableType, variableName, quoteText,
+                             (currentTextPos - m_file_start));
             }
         else if (functionName.length() > 0)
             {
             if (is_diagnostic_function(functionName))
                 {
-                m_internal_strings.emplace_back(
-                    std::wstring(currentTextPos, quoteEnd - currentTextPos),
-                    string_info::usage_info(string_info::usage_info::usage_type::function,
-                                            functionName, std::wstring{}),
-                    m_file_name, get_line_and_column(currentTextPos - m_file_start));
+                add_string(m_internal_strings, quoteText,
+                           string_info::usage_info(string_info::usage_info::usage_type::function,
+                                                   functionName, std::wstring_view{}),
+                           m_file_id, get_line_and_column(currentTextPos - m_file_start));
                 }
             else if (is_i18n_function(functionName))
                 {
@@ -1731,11 +1692,11 @@ namespace i18n_check
                     (functionName == L"ki18n" && parameterPosition > 0) || // acts like printf
                     (functionName == L"wxGetTranslation" && parameterPosition >= 1))
                     {
-                    m_internal_strings.emplace_back(
-                        std::wstring(currentTextPos, quoteEnd - currentTextPos),
-                        string_info::usage_info(string_info::usage_info::usage_type::function,
-                                                functionName, std::wstring{}),
-                        m_file_name, get_line_and_column(currentTextPos - m_file_start));
+                    add_string(m_internal_strings, quoteText,
+                               string_info::usage_info(
+                                   string_info::usage_info::usage_type::function, functionName,
+                                   std::wstring_view{}),
+                               m_file_id, get_line_and_column(currentTextPos - m_file_start));
 
                     const auto contextLength{ quoteEnd - currentTextPos };
                     if (static_cast<bool>(m_review_styles & check_suspect_i18n_usage) &&
@@ -1744,9 +1705,8 @@ namespace i18n_check
                         // they really comments in // practice
                         !functionName.starts_with(L"i18n") && !functionName.starts_with(L"ki18n"))
                         {
-                        m_suspect_i18n_usage.emplace_back(
-                            std::wstring{ currentTextPos,
-                                          static_cast<size_t>(quoteEnd - currentTextPos) },
+                        add_string(
+                            m_suspect_i18n_usage, quoteText,
                             string_info::usage_info(
                                 string_info::usage_info::usage_type::function,
 #ifdef wxVERSION_NUMBER
@@ -1759,27 +1719,26 @@ namespace i18n_check
                                 L"Context string is considerable long. Are the context and string "
                                 "arguments possibly transposed?",
 #endif
-                                std::wstring{}, true),
-                            m_file_name, get_line_and_column(currentTextPos - m_file_start));
+                                std::wstring_view{}, true),
+                            m_file_id, get_line_and_column(currentTextPos - m_file_start));
                         }
                     }
                 else if (static_cast<bool>(m_review_styles & check_suspect_i18n_usage) &&
                          functionName == L"wxGetTranslation" && parameterPosition == 0)
                     {
-                    m_suspect_i18n_usage.emplace_back(
-                        functionName,
-                        string_info::usage_info(
-                            string_info::usage_info::usage_type::function,
+                    add_string(m_suspect_i18n_usage, functionName,
+                               string_info::usage_info(
+                                   string_info::usage_info::usage_type::function,
 #ifdef wxVERSION_NUMBER
-                            _(L"First argument to wxGetTranslation() should not "
-                              "be a literal string. Prefer using _() for literal strings.")
-                                .wc_str(),
+                                   _(L"First argument to wxGetTranslation() should not "
+                                     "be a literal string. Prefer using _() for literal strings.")
+                                       .wc_str(),
 #else
-                            L"First argument to wxGetTranslation() should not "
-                            "be a literal string. Prefer using _() for literal strings.",
+                                   L"First argument to wxGetTranslation() should not "
+                                   "be a literal string. Prefer using _() for literal strings.",
 #endif
-                            std::wstring{}, true),
-                        m_file_name, get_line_and_column(currentTextPos - m_file_start));
+                                   std::wstring_view{}, true),
+                               m_file_id, get_line_and_column(currentTextPos - m_file_start));
                     }
                 else if (static_cast<bool>(m_review_styles & check_suspect_i18n_usage) &&
                          (functionName == L"QT_TRID_NOOP" || functionName == L"QT_TRID_N_NOOP" ||
@@ -1789,8 +1748,8 @@ namespace i18n_check
                     if (static_cast<bool>(m_review_styles & check_suspect_i18n_usage) &&
                         contextLength > 32)
                         {
-                        m_suspect_i18n_usage.emplace_back(
-                            functionName,
+                        add_string(
+                            m_suspect_i18n_usage, functionName,
                             string_info::usage_info(
                                 string_info::usage_info::usage_type::function,
 #ifdef wxVERSION_NUMBER
@@ -1802,19 +1761,19 @@ namespace i18n_check
                                 L"This function is meant for string IDs, not translatable strings."
                                 "Are you sure the provided argument is an ID?",
 #endif
-                                std::wstring{}, true),
-                            m_file_name, get_line_and_column(currentTextPos - m_file_start));
+                                std::wstring_view{}, true),
+                            m_file_id, get_line_and_column(currentTextPos - m_file_start));
                         }
                     }
                 else
                     {
-                    m_localizable_strings.emplace_back(
-                        std::wstring(currentTextPos, quoteEnd - currentTextPos),
-                        string_info::usage_info(string_info::usage_info::usage_type::function,
-                                                functionName, std::wstring{},
-                                                (is_i18n_with_context_function(functionName) ||
-                                                 m_context_comment_active)),
-                        m_file_name, get_line_and_column(currentTextPos - m_file_start));
+                    add_string(m_localizable_strings, quoteText,
+                               string_info::usage_info(
+                                   string_info::usage_info::usage_type::function, functionName,
+                                   std::wstring_view{},
+                                   (is_i18n_with_context_function(functionName) ||
+                                    m_context_comment_active)),
+                               m_file_id, get_line_and_column(currentTextPos - m_file_start));
 
                     assert(functionVarNamePos);
                     if (functionVarNamePos != nullptr &&
@@ -1832,12 +1791,12 @@ namespace i18n_check
                         if (deprecatedMacroOuterEncountered.length() > 0 &&
                             static_cast<bool>(m_review_styles & check_deprecated_macros))
                             {
-                            m_deprecated_macros.emplace_back(
-                                deprecatedMacroOuterEncountered,
-                                string_info::usage_info(
-                                    string_info::usage_info::usage_type::function, std::wstring{},
-                                    std::wstring{}),
-                                m_file_name, get_line_and_column(currentTextPos - m_file_start));
+                            add_string(m_deprecated_macros, deprecatedMacroOuterEncountered,
+                                       string_info::usage_info(
+                                           string_info::usage_info::usage_type::function,
+                                           std::wstring_view{}, std::wstring_view{}),
+                                       m_file_id,
+                                       get_line_and_column(currentTextPos - m_file_start));
                             }
                         // internal functions
                         if (is_diagnostic_function(functionNameOuter) ||
@@ -1845,39 +1804,43 @@ namespace i18n_check
                             m_variable_types_to_ignore.find(functionNameOuter) !=
                                 m_variable_types_to_ignore.cend())
                             {
-                            m_localizable_strings_in_internal_call.emplace_back(
-                                std::wstring(currentTextPos, quoteEnd - currentTextPos),
-                                string_info::usage_info(
-                                    string_info::usage_info::usage_type::function,
-                                    functionNameOuter, std::wstring{}),
-                                m_file_name, get_line_and_column(currentTextPos - m_file_start));
+                            add_string(m_localizable_strings_in_internal_call, quoteText,
+                                       string_info::usage_info(
+                                           string_info::usage_info::usage_type::function,
+                                           functionNameOuter, std::wstring_view{}),
+                                       m_file_id,
+                                       get_line_and_column(currentTextPos - m_file_start));
                             }
                         // untranslatable variable types
                         else if (m_variable_types_to_ignore.find(variableTypeOuter) !=
                                  m_variable_types_to_ignore.cend())
                             {
-                            m_localizable_strings_in_internal_call.emplace_back(
-                                std::wstring(currentTextPos, quoteEnd - currentTextPos),
-                                string_info::usage_info(
-                                    string_info::usage_info::usage_type::variable,
-                                    variableNameOuter, variableTypeOuter),
-                                m_file_name, get_line_and_column(currentTextPos - m_file_start));
+                            add_string(m_localizable_strings_in_internal_call, quoteText,
+                                       string_info::usage_info(
+                                           string_info::usage_info::usage_type::variable,
+                                           variableNameOuter, variableTypeOuter),
+                                       m_file_id,
+                                       get_line_and_column(currentTextPos - m_file_start));
                             }
                         // untranslatable variable names (e.g., debugMsg)
                         else if (variableNameOuter.length() > 0)
                             {
                             try
                                 {
-                                for (const auto& reg : get_ignored_variable_patterns())
+                                const auto& variablePatterns{ get_ignored_variable_patterns() };
+                                for (size_t i = 0; i < variablePatterns.size(); ++i)
                                     {
-                                    if (std::regex_match(variableNameOuter, reg))
+                                    if (I18N_PROFILE_REGEX(
+                                            get_variable_name_pattern_profile_name(i),
+                                            std::regex_match(variableNameOuter,
+                                                             variablePatterns[i])))
                                         {
-                                        m_localizable_strings_in_internal_call.emplace_back(
-                                            std::wstring(currentTextPos, quoteEnd - currentTextPos),
+                                        add_string(
+                                            m_localizable_strings_in_internal_call, quoteText,
                                             string_info::usage_info(
                                                 string_info::usage_info::usage_type::variable,
                                                 variableNameOuter, variableTypeOuter),
-                                            m_file_name,
+                                            m_file_id,
                                             get_line_and_column(currentTextPos - m_file_start));
                                         break;
                                         }
@@ -1885,9 +1848,9 @@ namespace i18n_check
                                 }
                             catch (const std::exception& exp)
                                 {
-                                log_message(variableNameOuter,
-                                            i18n_string_util::lazy_string_to_wstring(exp.what()),
-                                            (currentTextPos - m_file_start));
+                                log_message(parse_message_code::exception, variableNameOuter,
+                                            (currentTextPos - m_file_start),
+                                            i18n_string_util::lazy_string_to_wstring(exp.what()));
                                 }
                             }
                         }
@@ -1897,45 +1860,43 @@ namespace i18n_check
                 }
             else if (is_non_i18n_function(functionName))
                 {
-                m_marked_as_non_localizable_strings.emplace_back(
-                    std::wstring(currentTextPos, quoteEnd - currentTextPos),
-                    string_info::usage_info(string_info::usage_info::usage_type::function,
-                                            functionName, std::wstring{}),
-                    m_file_name, get_line_and_column(currentTextPos - m_file_start));
+                add_string(m_marked_as_non_localizable_strings, quoteText,
+                           string_info::usage_info(string_info::usage_info::usage_type::function,
+                                                   functionName, std::wstring_view{}),
+                           m_file_id, get_line_and_column(currentTextPos - m_file_start));
                 }
             else if (m_variable_types_to_ignore.find(functionName) !=
                      m_variable_types_to_ignore.cend())
                 {
-                m_internal_strings.emplace_back(
-                    std::wstring(currentTextPos, quoteEnd - currentTextPos),
-                    string_info::usage_info(string_info::usage_info::usage_type::function,
-                                            functionName, std::wstring{}),
-                    m_file_name, get_line_and_column(currentTextPos - m_file_start));
+                add_string(m_internal_strings, quoteText,
+                           string_info::usage_info(string_info::usage_info::usage_type::function,
+                                                   functionName, std::wstring_view{}),
+                           m_file_id, get_line_and_column(currentTextPos - m_file_start));
                 }
             else if (is_keyword(functionName))
                 {
                 classify_non_localizable_string(
-                    string_info(std::wstring(currentTextPos, quoteEnd - currentTextPos),
+                    string_info(quoteText,
                                 string_info::usage_info(string_info::usage_info::usage_type::orphan,
-                                                        std::wstring{}, std::wstring{}),
-                                m_file_name, get_line_and_column(currentTextPos - m_file_start)));
+                                                        std::wstring_view{}, std::wstring_view{}),
+                                m_file_id, get_line_and_column(currentTextPos - m_file_start)));
                 }
             else
                 {
                 classify_non_localizable_string(string_info(
-                    std::wstring(currentTextPos, quoteEnd - currentTextPos),
+                    quoteText,
                     string_info::usage_info(string_info::usage_info::usage_type::function,
-                                            functionName, std::wstring{}),
-                    m_file_name, get_line_and_column(currentTextPos - m_file_start)));
+                                            functionName, std::wstring_view{}),
+                    m_file_id, get_line_and_column(currentTextPos - m_file_start)));
                 }
             }
         else
             {
             classify_non_localizable_string(
-                string_info(std::wstring(currentTextPos, quoteEnd - currentTextPos),
+                string_info(quoteText,
                             string_info::usage_info(string_info::usage_info::usage_type::orphan,
-                                                    std::wstring{}, std::wstring{}),
-                            m_file_name, get_line_and_column(currentTextPos - m_file_start)));
+                                                    std::wstring_view{}, std::wstring_view{}),
+                            m_file_id, get_line_and_column(currentTextPos - m_file_start)));
             }
         clear_section(currentTextPos, std::next(quoteEnd));
         }
@@ -1949,7 +1910,7 @@ namespace i18n_check
         if (variableType.length() > 0 &&
             get_ignored_variable_types().find(variableType) ==
                 get_ignored_variable_types().cend() &&
-            m_ctors_to_ignore.find(variableType) == m_ctors_to_ignore.cend() &&
+            !m_ctors_to_ignore.contains(variableType) &&
             (variableType.length() < 5 ||
              std::wstring_view(variableType.c_str(), 5).compare(std::wstring_view{ L"std::", 5 }) !=
                  0) &&
@@ -1971,19 +1932,18 @@ namespace i18n_check
             variableType != L"LPCTSTR" && variableType != L"CDialog" &&
             variableType != L"LanguageInfo" && variableType != L"MessageParameters")
             {
-            log_message(variableType, L"New variable type detected.", quotePosition);
+            log_message(parse_message_code::new_variable_type, variableType, quotePosition);
             }
 #endif
         // For large string values, a 1024 substring will suffice for classifying it.
         // This is more optimal and will prevent memory exhaustion with regex comparisons.
-        std::wstring clippedValue{ value.length() >= 1024 ? value.substr(0, 1024) : value };
+        const std::wstring_view clippedValue{ value.substr(0, 1024) };
         if (get_ignored_variable_types().find(variableType) != get_ignored_variable_types().cend())
             {
-            m_internal_strings.emplace_back(
-                std::move(clippedValue),
-                string_info::usage_info(string_info::usage_info::usage_type::variable, variableName,
-                                        variableType),
-                m_file_name, get_line_and_column(quotePosition));
+            add_string(m_internal_strings, clippedValue,
+                       string_info::usage_info(string_info::usage_info::usage_type::variable,
+                                               variableName, variableType),
+                       m_file_id, get_line_and_column(quotePosition));
             return;
             }
         if (!get_ignored_variable_patterns().empty())
@@ -1991,15 +1951,17 @@ namespace i18n_check
             try
                 {
                 bool matchedInternalVar(false);
-                for (const auto& reg : get_ignored_variable_patterns())
+                const auto& variablePatterns{ get_ignored_variable_patterns() };
+                for (size_t i = 0; i < variablePatterns.size(); ++i)
                     {
-                    if (std::regex_match(variableName, reg))
+                    if (I18N_PROFILE_REGEX(get_variable_name_pattern_profile_name(i),
+                                           std::regex_match(variableName, variablePatterns[i])))
                         {
-                        m_internal_strings.emplace_back(
-                            std::move(clippedValue),
+                        add_string(
+                            m_internal_strings, clippedValue,
                             string_info::usage_info(string_info::usage_info::usage_type::variable,
                                                     variableName, variableType),
-                            m_file_name, get_line_and_column(quotePosition));
+                            m_file_id, get_line_and_column(quotePosition));
                         matchedInternalVar = true;
                         break;
                         }
@@ -2008,25 +1970,25 @@ namespace i18n_check
                 if (!matchedInternalVar)
                     {
                     classify_non_localizable_string(string_info(
-                        std::move(clippedValue),
+                        clippedValue,
                         string_info::usage_info(string_info::usage_info::usage_type::variable,
                                                 variableName, variableType),
-                        m_file_name, get_line_and_column(quotePosition)));
+                        m_file_id, get_line_and_column(quotePosition)));
                     }
                 }
             catch (const std::exception& exp)
                 {
-                log_message(variableName, i18n_string_util::lazy_string_to_wstring(exp.what()),
-                            quotePosition);
+                log_message(parse_message_code::exception, variableName, quotePosition,
+                            i18n_string_util::lazy_string_to_wstring(exp.what()));
                 }
             }
         else
             {
             classify_non_localizable_string(
-                string_info(std::move(clippedValue),
+                string_info(clippedValue,
                             string_info::usage_info(string_info::usage_info::usage_type::variable,
                                                     variableName, variableType),
-                            m_file_name, get_line_and_column(quotePosition)));
+                            m_file_id, get_line_and_column(quotePosition)));
             }
         }
 
@@ -2040,7 +2002,8 @@ namespace i18n_check
             m_not_available_for_localization_strings.reserve(std::min<size_t>(fileCount, 10));
             m_marked_as_non_localizable_strings.reserve(std::min<size_t>(fileCount, 10));
             m_internal_strings.reserve(std::min<size_t>(fileCount, 10));
-            m_unsafe_localizable_strings.reserve(std::min<size_t>(fileCount, 10));
+            m_string_issues[static_cast<size_t>(string_issue::unsafe_localizable)].reserve(
+                std::min<size_t>(fileCount, 10));
             m_deprecated_macros.reserve(std::min<size_t>(fileCount, 10));
             }
         catch (const std::bad_alloc&)
@@ -2052,26 +2015,46 @@ namespace i18n_check
     void i18n_review::clear_results() noexcept
         {
         m_localizable_strings.clear();
-        m_localizable_strings_with_unlocalizable_content.clear();
-        m_localizable_strings_with_urls.clear();
-        m_localizable_strings_ambiguous_needing_context.clear();
         m_localizable_strings_in_internal_call.clear();
-        m_localizable_strings_with_surrounding_spaces.clear();
         m_not_available_for_localization_strings.clear();
         m_marked_as_non_localizable_strings.clear();
         m_internal_strings.clear();
-        m_unsafe_localizable_strings.clear();
+        m_issue_only_strings.clear();
+        for (auto& issues : m_string_issues)
+            {
+            issues.clear();
+            }
         m_deprecated_macros.clear();
-        m_unencoded_strings.clear();
-        m_printf_single_numbers.clear();
         m_ids_assigned_number.clear();
         m_duplicates_value_assigned_to_ids.clear();
-        m_malformed_strings.clear();
         m_trailing_spaces.clear();
         m_tabs.clear();
         m_wide_lines.clear();
         m_comments_missing_space.clear();
         m_suspect_i18n_usage.clear();
+        // the strings above are all stored here, so they can be freed all at once
+        m_string_arena.release();
+        }
+
+    //--------------------------------------------------
+    size_t i18n_review::get_results_memory_usage() const noexcept
+        {
+        size_t stringCount{
+            m_localizable_strings.size() + m_localizable_strings_in_internal_call.size() +
+            m_not_available_for_localization_strings.size() +
+            m_marked_as_non_localizable_strings.size() + m_internal_strings.size() +
+            m_issue_only_strings.size() + m_deprecated_macros.size() +
+            m_ids_assigned_number.size() + m_duplicates_value_assigned_to_ids.size() +
+            m_trailing_spaces.size() + m_tabs.size() + m_wide_lines.size() +
+            m_comments_missing_space.size() + m_suspect_i18n_usage.size()
+        };
+        size_t issueCount{ 0 };
+        for (const auto& issues : m_string_issues)
+            {
+            issueCount += issues.size();
+            }
+        return (stringCount * sizeof(string_info)) + (issueCount * sizeof(string_reference)) +
+               (m_string_arena.get_length() * sizeof(wchar_t));
         }
 
     //--------------------------------------------------
@@ -2079,18 +2062,18 @@ namespace i18n_check
         {
         try
             {
-            return (std::regex_match(functionName, m_diagnostic_function_regex) ||
-                    (m_internal_functions.find(functionName) != m_internal_functions.cend()) ||
-                    (m_internal_functions.find(extract_base_function(functionName)) !=
-                     m_internal_functions.cend()) ||
+            // the table lookups are cheaper than the regex, so try those first
+            return (contains_function(m_internal_functions, functionName) ||
                     functionName.ends_with(L"_TRACE") || functionName.ends_with(L"_DEBUG") ||
                     (!can_log_messages_be_translatable() &&
-                     m_log_functions.find(functionName) != m_log_functions.cend()));
+                     m_log_functions.contains(functionName)) ||
+                    I18N_PROFILE_REGEX(L"m_diagnostic_function_regex",
+                                       m_diagnostic_function_regex.matches(functionName)));
             }
         catch (const std::exception& exp)
             {
-            log_message(functionName, i18n_string_util::lazy_string_to_wstring(exp.what()),
-                        std::wstring::npos);
+            log_message(parse_message_code::exception, functionName, std::wstring::npos,
+                        i18n_string_util::lazy_string_to_wstring(exp.what()));
             return true;
             }
         }
@@ -2105,10 +2088,7 @@ namespace i18n_check
             return std::make_pair(true, strToReview.length());
             }
 
-        static const std::wregex loremIpsum(L"Lorem ipsum.*", std::regex_constants::icase);
-        static const std::wregex brownFox(L"the quick brown fox.*", std::regex_constants::icase);
-        static const std::wregex percentageRegEx(LR"(([0-9]+|\{[a-z0-9]\}|%[udil]{1,2})%)");
-        if (std::regex_match(strToReview, percentageRegEx))
+        if (i18n_matchers::is_percentage(strToReview))
             {
             return std::make_pair(false, strToReview.length());
             }
@@ -2116,10 +2096,10 @@ namespace i18n_check
         i18n_string_util::replace_escaped_control_chars(strToReview);
         string_util::trim(strToReview);
         // see if a function signature before stripping printf commands and whatnot
-        if ((std::regex_match(strToReview, m_function_signature_regex) ||
-             std::regex_match(strToReview, m_open_function_signature_regex)) &&
+        if ((i18n_matchers::is_function_signature(strToReview) ||
+             i18n_matchers::is_open_function_signature(strToReview)) &&
             // but allow something like "Item(s)"
-            !std::regex_match(strToReview, m_plural_regex))
+            !i18n_matchers::is_plural_suffix(strToReview))
             {
             return std::make_pair(true, strToReview.length());
             }
@@ -2145,17 +2125,19 @@ namespace i18n_check
             // Note that we skip any punctuation (not word characters, excluding '<')
             // in front of the initial '<' (sometimes there are braces and brackets
             // in front of the HTML tags).
-            strToReview =
-                std::regex_replace(strToReview, std::wregex(LR"(<br[[:space:]]*\/>)"), L"\n");
+            const auto& rules = get_rule_tables();
+            strToReview = I18N_PROFILE_REGEX(
+                L"m_html_break_regex", rules.m_html_break_regex.replace(strToReview, L"\n"));
             string_util::trim(strToReview);
-            if (std::regex_match(strToReview, m_xml_element_regex) ||
-                std::regex_match(strToReview, m_html_regex) ||
-                std::regex_match(strToReview, m_html_element_with_content_regex) ||
-                std::regex_match(strToReview, m_html_tag_regex) ||
-                std::regex_match(strToReview, m_html_tag_unicode_regex))
+            if (i18n_matchers::is_xml_element(strToReview) ||
+                i18n_matchers::is_html_markup(strToReview) ||
+                i18n_matchers::is_html_element_with_content(strToReview) ||
+                i18n_matchers::starts_with_html_entity(strToReview) ||
+                i18n_matchers::starts_with_html_numeric_entity(strToReview))
                 {
                 // it's really something like "<enter comment.>", which can be translatable
-                if (std::regex_match(strToReview, m_not_xml_element_regex))
+                if (I18N_PROFILE_REGEX(L"m_not_xml_element_regex",
+                                       m_not_xml_element_regex.matches(strToReview)))
                     {
                     return std::make_pair(false, strToReview.length());
                     }
@@ -2163,17 +2145,17 @@ namespace i18n_check
                 // Avoid a false positive for single words in braces.
                 // It may be an HTML/XML element, but it may also be a user-facing string,
                 // so error on the side of that.
-                if (std::regex_match(strToReview, m_angle_braced_one_word_regex) &&
-                    !std::regex_match(strToReview, m_html_known_elements_regex))
+                if (I18N_PROFILE_REGEX(L"m_angle_braced_one_word_regex",
+                                       m_angle_braced_one_word_regex.matches(strToReview)) &&
+                    !I18N_PROFILE_REGEX(L"m_html_known_elements_regex",
+                                        m_html_known_elements_regex.matches(strToReview)))
                     {
                     if (limitWordCount)
                         {
                         // see if it has enough words
-                        const auto matchCount{ std::distance(
-                            std::wsregex_iterator(strToReview.cbegin(), strToReview.cend(),
-                                                  m_1word_regex),
-                            std::wsregex_iterator()) };
-                        if (static_cast<size_t>(matchCount) <
+                        const auto matchCount{ I18N_PROFILE_REGEX(
+                            L"m_1word_regex", m_1word_regex.count(strToReview)) };
+                        if (matchCount <
                             get_min_words_for_classifying_unavailable_string())
                             {
                             return std::make_pair(true, strToReview.length());
@@ -2184,32 +2166,32 @@ namespace i18n_check
                         return std::make_pair(false, strToReview.length());
                         }
                     }
-                strToReview = std::regex_replace(
-                    strToReview, std::wregex(LR"(<script[\d\D]*?>[\d\D]*?</script>)"), L"");
-                strToReview = std::regex_replace(
-                    strToReview, std::wregex(LR"(<style[\d\D]*?>[\d\D]*?</style>)"), L"");
-                strToReview = std::regex_replace(
-                    strToReview,
-                    std::wregex(L"<[?]?[A-Za-z0-9+_/\\-\\.'\"=;:!%[:space:]\\\\,()]+[?]?>"), L"");
-                strToReview = std::regex_replace(strToReview, m_xml_element_regex, L"");
+                strToReview = I18N_PROFILE_REGEX(
+                    L"m_html_script_regex", rules.m_html_script_regex.replace(strToReview, L""));
+                strToReview = I18N_PROFILE_REGEX(
+                    L"m_html_style_regex", rules.m_html_style_regex.replace(strToReview, L""));
+                strToReview = I18N_PROFILE_REGEX(L"m_html_tag_regex",
+                                                 rules.m_html_tag_regex.replace(strToReview, L""));
+                strToReview = I18N_PROFILE_REGEX(L"m_xml_element_regex",
+                                                 m_xml_element_regex.replace(strToReview, L""));
                 // strip things like &ldquo;
-                strToReview = std::regex_replace(strToReview, std::wregex(L"&[a-zA-Z]{2,5};"), L"");
-                strToReview =
-                    std::regex_replace(strToReview, std::wregex(L"&#[[:digit:]]{2,4};"), L"");
+                strToReview = I18N_PROFILE_REGEX(
+                    L"m_html_entity_regex", rules.m_html_entity_regex.replace(strToReview, L""));
+                strToReview = I18N_PROFILE_REGEX(
+                    L"m_html_numeric_entity_regex",
+                    rules.m_html_numeric_entity_regex.replace(strToReview, L""));
                 }
 
             // see if it has enough words
-            const auto matchCount{ std::distance(
-                std::wsregex_iterator(strToReview.cbegin(), strToReview.cend(), m_1word_regex),
-                std::wsregex_iterator()) };
+            const auto matchCount{ I18N_PROFILE_REGEX(L"m_1word_regex",
+                                                      m_1word_regex.count(strToReview)) };
             if (!is_allowing_translating_punctuation_only_strings() && matchCount == 0)
                 {
                 return std::make_pair(true, strToReview.length());
                 }
             else if (limitWordCount)
                 {
-                if (static_cast<size_t>(matchCount) <
-                    get_min_words_for_classifying_unavailable_string())
+                if (matchCount < get_min_words_for_classifying_unavailable_string())
                     {
                     return std::make_pair(true, strToReview.length());
                     }
@@ -2217,7 +2199,8 @@ namespace i18n_check
 
             // Nothing but punctuation? If that's OK to allow, then let it through.
             if (is_allowing_translating_punctuation_only_strings() &&
-                std::regex_match(strToReview, std::wregex(L"[[:punct:]]+")))
+                I18N_PROFILE_REGEX(L"m_punctuation_only_regex",
+                                   rules.m_punctuation_only_regex.matches(strToReview)))
                 {
                 return std::make_pair(false, strToReview.length());
                 }
@@ -2236,7 +2219,7 @@ namespace i18n_check
             constexpr size_t maxWordSize{ 20 };
             if (strToReview.length() <= 1 ||
                 // not at least two letters together
-                !std::regex_search(strToReview, m_2letter_regex) ||
+                !I18N_PROFILE_REGEX(L"m_2letter_regex", m_2letter_regex.contains(strToReview)) ||
                 // single word (no spaces or word separators) and more than 20 characters--
                 // doesn't seem like a real word meant for translation
                 (strToReview.length() > maxWordSize &&
@@ -2244,8 +2227,7 @@ namespace i18n_check
                  strToReview.find(L"\\n") == std::wstring::npos &&
                  strToReview.find(L"\\r") == std::wstring::npos &&
                  strToReview.find(L"\\t") == std::wstring::npos) ||
-                m_known_internal_strings.find(strToReview.c_str()) !=
-                    m_known_internal_strings.end() ||
+                rules.m_known_internal_strings.contains(strToReview) ||
                 // a string like "_tcscoll" be odd to be in string, but just in case it
                 // should not be localized
                 m_deprecated_string_functions.find(strToReview.c_str()) !=
@@ -2262,11 +2244,11 @@ namespace i18n_check
                 }
             // social media hashtag (or formatting code of some sort),
             // keyboard shortcuts, code, placeholder text, etc.
-            if (std::regex_match(strToReview, m_hashtag_regex) ||
-                std::regex_match(strToReview, m_key_shortcut_regex) ||
-                std::regex_match(strToReview, loremIpsum) ||
-                std::regex_match(strToReview, brownFox) ||
-                std::regex_match(strToReview, m_sql_code))
+            if (i18n_matchers::is_hashtag(strToReview) ||
+                i18n_matchers::is_key_shortcut(strToReview) ||
+                i18n_matchers::starts_with_line_icase(strToReview, L"Lorem ipsum") ||
+                i18n_matchers::starts_with_line_icase(strToReview, L"the quick brown fox") ||
+                i18n_matchers::is_sql_code(strToReview))
                 {
                 return std::make_pair(true, strToReview.length());
                 }
@@ -2286,44 +2268,46 @@ namespace i18n_check
                 }
 
             // strings that may look like they should not be translatable, but are actually OK
-            for (const auto& reg : m_translatable_regexes)
+            const auto translatableMatch = rules.m_translatable_regexes.find_match(strToReview);
+            if (translatableMatch != regex_set::npos)
                 {
-                if (std::regex_match(strToReview, reg))
-                    {
 #ifndef NDEBUG
-                    if (strToReview.length() > m_longest_internal_string.first.length())
-                        {
-                        m_longest_internal_string.first = strToReview;
-                        m_longest_internal_string.second = reg;
-                        }
-#endif
-                    return std::make_pair(false, strToReview.length());
+                if (strToReview.length() > m_longest_internal_string.first.length())
+                    {
+                    m_longest_internal_string.first = strToReview;
+                    m_longest_internal_string.second =
+                        rules.m_translatable_regexes.get_regex(translatableMatch);
                     }
+#endif
+                return std::make_pair(false, strToReview.length());
                 }
 
-            for (const auto& reg : m_untranslatable_regexes)
+            // only the patterns that can begin with the string's first character are tried
+            const auto untranslatableMatch = rules.m_untranslatable_regexes.find_match(strToReview);
+            if (untranslatableMatch != regex_set::npos)
                 {
-                if (std::regex_match(strToReview, reg))
-                    {
 #ifndef NDEBUG
-                    if (strToReview.length() > m_longest_internal_string.first.length())
-                        {
-                        m_longest_internal_string.first = strToReview;
-                        m_longest_internal_string.second = reg;
-                        }
-#endif
-                    return std::make_pair(true, strToReview.length());
+                if (strToReview.length() > m_longest_internal_string.first.length())
+                    {
+                    m_longest_internal_string.first = strToReview;
+                    m_longest_internal_string.second =
+                        rules.m_untranslatable_regexes.get_regex(untranslatableMatch);
                     }
+#endif
+                return std::make_pair(true, strToReview.length());
+                }
+            if (m_untranslatable_patterns.is_match(strToReview))
+                {
+                return std::make_pair(true, strToReview.length());
                 }
-            return std::make_pair((is_font_name(strToReview.c_str()) ||
-                                   is_file_extension(strToReview.c_str()) ||
+            return std::make_pair((is_font_name(strToReview) || is_file_extension(strToReview) ||
                                    i18n_string_util::is_file_address(strToReview)),
                                   strToReview.length());
             }
         catch (const std::exception& exp)
             {
-            log_message(strToReview, i18n_string_util::lazy_string_to_wstring(exp.what()),
-                        std::wstring::npos);
+            log_message(parse_message_code::exception, strToReview, std::wstring::npos,
+                        i18n_string_util::lazy_string_to_wstring(exp.what()));
             return std::make_pair(false, strToReview.length());
             }
         }
@@ -2333,8 +2317,9 @@ namespace i18n_check
         {
         // for strings that span multiple lines, remove the start/end quotes and newlines
         // between them, combining this into one string
-        const std::wregex multilineRegex(LR"(([^\\])("[\s]+"))");
-        str = std::regex_replace(str, multilineRegex, L"$1");
+        str = I18N_PROFILE_REGEX(
+            L"m_multiline_string_regex",
+            get_rule_tables().m_multiline_string_regex.replace(str, L"$1"));
         // replace any doubled-up quotes with single
         // (C# does this for raw strings)
         if (m_collapse_double_quotes)
@@ -2344,32 +2329,82 @@ namespace i18n_check
         return str;
         }
 
+    //--------------------------------------------------
+    std::wstring_view i18n_review::store_string(std::wstring_view text)
+        {
+        if (!m_retained_file_text.empty() && !text.empty())
+            {
+            const std::less_equal<const wchar_t*> isAtOrBefore;
+            const wchar_t* const retainedEnd{ std::next(
+                m_retained_file_text.data(),
+                static_cast<ptrdiff_t>(m_retained_file_text.length())) };
+            // already a view into the file's text
+            if (isAtOrBefore(m_retained_file_text.data(), text.data()) &&
+                isAtOrBefore(std::next(text.data(), static_cast<ptrdiff_t>(text.length())),
+                             retainedEnd))
+                {
+                return text;
+                }
+            // from the working copy of the file, so use the same span in the original
+            // (as long as that part of the working copy hasn't been changed)
+            if (m_file_start != nullptr && isAtOrBefore(m_file_start, text.data()))
+                {
+                const auto offset{ static_cast<size_t>(text.data() - m_file_start) };
+                if (offset + text.length() <= m_retained_file_text.length() &&
+                    m_retained_file_text.substr(offset, text.length()) == text)
+                    {
+                    return m_retained_file_text.substr(offset, text.length());
+                    }
+                }
+            }
+        return m_string_arena.store(text);
+        }
+
     //--------------------------------------------------
     void i18n_review::process_strings()
         {
         const auto processStrings = [this](auto& strings)
         {
-            std::for_each(strings.begin(), strings.end(), [this](auto& val)
-                          { val.m_string = i18n_review::collapse_multipart_string(val.m_string); });
+            std::for_each(strings.begin(), strings.end(),
+                          [this](auto& val)
+                          {
+                              // both multiline strings and doubled-up quotes
+                              // need quotes in the string, so it can't change if there are none
+                              if (val.m_string.find(L'"') == std::wstring_view::npos)
+                                  {
+                                  return;
+                                  }
+                              const std::wstring collapsedString{
+                                  collapse_multipart_string(std::wstring{ val.m_string })
+                              };
+                              // only store another copy of the string if it changed
+                              if (collapsedString != val.m_string)
+                                  {
+                                  val.m_string = m_string_arena.store(collapsedString);
+                                  }
+                          });
         };
         processStrings(m_localizable_strings);
         processStrings(m_localizable_strings_in_internal_call);
         processStrings(m_not_available_for_localization_strings);
         processStrings(m_marked_as_non_localizable_strings);
         processStrings(m_internal_strings);
-        processStrings(m_unsafe_localizable_strings);
+        processStrings(m_issue_only_strings);
         }
 
     //--------------------------------------------------
     void i18n_review::run_diagnostics()
         {
+        if (m_log_level < log_level::diagnostics)
+            {
+            return;
+            }
         for (const auto& str : m_localizable_strings)
             {
             if (str.m_usage.m_value.empty() &&
                 str.m_usage.m_type != string_info::usage_info::usage_type::orphan)
                 {
-                log_message(str.m_string,
-                            L"Unknown function or variable assignment for this string.",
+                log_message(parse_message_code::unknown_string_usage, str.m_string,
                             std::wstring::npos);
                 }
             }
@@ -2378,8 +2413,7 @@ namespace i18n_check
             if (str.m_usage.m_value.empty() &&
                 str.m_usage.m_type != string_info::usage_info::usage_type::orphan)
                 {
-                log_message(str.m_string,
-                            L"Unknown function or variable assignment for this string.",
+                log_message(parse_message_code::unknown_string_usage, str.m_string,
                             std::wstring::npos);
                 }
             }
@@ -2388,8 +2422,7 @@ namespace i18n_check
             if (str.m_usage.m_value.empty() &&
                 str.m_usage.m_type != string_info::usage_info::usage_type::orphan)
                 {
-                log_message(str.m_string,
-                            L"Unknown function or variable assignment for this string.",
+                log_message(parse_message_code::unknown_string_usage, str.m_string,
                             std::wstring::npos);
                 }
             }
@@ -2398,18 +2431,16 @@ namespace i18n_check
             if (str.m_usage.m_value.empty() &&
                 str.m_usage.m_type != string_info::usage_info::usage_type::orphan)
                 {
-                log_message(str.m_string,
-                            L"Unknown function or variable assignment for this string.",
+                log_message(parse_message_code::unknown_string_usage, str.m_string,
                             std::wstring::npos);
                 }
             }
-        for (const auto& str : m_unsafe_localizable_strings)
+        for (const auto& str : get_unsafe_localizable_strings())
             {
             if (str.m_usage.m_value.empty() &&
                 str.m_usage.m_type != string_info::usage_info::usage_type::orphan)
                 {
-                log_message(str.m_string,
-                            L"Unknown function or variable assignment for this string.",
+                log_message(parse_message_code::unknown_string_usage, str.m_string,
                             std::wstring::npos);
                 }
             }
@@ -2462,9 +2493,8 @@ namespace i18n_check
                         L'<', functionOrVarNamePos - startSentinel);
                     if (openingAngle == std::wstring::npos)
                         {
-                        log_message(L"Template parse error",
-                                    L"Unable to find opening < for template variable.",
-                                    functionOrVarNamePos - startSentinel);
+                        log_message(parse_message_code::missing_template_opening_angle,
+                                    L"Template parse error", functionOrVarNamePos - startSentinel);
                         return;
                         }
                     functionOrVarNamePos =
@@ -2561,7 +2591,7 @@ namespace i18n_check
                 // and keep going backwards.
                 // Or, if no function name probably means extraneous parentheses, so keep going.
                 if (hasExtraneousParens ||
-                    m_ctors_to_ignore.find(functionName) != m_ctors_to_ignore.cend())
+                    m_ctors_to_ignore.contains(functionName))
                     {
                     startPos = std::min(startPos, functionOrVarNamePos);
                     // reset, the current open parenthesis isn't relevant
@@ -2605,12 +2635,10 @@ namespace i18n_check
                     {
                     // see if function is actually a CTOR
                     if (variableName.empty() &&
-                        m_localization_functions.find(functionName) ==
-                            m_localization_functions.cend() &&
-                        m_non_localizable_functions.find(functionName) ==
-                            m_non_localizable_functions.cend() &&
-                        m_internal_functions.find(functionName) == m_internal_functions.cend() &&
-                        m_log_functions.find(functionName) == m_log_functions.cend() &&
+                        !m_localization_functions.contains(functionName) &&
+                        !m_non_localizable_functions.contains(functionName) &&
+                        !m_internal_functions.contains(functionName) &&
+                        !m_log_functions.contains(functionName) &&
                         functionOrVarNamePos >= startSentinel && !is_keyword(functionName))
                         {
                         readVarType();
@@ -2736,10 +2764,8 @@ namespace i18n_check
                         // ignore localization related functions; in this case, it is the
                         // (temporary) string objects << operator being called,
                         // not the localization function
-                        if (m_localization_functions.find(functionName) !=
-                                m_localization_functions.cend() ||
-                            m_non_localizable_functions.find(functionName) !=
-                                m_non_localizable_functions.cend())
+                        if (m_localization_functions.contains(functionName) ||
+                            m_non_localizable_functions.contains(functionName))
                             {
                             functionName.clear();
                             }
@@ -2773,44 +2799,45 @@ namespace i18n_check
         {
         errorInfo.clear();
 
-        const std::wregex positionalRegex{ L"^%([[:digit:]]+)[$](.*)" };
-
         std::map<long, std::wstring> positionalCommands;
         std::vector<std::wstring> adjustedCommands{ printfCommands };
 
         size_t nonPositionalCommands{ 0 };
         for (const auto& pc : printfCommands)
             {
-            std::match_results<std::wstring::const_iterator> matches;
-            if (std::regex_search(pc, matches, positionalRegex))
-                {
-                if (matches.size() >= 3)
+            const auto [positionDigits, specifier] =
+                i18n_matchers::split_positional_printf_specifier(pc);
+            if (!positionDigits.empty())
+                {
+                // position will need to be zero-indexed
+                const long position =
+                    std::wcstol(std::wstring{ positionDigits }.c_str(), nullptr, 10) - 1;
+                const std::wstring command{ L"%" + std::wstring{ specifier } };
+                const auto [insertionPos, inserted] =
+                    positionalCommands.insert(std::make_pair(position, command));
+                // if positional argument is used more than once, make sure they are consistent
+                if (!inserted)
                     {
-                    // position will need to be zero-indexed
-                    long position = std::wcstol(matches[1].str().c_str(), nullptr, 10) - 1;
-                    const auto [insertionPos, inserted] = positionalCommands.insert(
-                        std::make_pair(position, L"%" + matches[2].str()));
-                    // if positional argument is used more than once, make sure they are consistent
-                    if (!inserted)
+                    if (insertionPos->second != command)
                         {
-                        if (insertionPos->second != L"%" + matches[2].str())
-                            {
+                        // the positional argument and its specifier
+                        const std::wstring fullCommand{ pc.substr(
+                            0, (specifier.data() - pc.data()) + specifier.length()) };
 #ifdef wxVERSION_NUMBER
-                            errorInfo =
-                                wxString::Format(_(L"('%s': positional argument provided more than "
-                                                   "once, but with different data types.)"),
-                                                 matches[0].str())
-                                    .wc_string();
+                        errorInfo =
+                            wxString::Format(_(L"('%s': positional argument provided more than "
+                                               "once, but with different data types.)"),
+                                             fullCommand)
+                                .wc_string();
 #else
-                            errorInfo =
-                                L"('" + matches[0].str() +
-                                _DT(L"': positional argument provided more than once, but with "
-                                    "different data types.)");
+                        errorInfo =
+                            L"('" + fullCommand +
+                            _DT(L"': positional argument provided more than once, but with "
+                                "different data types.)");
 #endif
-                            return std::vector<std::wstring>{};
-                            }
+                        return std::vector<std::wstring>{};
                         }
-                    };
+                    }
                 }
             else
                 {
@@ -2847,16 +2874,15 @@ namespace i18n_check
         // This will grab numbers like "36 600" (non-breaking space only, not regular space),
         // "36,600", and "36.600".
         // Also, 7-bit, full-width, and Hindi numbers will be extracted.
-        const std::wregex numberRegex{
-            LR"([[:digit:]\u0966-\u096F\uFF10-\uFF19]+([ ,\.][[:digit:]\u0966-\u096F\uFF10-\uFF19]+)*)"
-        };
+        const regex_pattern& numberRegex{ get_rule_tables().m_number_regex };
         // this will then normalize them all to 36600
-        const std::wregex separatorsRegex{ LR"([ ,\.])" };
+        const regex_pattern& separatorsRegex{ get_rule_tables().m_number_separators_regex };
         std::wstring_view::const_iterator searchStart{ resource.cbegin() };
-        std::match_results<std::wstring_view::const_iterator> res;
-        while (std::regex_search(searchStart, resource.cend(), res, numberRegex))
+        while (const auto res = I18N_PROFILE_REGEX(
+                   L"m_number_regex",
+                   numberRegex.search(std::wstring_view{ searchStart, resource.cend() })))
             {
-            searchStart += res.position();
+            searchStart += res->m_position;
             if (searchStart == resource.cbegin() || *std::prev(searchStart) != L'%')
                 {
                 const bool isPrintfOrPositional{ (
@@ -2872,8 +2898,11 @@ namespace i18n_check
                     {
                     // remove all decimal and thousand separators and
                     // convert full-width numbers to 7-bit numbers
-                    std::wstring strippedText{ std::regex_replace(res.str(0), separatorsRegex,
-                                                                  L"") };
+                    std::wstring strippedText{ I18N_PROFILE_REGEX(
+                        L"m_number_separators_regex",
+                        separatorsRegex.replace(
+                            std::wstring_view{ searchStart, std::next(searchStart, res->m_length) },
+                            L"")) };
                     std::for_each(strippedText.begin(), strippedText.end(),
                                   [](wchar_t& chr)
                                   {
@@ -2883,7 +2912,7 @@ namespace i18n_check
                     results.push_back(std::move(strippedText));
                     }
                 }
-            searchStart += res.length();
+            searchStart += res->m_length;
             }
         std::sort(results.begin(), results.end());
         return results;
@@ -2894,13 +2923,13 @@ namespace i18n_check
         {
         std::vector<std::wstring> results;
 
-        std::wregex positionalRegex{ L"[%][L]?[0-9]{1,}" };
-        std::wstring_view::const_iterator searchStart{ resource.cbegin() };
-        std::match_results<std::wstring_view::const_iterator> res;
-        while (std::regex_search(searchStart, resource.cend(), res, positionalRegex))
+        const regex_pattern& positionalRegex{ get_rule_tables().m_positional_number_regex };
+        std::wstring_view remainingText{ resource };
+        while (const auto res = I18N_PROFILE_REGEX(L"m_positional_number_regex",
+                                                   positionalRegex.search(remainingText)))
             {
-            searchStart += res.position() + res.length();
-            results.push_back(res.str(0));
+            results.emplace_back(remainingText.substr(res->m_position, res->m_length));
+            remainingText.remove_prefix(res->m_position + res->m_length);
             }
         std::sort(results.begin(), results.end());
         return results;
@@ -2910,87 +2939,40 @@ namespace i18n_check
     std::vector<std::wstring> i18n_review::load_cpp_printf_commands(std::wstring_view resource,
                                                                     std::wstring& errorInfo)
         {
-        std::vector<std::pair<size_t, std::wstring>> results;
-
-        // we need to do this multipass because a single regex command for all printf
-        // commands is too complex and will cause the regex library to randomly throw exceptions
-        std::wstring_view::const_iterator searchStart(resource.cbegin());
-        std::match_results<std::wstring_view::const_iterator> res;
-        size_t commandPosition{ 0 };
-        size_t previousLength{ 0 };
-        while (std::regex_search(searchStart, resource.cend(), res, m_printf_cpp_int_regex))
-            {
-            searchStart += res.position() + res.length();
-            commandPosition += res.position() + previousLength;
-            previousLength = res.length();
-
-            results.push_back(std::make_pair(commandPosition, res.str(2)));
-            }
-
-        searchStart = resource.cbegin();
-        commandPosition = previousLength = 0;
-        while (std::regex_search(searchStart, resource.cend(), res, m_printf_cpp_float_regex))
-            {
-            searchStart += res.position() + res.length();
-            commandPosition += res.position() + previousLength;
-            previousLength = res.length();
-
-            results.push_back(std::make_pair(commandPosition, res.str(2)));
-            }
-
-        searchStart = resource.cbegin();
-        commandPosition = previousLength = 0;
-        while (std::regex_search(searchStart, resource.cend(), res, m_printf_cpp_string_regex))
-            {
-            searchStart += res.position() + res.length();
-            commandPosition += res.position() + previousLength;
-            previousLength = res.length();
-
-            results.push_back(std::make_pair(commandPosition, res.str(2)));
-            }
-
-        searchStart = resource.cbegin();
-        commandPosition = previousLength = 0;
-        while (std::regex_search(searchStart, resource.cend(), res, m_printf_cpp_pointer_regex))
-            {
-            searchStart += res.position() + res.length();
-            commandPosition += res.position() + previousLength;
-            previousLength = res.length();
+        auto specifiers = i18n_matchers::find_cpp_printf_specifiers(resource);
 
-            results.push_back(std::make_pair(commandPosition, res.str(2)));
-            }
-
-        // sort by position
-        std::sort(results.begin(), results.end(),
-                  [](const auto& lhv, const auto& rhv) noexcept { return lhv.first < rhv.first; });
+        // sort by position (of the text in front of the specifier, which is what the
+        // original regex-based search sorted by)
+        std::stable_sort(specifiers.begin(), specifiers.end(),
+                         [](const auto& lhv, const auto& rhv) noexcept
+                         { return lhv.m_lead_position < rhv.m_lead_position; });
 
         std::vector<std::wstring> finalStrings;
-        finalStrings.reserve(results.size());
-        for (auto& result : results)
+        finalStrings.reserve(specifiers.size());
+        for (const auto& specifier : specifiers)
             {
-            finalStrings.push_back(std::move(result.second));
+            finalStrings.emplace_back(resource.substr(specifier.m_position, specifier.m_length));
             }
 
         return convert_positional_cpp_printf(finalStrings, errorInfo);
         }
-
     //--------------------------------------------------
     std::vector<std::pair<size_t, size_t>>
     i18n_review::load_file_filter_positions(const std::wstring& resource)
         {
         std::vector<std::pair<size_t, size_t>> results;
 
-        std::wstring::const_iterator searchStart{ resource.cbegin() };
-        std::wsmatch res;
+        std::wstring_view remainingText{ resource };
         size_t commandPosition{ 0 };
         size_t previousLength{ 0 };
-        while (std::regex_search(searchStart, resource.cend(), res, m_file_filter_regex))
+        while (const auto res = I18N_PROFILE_REGEX(L"m_file_filter_regex",
+                                                   m_file_filter_regex.search(remainingText)))
             {
-            searchStart += res.position() + res.length();
-            commandPosition += res.position() + previousLength;
-            previousLength = res.length();
+            remainingText.remove_prefix(res->m_position + res->m_length);
+            commandPosition += res->m_position + previousLength;
+            previousLength = res->m_length;
 
-            results.push_back(std::make_pair(commandPosition, res.length()));
+            results.push_back(std::make_pair(commandPosition, res->m_length));
             }
 
         // sort by position
@@ -3004,61 +2986,20 @@ namespace i18n_check
     std::vector<std::pair<size_t, size_t>>
     i18n_review::load_cpp_printf_command_positions(const std::wstring& resource)
         {
-        std::vector<std::pair<size_t, size_t>> results;
-
-        // we need to do this multipass because a single regex command for all printf
-        // commands is too complex and will cause the regex library to randomly throw exceptions
-        std::wstring::const_iterator searchStart{ resource.cbegin() };
-        std::wsmatch res;
-        size_t commandPosition{ 0 };
-        size_t previousLength{ 0 };
-        while (std::regex_search(searchStart, resource.cend(), res, m_printf_cpp_int_regex))
-            {
-            // the position and length of the actual specifier, not the junk in front of it
-            searchStart += res.position(2) + res.length(2);
-            commandPosition += res.position(2) + previousLength;
-            previousLength = res.length(2);
-
-            results.push_back(std::make_pair(commandPosition, res.length(2)));
-            }
-
-        searchStart = resource.cbegin();
-        commandPosition = previousLength = 0;
-        while (std::regex_search(searchStart, resource.cend(), res, m_printf_cpp_float_regex))
-            {
-            searchStart += res.position(2) + res.length(2);
-            commandPosition += res.position(2) + previousLength;
-            previousLength = res.length(2);
-
-            results.push_back(std::make_pair(commandPosition, res.length(2)));
-            }
-
-        searchStart = resource.cbegin();
-        commandPosition = previousLength = 0;
-        while (std::regex_search(searchStart, resource.cend(), res, m_printf_cpp_string_regex))
-            {
-            searchStart += res.position(2) + res.length(2);
-            commandPosition += res.position(2) + previousLength;
-            previousLength = res.length(2);
+        auto specifiers = i18n_matchers::find_cpp_printf_specifiers(resource);
 
-            results.push_back(std::make_pair(commandPosition, res.length(2)));
-            }
+        // sort by position
+        std::stable_sort(specifiers.begin(), specifiers.end(),
+                         [](const auto& lhv, const auto& rhv) noexcept
+                         { return lhv.m_position < rhv.m_position; });
 
-        searchStart = resource.cbegin();
-        commandPosition = previousLength = 0;
-        while (std::regex_search(searchStart, resource.cend(), res, m_printf_cpp_pointer_regex))
+        std::vector<std::pair<size_t, size_t>> results;
+        results.reserve(specifiers.size());
+        for (const auto& specifier : specifiers)
             {
-            searchStart += res.position(2) + res.length(2);
-            commandPosition += res.position(2) + previousLength;
-            previousLength = res.length(2);
-
-            results.push_back(std::make_pair(commandPosition, res.length(2)));
+            results.emplace_back(specifier.m_position, specifier.m_length);
             }
 
-        // sort by position
-        std::sort(results.begin(), results.end(),
-                  [](const auto& lhv, const auto& rhv) noexcept { return lhv.first < rhv.first; });
-
         return results;
         }
 
@@ -3068,17 +3009,17 @@ namespace i18n_check
         {
         std::vector<std::pair<size_t, size_t>> results;
 
-        std::wstring::const_iterator searchStart{ resource.cbegin() };
-        std::wsmatch res;
+        std::wstring_view remainingText{ resource };
         size_t commandPosition{ 0 };
         size_t previousLength{ 0 };
-        while (std::regex_search(searchStart, resource.cend(), res, m_positional_command_regex))
+        while (const auto res = I18N_PROFILE_REGEX(
+                   L"m_positional_command_regex", m_positional_command_regex.search(remainingText)))
             {
-            searchStart += res.position() + res.length();
-            commandPosition += res.position() + previousLength;
-            previousLength = res.length();
+            remainingText.remove_prefix(res->m_position + res->m_length);
+            commandPosition += res->m_position + previousLength;
+            previousLength = res->m_length;
 
-            results.push_back(std::make_pair(commandPosition, res.length()));
+            results.push_back(std::make_pair(commandPosition, res->m_length));
             }
 
         // sort by position
@@ -3151,16 +3092,31 @@ namespace i18n_check
 
         poCatalogEntry.remove_prefix(idPos + msgTag.length());
 
+        const size_t idEndPos{ find_po_msg_end(poCatalogEntry) };
+        if (idEndPos == std::wstring_view::npos)
+            {
+            return { false, std::wstring{}, std::wstring::npos, std::wstring::npos };
+            }
+        const std::wstring msgId{ process_po_msg(poCatalogEntry.substr(0, idEndPos)) };
+
+        poCatalogEntry.remove_prefix(idEndPos);
+
+        return { true, msgId, idPos, idEndPos };
+        }
+
+    //------------------------------------------------
+    size_t i18n_review::find_po_msg_end(const std::wstring_view poMsg)
+        {
         size_t idEndPos{ 0 };
         while (true)
             {
-            idEndPos = poCatalogEntry.find(L'\"', idEndPos);
+            idEndPos = poMsg.find(L'\"', idEndPos);
             if (idEndPos == std::wstring_view::npos)
                 {
-                return { false, std::wstring{}, std::wstring::npos, std::wstring::npos };
+                return std::wstring_view::npos;
                 }
             // skip escaped quotes
-            if (idEndPos > 0 && poCatalogEntry[idEndPos - 1] == L'\\')
+            if (idEndPos > 0 && poMsg[idEndPos - 1] == L'\\')
                 {
                 ++idEndPos;
                 continue;
@@ -3169,32 +3125,26 @@ namespace i18n_check
                 {
                 size_t lookAheadIndex{ idEndPos + 1 };
                 // jump to next line
-                while (lookAheadIndex < poCatalogEntry.length() &&
-                       string_util::is_either(poCatalogEntry[lookAheadIndex], L'\r', L'\n'))
+                while (lookAheadIndex < poMsg.length() &&
+                       string_util::is_either(poMsg[lookAheadIndex], L'\r', L'\n'))
                     {
                     ++lookAheadIndex;
                     }
                 // eat up leading spaces
-                while (lookAheadIndex < poCatalogEntry.length() &&
-                       string_util::is_either(poCatalogEntry[lookAheadIndex], L'\t', L' '))
+                while (lookAheadIndex < poMsg.length() &&
+                       string_util::is_either(poMsg[lookAheadIndex], L'\t', L' '))
                     {
                     ++lookAheadIndex;
                     }
                 // if a quote, then this is still be part of the same string
-                if (lookAheadIndex < poCatalogEntry.length() &&
-                    poCatalogEntry[lookAheadIndex] == L'"')
+                if (lookAheadIndex < poMsg.length() && poMsg[lookAheadIndex] == L'"')
                     {
                     idEndPos = lookAheadIndex + 1;
                     continue;
                     }
-                break;
+                return idEndPos;
                 }
             }
-        const std::wstring msgId{ process_po_msg(poCatalogEntry.substr(0, idEndPos)) };
-
-        poCatalogEntry.remove_prefix(idEndPos);
-
-        return { true, msgId, idPos, idEndPos };
         }
 
     //--------------------------------------------------
@@ -3207,30 +3157,24 @@ namespace i18n_check
             return std::make_pair(std::wstring::npos, std::wstring::npos);
             }
 
-        const auto* startSentinel = (!fileStart.empty() ? fileStart.data() : m_file_start);
-        if (startSentinel == nullptr)
-            {
-            return std::make_pair(std::wstring::npos, std::wstring::npos);
-            }
-        size_t nextLinePosition{ 0 };
-        size_t lineCount{ 0 };
-        while ((nextLinePosition = std::wcscspn(startSentinel, L"\r\n")) < position)
+        if (fileStart.empty())
             {
-            ++lineCount;
-            if (nextLinePosition + 1 < position &&
-                *std::next(startSentinel, static_cast<ptrdiff_t>(nextLinePosition)) == L'\r' &&
-                *std::next(startSentinel, static_cast<ptrdiff_t>(nextLinePosition + 1)) == L'\n')
+            if (m_file_start == nullptr)
                 {
-                std::advance(startSentinel, nextLinePosition + 2);
-                position -= nextLinePosition + 2;
+                return std::make_pair(std::wstring::npos, std::wstring::npos);
                 }
-            else
+            // the loaded file is normally indexed when it is loaded,
+            // but reindex it if another buffer was looked up since then
+            if (m_line_index.get_text().data() != m_file_start)
                 {
-                std::advance(startSentinel, nextLinePosition + 1);
-                position -= nextLinePosition + 1;
+                m_line_index.assign(std::wstring_view{ m_file_start });
                 }
             }
-        // make one-indexed
-        return std::make_pair(lineCount + 1, position + 1);
+        else if (!m_line_index.is_indexing(fileStart))
+            {
+            m_line_index.assign(fileStart);
+            }
+
+        return m_line_index.get_line_and_column(position);
         }
     } // namespace i18n_check
@@ -19,8 +19,20 @@
 #define __I18N_REVIEW_H__
 
 #include "donttranslate.h"
+#include "file_table.h"
 #include "i18n_string_util.h"
+#include "line_index.h"
+#include "name_table.h"
+#include "regex_pattern.h"
+#include "regex_profiler.h"
+#include "regex_set.h"
+#include "string_arena.h"
+#include <array>
+#include <chrono>
+#include <cstdint>
 #include <filesystem>
+#include <functional>
+#include <iterator>
 #include <map>
 #include <optional>
 #include <set>
@@ -201,7 +213,7 @@ namespace i18n_check
         };
 
     /// @brief Types of translation (i.e., l10n) issues.
-    enum class translation_issue
+    enum class translation_issue : uint8_t
         {
         /// @brief Inconsistent printf format specifiers.
         printf_issue,
@@ -242,7 +254,7 @@ namespace i18n_check
 
     /// @brief Types of printf languages that a PO file can contain.
     /// @details This determines which type of syntax is expected.
-    enum class po_format_string
+    enum class po_format_string : uint8_t
         {
         /// @brief This string is not meant for `printf()`-like functions.
         no_format,
@@ -254,28 +266,30 @@ namespace i18n_check
         qt_format
         };
 
-    /// @brief An entry in a PO file, which contains source and translation strings,
-    ///     printf syntax that they use, and any encountered issues.
+    /** @brief An entry in a PO file, which contains source and translation strings
+            and the printf syntax that they use.
+        @details The text is stored by the reviewer that loaded the catalog,
+            so it is only valid until the reviewer's results are cleared.\n
+            Any issues found in the entry are stored in its catalog
+            (see translation_catalog).*/
     struct translation_catalog_entry
         {
         /// @brief The main source string.
-        std::wstring m_source;
+        std::wstring_view m_source;
         /// @brief An optional plural variation of the source string.
-        std::wstring m_source_plural;
+        std::wstring_view m_source_plural;
         /// @brief The translation of the main source string.
-        std::wstring m_translation;
+        std::wstring_view m_translation;
         /// @brief The translation of the optional plural form of the source string.
-        std::wstring m_translation_plural;
+        std::wstring_view m_translation_plural;
+        /// @brief The comment for the translator to provide context for
+        ///     how to translate the string.
+        std::wstring_view m_comment;
+        /// @brief The position in the file.
+        size_t m_line{ std::wstring_view::npos };
         /// @brief The printf syntax used by the strings.\n
         ///     Only used for gettext PO files.
         po_format_string m_po_format{ po_format_string::no_format };
-        /// @brief Any issues detected in this entry.
-        std::vector<std::pair<translation_issue, std::wstring>> m_issues;
-        /// @brief The position in the file.
-        size_t m_line{ std::wstring_view::npos };
-        /// @brief The comment for the translator to provide context for
-        ///     how to translate the string.
-        std::wstring m_comment;
         };
 
     /// @brief Progress callback for analyze().
@@ -291,7 +305,10 @@ namespace i18n_check
     class i18n_review
         {
       public:
-        /// @brief Information about a string found in the source code.
+        /** @brief Information about a string found in the source code.
+            @details The text is stored by the reviewer that found the string,
+                so it is only valid until the reviewer's results are cleared.
+                Copy the text into a @c std::wstring if it needs to outlive that.*/
         struct string_info
             {
             /// @brief What the string is being used for.
@@ -311,28 +328,29 @@ namespace i18n_check
                 usage_info() = default;
 
                 /// @private
-                usage_info(const usage_type& type, std::wstring val, std::wstring varType)
-                    : m_type(type), m_value(std::move(val)), m_variableType(std::move(varType))
+                usage_info(const usage_type& type, std::wstring_view val,
+                           std::wstring_view varType)
+                    : m_type(type), m_value(val), m_variableType(varType)
                     {
                     }
 
                 /// @private
-                usage_info(const usage_type& type, std::wstring val, std::wstring varType,
-                           bool hasContext)
-                    : m_type(type), m_value(std::move(val)), m_variableType(std::move(varType)),
+                usage_info(const usage_type& type, std::wstring_view val,
+                           std::wstring_view varType, bool hasContext)
+                    : m_type(type), m_value(val), m_variableType(varType),
                       m_hasContext(hasContext)
                     {
                     }
 
                 /// @private
-                explicit usage_info(std::wstring val) : m_value(std::move(val)) {}
+                explicit usage_info(std::wstring_view val) : m_value(val) {}
 
                 /// @private
                 usage_type m_type{ usage_type::function };
                 /// @private
-                std::wstring m_value;
+                std::wstring_view m_value;
                 /// @private
-                std::wstring m_variableType;
+                std::wstring_view m_variableType;
                 /// @private
                 bool m_hasContext{ false };
                 };
@@ -340,57 +358,284 @@ namespace i18n_check
             /** @brief Constructor.
                 @param str The string value.
                 @param usage What the string is being used for.
-                @param fileName The filename.
+                @param fileId The file's ID (from the reviewer's file table).
                 @param lineAndColumn The line and column number.*/
-            string_info(std::wstring str, usage_info usage, std::filesystem::path fileName,
+            string_info(std::wstring_view str, usage_info usage, const file_id fileId,
                         const std::pair<size_t, size_t> lineAndColumn)
-                : m_string(std::move(str)), m_usage(std::move(usage)),
-                  m_file_name(std::move(fileName)), m_line(lineAndColumn.first),
-                  m_column(lineAndColumn.second)
+                : m_string(str), m_usage(std::move(usage)), m_file_id(fileId),
+                  m_line(lineAndColumn.first), m_column(lineAndColumn.second)
                 {
                 }
 
             /// @private
             string_info() = default;
             /// @brief The string value.
-            std::wstring m_string;
+            std::wstring_view m_string;
             /// @brief What the string is being used for.
             usage_info m_usage;
-            /// @brief The filename.
-            std::filesystem::path m_file_name;
+            /// @brief The file's ID.
+            /// @sa i18n_review::get_file_path().
+            file_id m_file_id{ file_table::npos };
             /// @brief The line number.
             size_t m_line{ 0 };
             /// @brief The column number.
             size_t m_column{ 0 };
             };
 
+        /// @brief Which messages are logged during a review.
+        enum class log_level : uint8_t
+            {
+            none,       /*!< Nothing is logged.*/
+            errors,     /*!< Parsing errors (e.g., a block that isn't closed).*/
+            diagnostics /*!< Parsing errors and information about how the parser
+                             handled the code (e.g., strings that it couldn't connect
+                             to a function or variable).*/
+            };
+
+        /// @brief The messages that can be logged during a review.
+        enum class parse_message_code : uint8_t
+            {
+            missing_space_before_closing_brace, /*!< A ';' directly followed by a '}'.*/
+            missing_asm_closing_parenthesis,    /*!< An asm block without a closing ')'.*/
+            missing_asm_closing_brace,          /*!< An __asm block without a closing '}'.*/
+            missing_template_opening_angle,     /*!< A template variable without an opening '<'.*/
+            exception,                          /*!< An exception (e.g., from the regex engine)
+                                                     while parsing. The message is the
+                                                     exception's text.*/
+            new_variable_type,                  /*!< A variable type that isn't known
+                                                     (debug builds only).*/
+            unknown_string_usage                /*!< A string that couldn't be connected to
+                                                     a function or variable.*/
+            };
+
         /// @brief Messages logged during a review.
+        /// @details Only the message's code is stored; its text is looked up when it is reported.
         struct parse_messages
             {
             /** @brief Constructor.
-                @param filename The filepath.
+                @param fileId The file's ID (from the reviewer's file table).
                 @param positionInFile The line and column position in the file.
+                @param code The message.
                 @param str The string resource.
-                @param message Diagnostic message.*/
-            parse_messages(std::filesystem::path filename,
-                           const std::pair<size_t, size_t> positionInFile, std::wstring str,
-                           std::wstring message)
-                : m_file_name(std::move(filename)), m_resourceString(std::move(str)),
-                  m_message(std::move(message)), m_line(positionInFile.first),
-                  m_column(positionInFile.second)
+                @param details The text of the message, if it isn't fixed (e.g., an exception's).*/
+            parse_messages(const file_id fileId, const std::pair<size_t, size_t> positionInFile,
+                           const parse_message_code code, const std::wstring_view str,
+                           const std::wstring_view details)
+                : m_file_id(fileId), m_resourceString(str), m_details(details),
+                  m_line(positionInFile.first), m_column(positionInFile.second), m_code(code)
                 {
                 }
 
-            /// @brief The filepath.
-            std::filesystem::path m_file_name;
+            /// @returns The diagnostic message.
+            [[nodiscard]]
+            std::wstring_view get_message() const noexcept
+                {
+                switch (m_code)
+                    {
+                case parse_message_code::missing_space_before_closing_brace:
+                    return L"Space or newline should be inserted between ';' and '}'.";
+                case parse_message_code::missing_asm_closing_parenthesis:
+                    return L"Missing closing ')' in asm block.";
+                case parse_message_code::missing_asm_closing_brace:
+                    return L"Missing closing '}' in __asm block.";
+                case parse_message_code::missing_template_opening_angle:
+                    return L"Unable to find opening < for template variable.";
+                case parse_message_code::new_variable_type:
+                    return L"New variable type detected.";
+                case parse_message_code::unknown_string_usage:
+                    return L"Unknown function or variable assignment for this string.";
+                case parse_message_code::exception:
+                    [[fallthrough]];
+                default:
+                    return m_details;
+                    }
+                }
+
+            /// @brief The file's ID.
+            /// @sa i18n_review::get_file_path().
+            file_id m_file_id{ file_table::npos };
             /// @brief The string resource.
-            std::wstring m_resourceString;
-            /// @brief Diagnostic message.
-            std::wstring m_message;
+            std::wstring_view m_resourceString;
+            /// @brief The text of the message, if it isn't fixed.
+            /// @sa get_message().
+            std::wstring_view m_details;
             /// @brief Line position in the file.
             size_t m_line{ std::wstring::npos };
             /// @brief Column position in the file.
             size_t m_column{ std::wstring::npos };
+            /// @brief The message.
+            parse_message_code m_code{ parse_message_code::exception };
+            };
+
+        /// @brief The lists that the reviewed strings are stored in.
+        enum class string_list : uint8_t
+            {
+            localizable,                    /*!< Strings set to be extracted as translatable.*/
+            marked_as_non_localizable,      /*!< Strings explicitly marked as untranslatable.*/
+            internal,                       /*!< Strings intentionally not translatable.*/
+            not_available_for_localization, /*!< Hard-coded strings.*/
+            localizable_in_internal_call,   /*!< Translatable strings in internal functions.*/
+            issue_only /*!< Strings that are only stored because of an issue found in them
+                            (e.g., untranslatable strings in a resource file's string table).*/
+            };
+
+        /// @brief The issues that are recorded against the reviewed strings
+        ///     (rather than storing another copy of the string for each issue).
+        enum class string_issue : uint8_t
+            {
+            unsafe_localizable,
+            unlocalizable_content,
+            url,
+            ambiguous_needing_context,
+            surrounding_spaces,
+            malformed,
+            unencoded_ext_ascii,
+            printf_single_number,
+            issue_count /*!< The number of issues (not an issue itself).*/
+            };
+
+        /// @brief Where a string that an issue was found in is stored.
+        struct string_reference
+            {
+            /// @brief The list that the string is in.
+            string_list m_list{ string_list::localizable };
+            /// @brief The string's index in the list.
+            uint32_t m_index{ 0 };
+            };
+
+        /// @brief A read-only list of the strings that an issue was found in.
+        /// @details This is returned by the getters for issues (e.g.,
+        ///     get_unsafe_localizable_strings()) and can be used like a
+        ///     @c std::vector<string_info>. It is only valid until the reviewer's
+        ///     results change.
+        class string_info_view
+            {
+          public:
+            /// @brief Iterator through the strings.
+            class const_iterator
+                {
+              public:
+                /// @private
+                using iterator_category = std::forward_iterator_tag;
+                /// @private
+                using value_type = string_info;
+                /// @private
+                using difference_type = std::ptrdiff_t;
+                /// @private
+                using pointer = const string_info*;
+                /// @private
+                using reference = const string_info&;
+
+                /// @private
+                const_iterator() = default;
+
+                /// @private
+                const_iterator(const string_info_view* view, const size_t position) noexcept
+                    : m_view(view), m_position(position)
+                    {
+                    }
+
+                /// @private
+                [[nodiscard]]
+                reference operator*() const
+                    {
+                    return (*m_view)[m_position];
+                    }
+
+                /// @private
+                [[nodiscard]]
+                pointer operator->() const
+                    {
+                    return &(*m_view)[m_position];
+                    }
+
+                /// @private
+                const_iterator& operator++() noexcept
+                    {
+                    ++m_position;
+                    return *this;
+                    }
+
+                /// @private
+                const_iterator operator++(int) noexcept
+                    {
+                    auto previous{ *this };
+                    ++m_position;
+                    return previous;
+                    }
+
+                /// @private
+                [[nodiscard]]
+                bool operator==(const const_iterator& that) const noexcept
+                    {
+                    return m_view == that.m_view && m_position == that.m_position;
+                    }
+
+              private:
+                const string_info_view* m_view{ nullptr };
+                size_t m_position{ 0 };
+                };
+
+            /// @private
+            string_info_view(const i18n_review& review,
+                             const std::vector<string_reference>& references) noexcept
+                : m_review(&review), m_references(&references)
+                {
+                }
+
+            /// @returns The number of strings.
+            [[nodiscard]]
+            size_t size() const noexcept
+                {
+                return m_references->size();
+                }
+
+            /// @returns @c true if there are no strings.
+            [[nodiscard]]
+            bool empty() const noexcept
+                {
+                return m_references->empty();
+                }
+
+            /// @returns The string at @c position.
+            /// @param position The index of the string.
+            [[nodiscard]]
+            const string_info& operator[](const size_t position) const
+                {
+                return m_review->get_string((*m_references)[position]);
+                }
+
+            /// @private
+            [[nodiscard]]
+            const_iterator begin() const noexcept
+                {
+                return const_iterator{ this, 0 };
+                }
+
+            /// @private
+            [[nodiscard]]
+            const_iterator end() const noexcept
+                {
+                return const_iterator{ this, size() };
+                }
+
+            /// @private
+            [[nodiscard]]
+            const_iterator cbegin() const noexcept
+                {
+                return begin();
+                }
+
+            /// @private
+            [[nodiscard]]
+            const_iterator cend() const noexcept
+                {
+                return end();
+                }
+
+          private:
+            const i18n_review* m_review{ nullptr };
+            const std::vector<string_reference>* m_references{ nullptr };
             };
 
         /// @brief Constructor.
@@ -403,14 +648,14 @@ namespace i18n_check
         /** @brief Adds a function to be considered as internal (e.g., debug functions).
             @details Strings passed to this function will not be considered translatable.
             @param func The function to ignore.*/
-        void add_function_to_ignore(const std::wstring& func) { m_internal_functions.insert(func); }
+        void add_function_to_ignore(const std::wstring& func) { m_internal_functions.add(func); }
 
         /** @brief Adds a function that loads hard-coded strings as translatable resources.
             @details This is usually functions like those found in the gettext library.
             @param func The function to consider as a resource-loading function.*/
         void add_translation_extraction_function(const std::wstring& func)
             {
-            m_localization_functions.insert(func);
+            m_localization_functions.add(func);
             }
 
         /** @brief Sets which checks are being performed.
@@ -498,9 +743,9 @@ namespace i18n_check
         /// @returns The strings that are being extracted as localizable,
         ///     but don't appear to be safe to actually translate.
         [[nodiscard]]
-        const std::vector<string_info>& get_unsafe_localizable_strings() const noexcept
+        string_info_view get_unsafe_localizable_strings() const noexcept
             {
-            return m_unsafe_localizable_strings;
+            return get_string_issues(string_issue::unsafe_localizable);
             }
 
         /// @returns Suspect usage of i18n functions.
@@ -513,52 +758,49 @@ namespace i18n_check
         /// @returns The strings that are being extracted as localizable,
         ///     but contain URLs or email addresses.
         [[nodiscard]]
-        const std::vector<string_info>& get_localizable_strings_with_urls() const noexcept
+        string_info_view get_localizable_strings_with_urls() const noexcept
             {
-            return m_localizable_strings_with_urls;
+            return get_string_issues(string_issue::url);
             }
 
         /// @returns The strings that are being extracted as localizable,
         ///     but contain large blocks of untranslatable content (e.g., HTML tags).
         [[nodiscard]]
-        const std::vector<string_info>&
-        get_localizable_strings_with_unlocalizable_content() const noexcept
+        string_info_view get_localizable_strings_with_unlocalizable_content() const noexcept
             {
-            return m_localizable_strings_with_unlocalizable_content;
+            return get_string_issues(string_issue::unlocalizable_content);
             }
 
         /// @returns The strings that are being extracted as localizable,
         ///     but are ambiguous and lack a translator comment.
         [[nodiscard]]
-        const std::vector<string_info>&
-        get_localizable_strings_ambiguous_needing_context() const noexcept
+        string_info_view get_localizable_strings_ambiguous_needing_context() const noexcept
             {
-            return m_localizable_strings_ambiguous_needing_context;
+            return get_string_issues(string_issue::ambiguous_needing_context);
             }
 
         /// @returns The strings that are being extracted as localizable,
         ///     but are surrounded by spaces.
         [[nodiscard]]
-        const std::vector<string_info>&
-        get_localizable_strings_with_surrounding_spaces() const noexcept
+        string_info_view get_localizable_strings_with_surrounding_spaces() const noexcept
             {
-            return m_localizable_strings_with_surrounding_spaces;
+            return get_string_issues(string_issue::surrounding_spaces);
             }
 
         /// @returns The strings that contain extended ASCII characters, but are not encoded.
         [[nodiscard]]
-        const std::vector<string_info>& get_unencoded_ext_ascii_strings() const noexcept
+        string_info_view get_unencoded_ext_ascii_strings() const noexcept
             {
-            return m_unencoded_strings;
+            return get_string_issues(string_issue::unencoded_ext_ascii);
             }
 
         /// @returns The strings that are a printf() command that only formats one number.\n
         ///     It is simpler to use std::to_string() variants to avoid potentially dangerous
         ///     printf() calls.
         [[nodiscard]]
-        const std::vector<string_info>& get_printf_single_numbers() const noexcept
+        string_info_view get_printf_single_numbers() const noexcept
             {
-            return m_printf_single_numbers;
+            return get_string_issues(string_issue::printf_single_number);
             }
 
         /// @returns IDs that are assigned a hard-coded numeric value.
@@ -577,9 +819,9 @@ namespace i18n_check
 
         /// @returns Malformed strings.
         [[nodiscard]]
-        const std::vector<string_info>& get_malformed_strings() const noexcept
+        string_info_view get_malformed_strings() const noexcept
             {
-            return m_malformed_strings;
+            return get_string_issues(string_issue::malformed);
             }
 
         /// @returns Lines with trailing spaces.
@@ -625,6 +867,27 @@ namespace i18n_check
         static void add_variable_name_pattern_to_ignore(const std::wregex& pattern)
             {
             m_variable_name_patterns_to_ignore.push_back(pattern);
+#ifdef QUNEIFORM_REGEX_PROFILING
+            add_variable_name_pattern_profile_name(
+                L"(compiled expression #" +
+                std::to_wstring(m_variable_name_patterns_to_ignore.size()) + L")");
+#endif
+            }
+
+        /** @brief Adds a regular expression pattern to determine if a variable should be
+                considered an internal string.
+            @param pattern The regex pattern's text.
+            @param flags The flags to construct the expression with.
+            @throws std::regex_error If @c pattern is not a valid expression.*/
+        static void add_variable_name_pattern_to_ignore(
+            std::wstring_view pattern,
+            const std::regex_constants::syntax_option_type flags = std::regex_constants::ECMAScript)
+            {
+            m_variable_name_patterns_to_ignore.emplace_back(pattern.cbegin(), pattern.cend(),
+                                                            flags);
+#ifdef QUNEIFORM_REGEX_PROFILING
+            add_variable_name_pattern_profile_name(std::wstring{ pattern });
+#endif
             }
 
         /// @returns The regex patterns compared against variables that have
@@ -635,6 +898,53 @@ namespace i18n_check
             return m_variable_name_patterns_to_ignore;
             }
 
+        /** @brief Adds a regular expression for strings that should be considered
+                untranslatable (in addition to the built-in ones).
+            @details Like the built-in patterns, the whole string must match the expression.
+                For example, "PRJ-[0-9]+" would treat ticket numbers like "PRJ-1234"
+                as internal strings.
+            @param pattern The regex pattern to compare against the strings.
+            @param flags The flags to construct the expression with.
+            @throws std::regex_error If @c pattern is not a valid expression.*/
+        static void add_untranslatable_pattern(
+            std::wstring_view pattern,
+            const std::regex_constants::syntax_option_type flags = std::regex_constants::ECMAScript)
+            {
+            m_untranslatable_patterns.add(pattern, flags);
+            }
+
+        /// @returns How long it took to build the built-in rule tables (i.e., the
+        ///     regular expressions and function/keyword lookups shared by all reviewers).
+        /// @note The tables are built upon the first reviewer's construction, so calling
+        ///     this will build them if that hasn't already happened.
+        [[nodiscard]]
+        static std::chrono::milliseconds get_rule_tables_build_time()
+            {
+            return get_rule_tables().m_build_time;
+            }
+
+        /// @returns How often the rule expressions (the untranslatable string patterns and
+        ///     every other regex_pattern) were skipped by their prefilters
+        ///     (rather than being run), across all reviewers.
+        [[nodiscard]]
+        static regex_pattern::match_statistics get_regex_prefilter_statistics()
+            {
+            auto statistics{ get_rule_tables().m_translatable_regexes.get_statistics() };
+            statistics += get_rule_tables().m_untranslatable_regexes.get_statistics();
+            statistics += m_untranslatable_patterns.get_statistics();
+            statistics += regex_pattern::get_statistics();
+            return statistics;
+            }
+
+        /// @brief Resets the counters returned by get_regex_prefilter_statistics().
+        static void reset_regex_prefilter_statistics()
+            {
+            get_rule_tables().m_translatable_regexes.reset_statistics();
+            get_rule_tables().m_untranslatable_regexes.reset_statistics();
+            m_untranslatable_patterns.reset_statistics();
+            regex_pattern::reset_statistics();
+            }
+
         /** @brief Adds a variable type to ignore.
             @details Any variables that are constructed in place with these types
                 will have their string values marked as internal.
@@ -663,7 +973,40 @@ namespace i18n_check
         /** @brief Clears all results from the previous parsing.
             @note This does not reset functions and variable patterns that you have added
                 to the parser; it will only reset the results from the last parsing operation.*/
-        void clear_results() noexcept;
+        virtual void clear_results() noexcept;
+        /** @returns An estimate of the memory (in bytes) used by the current results.
+            @details This includes the results and the text stored for them, but not
+                any (retained) file text that the results refer to.\n
+                The error log and the table of file paths are not included either,
+                as they aren't cleared by clear_results() (so writing the results
+                elsewhere wouldn't reduce them). The error log can be bounded with
+                set_error_log_limit(), and the file table only holds one path per file.*/
+        [[nodiscard]]
+        virtual size_t get_results_memory_usage() const noexcept;
+
+        /// @returns The path of a file that results are connected to.
+        /// @param id The file ID from a result (e.g., string_info::m_file_id).
+        [[nodiscard]]
+        const std::filesystem::path& get_file_path(const file_id id) const noexcept
+            {
+            return m_file_table.get_path(id);
+            }
+
+        /// @returns The strings that an issue was found in.
+        /// @param issue The issue.
+        [[nodiscard]]
+        string_info_view get_string_issues(const string_issue issue) const noexcept
+            {
+            return string_info_view{ *this, m_string_issues[static_cast<size_t>(issue)] };
+            }
+
+        /// @returns A stored string.
+        /// @param reference Which list the string is in and its index in that list.
+        [[nodiscard]]
+        const string_info& get_string(const string_reference& reference) const
+            {
+            return get_string_list(reference.m_list)[reference.m_index];
+            }
 
         /// @returns A list of errors (usually the regex engine having issues parsing something)
         ///     encountered while parsing the file.
@@ -673,6 +1016,52 @@ namespace i18n_check
             return m_error_log;
             }
 
+        /// @returns The number of messages that weren't logged because
+        ///     the error log was full.
+        /// @sa set_error_log_limit().
+        [[nodiscard]]
+        size_t get_dropped_error_log_count() const noexcept
+            {
+            return m_dropped_error_log_count;
+            }
+
+        /** @brief Clears the error log.
+            @note Unlike the other results, the error log is not cleared by clear_results().*/
+        void clear_error_log() noexcept
+            {
+            m_error_log.clear();
+            m_error_log_text.release();
+            m_dropped_error_log_count = 0;
+            }
+
+        /** @brief Sets which messages are logged.
+            @details The default is log_level::errors, or log_level::diagnostics
+                if the reviewer is verbose.
+            @param level The messages to log.*/
+        void set_log_level(const log_level level) noexcept { m_log_level = level; }
+
+        /// @returns Which messages are logged.
+        [[nodiscard]]
+        log_level get_log_level() const noexcept
+            {
+            return m_log_level;
+            }
+
+        /** @brief Sets the maximum number of messages that the error log will hold.
+            @details After that, messages are only counted.
+                The default is @c 0 (no limit).
+            @param limit The maximum number of messages.
+            @sa get_dropped_error_log_count().*/
+        void set_error_log_limit(const size_t limit) noexcept { m_error_log_limit = limit; }
+
+        /// @returns The maximum number of messages that the error log will hold
+        ///     (@c 0 being no limit).
+        [[nodiscard]]
+        size_t get_error_log_limit() const noexcept
+            {
+            return m_error_log_limit;
+            }
+
         /// @returns Whether to consider punctuation-only strings as being safe to translate.
         [[nodiscard]]
         bool is_allowing_translating_punctuation_only_strings() const noexcept
@@ -722,6 +1111,27 @@ namespace i18n_check
             m_log_messages_are_translatable = allow;
             }
 
+        /// @returns Whether the text sent to operator() stays valid until the results
+        ///     are cleared.
+        [[nodiscard]]
+        bool is_file_text_retained() const noexcept
+            {
+            return m_file_text_retained;
+            }
+
+        /** @brief Set whether the text sent to operator() stays valid (and unchanged)
+                until clear_results() is called.
+            @details If it does, then strings in the results refer to that text,
+                rather than each one being copied. A string is only copied if the reviewer
+                changes it (e.g., combining a string that spans multiple lines).
+
+                The default is @c false.
+            @param retained @c true if the caller keeps the files' text for the whole run.*/
+        void set_file_text_retained(const bool retained) noexcept
+            {
+            m_file_text_retained = retained;
+            }
+
         /// @returns The minimum number of words that a string must have to be
         ///     considered translatable.
         [[nodiscard]]
@@ -765,32 +1175,26 @@ namespace i18n_check
 
         /** @brief Adds a font face to be ignored if found as a string.
             @param str The font face name.*/
-        static void add_font_name_to_ignore(const string_util::case_insensitive_wstring& str)
-            {
-            m_font_names.insert(str);
-            }
+        static void add_font_name_to_ignore(std::wstring_view str) { m_font_names.add(str); }
 
         /** @brief Adds a file extension to be ignored if found as a string.
             @param str The font face name.*/
-        static void add_file_extension_to_ignore(const string_util::case_insensitive_wstring& str)
+        static void add_file_extension_to_ignore(std::wstring_view str)
             {
-            m_file_extensions.insert(str);
+            m_file_extensions.add(str);
             }
 
-        /// @returns @c true if string is a known font face name.
+        /// @returns @c true if string is a known font face name (ignoring case).
         /// @param str The string to review.
         [[nodiscard]]
-        static bool is_font_name(const string_util::case_insensitive_wstring& str)
-            {
-            return m_font_names.find(str) != m_font_names.cend();
-            }
+        static bool is_font_name(std::wstring_view str) { return m_font_names.contains(str); }
 
-        /// @returns @c true if string is a known file extension.
+        /// @returns @c true if string is a known file extension (ignoring case).
         /// @param str The string to review.
         [[nodiscard]]
-        static bool is_file_extension(const string_util::case_insensitive_wstring& str)
+        static bool is_file_extension(std::wstring_view str)
             {
-            return m_file_extensions.find(str) != m_file_extensions.cend();
+            return m_file_extensions.contains(str);
             }
 
         /** @brief Loads all `printf` format commands from a string.
@@ -832,6 +1236,34 @@ namespace i18n_check
         static std::tuple<bool, std::wstring, size_t, size_t>
         read_po_msg(std::wstring_view& poCatalogEntry, const std::wstring_view msgTag);
 
+        /** @brief Finds the end of a (possibly multiline) message in a gettext catalog entry.
+            @param poMsg The text of the message, starting after its opening quote.
+            @returns The position of the message's closing quote, or @c npos if not found.*/
+        [[nodiscard]]
+        static size_t find_po_msg_end(std::wstring_view poMsg);
+
+        /** @brief Converts a (possibly multiline) message from a gettext catalog entry
+                into a single string.
+            @param msg The message's text, from find_po_msg_end().
+            @returns The message, with its continuation lines joined.*/
+        [[nodiscard]]
+        static std::wstring process_po_msg(std::wstring_view msg)
+            {
+            std::wstring msgId{ msg };
+
+            if (msgId.length() > 0 && msgId.front() == L'"')
+                {
+                msgId.erase(0, 1);
+                }
+
+            string_util::replace_all<std::wstring>(msgId, L"\"\r\n\"", L"");
+            string_util::replace_all<std::wstring>(msgId, L"\r\n\"", L"");
+            string_util::replace_all<std::wstring>(msgId, L"\"\n\"", L"");
+            string_util::replace_all<std::wstring>(msgId, L"\n\"", L"");
+
+            return msgId;
+            }
+
         /** @brief Loads all `printf` format commands from a string.
             @param resource The string to parse.
             @param[out] errorInfo Information about any bad printf commands\n
@@ -955,14 +1387,31 @@ namespace i18n_check
         [[nodiscard]]
         std::wstring_view extract_base_function(std::wstring_view str) const;
 
+        /// @returns @c true if a function (or just its name, without its class or namespace)
+        ///     is in a table of functions.
+        /// @param functions The functions to search.
+        /// @param functionName The function name to review.
+        [[nodiscard]]
+        bool contains_function(const extendable_name_table& functions,
+                               std::wstring_view functionName) const
+            {
+            if (functions.contains(functionName))
+                {
+                return true;
+                }
+            // the base function is the end of the full name, so it's only worth
+            // looking up if it's shorter
+            const std::wstring_view baseFunction{ extract_base_function(functionName) };
+            return baseFunction.length() < functionName.length() &&
+                   functions.contains(baseFunction);
+            }
+
         /// @returns @c true if a function name is a translation extraction function.
         /// @param functionName The function name to review.
         [[nodiscard]]
         bool is_i18n_function(std::wstring_view functionName) const
             {
-            return m_localization_functions.find(functionName) != m_localization_functions.cend() ||
-                   m_localization_functions.find(extract_base_function(functionName)) !=
-                       m_localization_functions.cend();
+            return contains_function(m_localization_functions, functionName);
             }
 
         /// @returns @c true if a function name is a translation extraction function that takes an
@@ -972,10 +1421,7 @@ namespace i18n_check
         [[nodiscard]]
         bool is_i18n_with_context_function(std::wstring_view functionName) const
             {
-            return m_localization_with_context_functions.find(functionName) !=
-                       m_localization_with_context_functions.cend() ||
-                   m_localization_with_context_functions.find(extract_base_function(
-                       functionName)) != m_localization_with_context_functions.cend();
+            return contains_function(m_localization_with_context_functions, functionName);
             }
 
         /// @returns @c true if a function name is a translation noop function.
@@ -983,10 +1429,7 @@ namespace i18n_check
         [[nodiscard]]
         bool is_non_i18n_function(std::wstring_view functionName) const
             {
-            return m_non_localizable_functions.find(functionName) !=
-                       m_non_localizable_functions.cend() ||
-                   m_non_localizable_functions.find(extract_base_function(functionName)) !=
-                       m_non_localizable_functions.cend();
+            return contains_function(m_non_localizable_functions, functionName);
             }
 
         /// @returns @c true if a string is a keyword.
@@ -996,36 +1439,139 @@ namespace i18n_check
         [[nodiscard]]
         bool is_keyword(std::wstring_view str) const
             {
-            return m_keywords.find(str) != m_keywords.cend();
+            return m_keywords.contains(str);
+            }
+
+        /// @returns One of the lists of reviewed strings.
+        /// @param list The list to return.
+        [[nodiscard]]
+        const std::vector<string_info>& get_string_list(const string_list list) const noexcept
+            {
+            switch (list)
+                {
+            case string_list::marked_as_non_localizable:
+                return m_marked_as_non_localizable_strings;
+            case string_list::internal:
+                return m_internal_strings;
+            case string_list::not_available_for_localization:
+                return m_not_available_for_localization_strings;
+            case string_list::localizable_in_internal_call:
+                return m_localizable_strings_in_internal_call;
+            case string_list::issue_only:
+                return m_issue_only_strings;
+            case string_list::localizable:
+                [[fallthrough]];
+            default:
+                return m_localizable_strings;
+                }
+            }
+
+        /// @returns A reference to the last string added to a list.
+        /// @param list The list that the string was added to.
+        [[nodiscard]]
+        string_reference get_last_string_reference(const string_list list) const noexcept
+            {
+            return string_reference{ list,
+                                     static_cast<uint32_t>(get_string_list(list).size() - 1) };
+            }
+
+        /** @returns A view of @c text that will be valid until the results are cleared.
+            @details If @c text is from the file being reviewed (and the file's text
+                is retained), then this is a view into the file's text.
+                Otherwise, @c text is copied into the reviewer's string storage.
+            @param text The text to store.*/
+        [[nodiscard]]
+        std::wstring_view store_string(std::wstring_view text);
+
+        /** @brief Adds a string to a list of results, storing its text
+                so that it is valid for as long as the results are.
+            @param strings The list to add the string to.
+            @param str The string. Its text only needs to be valid during this call.*/
+        void add_string(std::vector<string_info>& strings, string_info str)
+            {
+            str.m_string = store_string(str.m_string);
+            str.m_usage.m_value = m_string_arena.store(str.m_usage.m_value);
+            str.m_usage.m_variableType = m_string_arena.store(str.m_usage.m_variableType);
+            strings.push_back(str);
+            }
+
+        /** @brief Adds a string to a list of results, storing its text
+                so that it is valid for as long as the results are.
+            @param strings The list to add the string to.
+            @param str The string value.
+            @param usage What the string is being used for.
+            @param fileId The file's ID.
+            @param lineAndColumn The line and column number.
+            @note The text only needs to be valid during this call.*/
+        void add_string(std::vector<string_info>& strings, std::wstring_view str,
+                        string_info::usage_info usage, const file_id fileId,
+                        const std::pair<size_t, size_t> lineAndColumn)
+            {
+            add_string(strings, string_info{ str, std::move(usage), fileId, lineAndColumn });
+            }
+
+        /** @brief Records an issue found in a string that is already stored.
+            @param issue The issue.
+            @param reference Where the string is stored.*/
+        void add_string_issue(const string_issue issue, const string_reference reference)
+            {
+            m_string_issues[static_cast<size_t>(issue)].push_back(reference);
+            }
+
+        /** @brief Stores a string that is only of interest because of an issue found in it,
+                and records the issue.
+            @param issue The issue.
+            @param str The string.
+            @returns Where the string was stored (so that other issues can refer to it).*/
+        string_reference add_string_issue(const string_issue issue, string_info str)
+            {
+            add_string(m_issue_only_strings, std::move(str));
+            const auto reference{ get_last_string_reference(string_list::issue_only) };
+            add_string_issue(issue, reference);
+            return reference;
             }
 
         /** @brief Logs a debug message.
+            @details Nothing is done if the log level doesn't include the message,
+                and the message is only counted if the log is full.
+            @param code The message.
             @param info Information, such as a string causing a parsing error.
-            @param message An informational message.
-            @param positionInFile The position in the file.*/
-        void log_message(const std::wstring& info, const std::wstring& message,
-                         const size_t positionInFile) const
+            @param positionInFile The position in the file.
+            @param details The text of the message, if it isn't fixed (e.g., an exception's).*/
+        void log_message(const parse_message_code code, std::wstring_view info,
+                         const size_t positionInFile, std::wstring_view details = {}) const
             {
-            m_error_log.push_back(
-                parse_messages(m_file_name, get_line_and_column(positionInFile), info, message));
+            const log_level level{ (code == parse_message_code::new_variable_type ||
+                                    code == parse_message_code::unknown_string_usage) ?
+                                       log_level::diagnostics :
+                                       log_level::errors };
+            if (m_log_level < level)
+                {
+                return;
+                }
+            if (m_error_log_limit > 0 && m_error_log.size() >= m_error_log_limit)
+                {
+                ++m_dropped_error_log_count;
+                return;
+                }
+            m_error_log.push_back(parse_messages(m_file_id, get_line_and_column(positionInFile),
+                                                 code, m_error_log_text.store(info),
+                                                 m_error_log_text.store(details)));
             }
 
         /** @brief Loads ID assignments in the text to see if there are
                 hard-coded numbers or duplicated assignments.
             @param fileText The source file's text to analyze.
-            @param fileName The file name being analyzed.*/
-        void load_id_assignments(const std::wstring_view fileText,
-                                 const std::filesystem::path& fileName);
+            @param fileId The ID of the file being analyzed.*/
+        void load_id_assignments(const std::wstring_view fileText, const file_id fileId);
         /** @brief Loads any deprecated functions found in the text.
             @param fileText The source file's text to analyze.
-            @param fileName The file name being analyzed.*/
-        void load_deprecated_functions(const std::wstring_view fileText,
-                                       const std::filesystem::path& fileName);
+            @param fileId The ID of the file being analyzed.*/
+        void load_deprecated_functions(const std::wstring_view fileText, const file_id fileId);
         /** @brief Loads any i18n functions being misused.
             @param fileText The source file's text to analyze.
-            @param fileName The file name being analyzed.*/
-        void load_suspect_i18n_ussage(const std::wstring_view fileText,
-                                      const std::filesystem::path& fileName);
+            @param fileId The ID of the file being analyzed.*/
+        void load_suspect_i18n_ussage(const std::wstring_view fileText, const file_id fileId);
 #ifdef __UNITTEST
       public:
 #endif
@@ -1133,6 +1679,8 @@ namespace i18n_check
         /// @param position The character position in the file.
         /// @param fileStart The start of a file buffer to begin the search from.\n
         ///     If an empty view, will use the currently loaded file.
+        /// @note The buffer's line offsets are indexed on the first call
+        ///     (and reused until a different buffer is passed in).
         [[nodiscard]]
         std::pair<size_t, size_t>
         get_line_and_column(size_t position,
@@ -1151,6 +1699,11 @@ namespace i18n_check
         void run_diagnostics();
 
         const wchar_t* m_file_start{ nullptr };
+        // the (retained) text that was sent to operator(), which the text
+        // at m_file_start may be a working copy of
+        std::wstring_view m_retained_file_text;
+        // the line offsets of the buffer that positions were last looked up in
+        mutable line_index m_line_index;
 
         bool m_collapse_double_quotes{ false };
         bool m_allow_translating_punctuation_only_strings{ false };
@@ -1171,105 +1724,144 @@ namespace i18n_check
 
         bool m_verbose{ false };
 
+        /// @brief The built-in rule tables (functions, keywords, deprecated macros,
+        ///     untranslatable string patterns, and the other expressions used by the reviews).
+        /// @details Compiling the regular expressions is expensive, so these are built
+        ///     once (upon first use) and shared by all reviewers. Reviewers refer to the
+        ///     function and keyword tables (rather than copying them) and keep what
+        ///     clients add to those separately, per instance.
+        struct rule_tables
+            {
+            rule_tables();
+
+            name_table m_localization_functions;
+            name_table m_localization_with_context_functions;
+            name_table m_non_localizable_functions;
+            name_table m_internal_functions;
+            name_table m_log_functions;
+            name_table m_exceptions;
+            name_table m_ctors_to_ignore;
+            case_insensitive_name_set m_known_internal_strings;
+            name_table m_keywords;
+            std::map<std::wstring_view, std::wstring> m_deprecated_string_macros;
+            std::map<std::wstring_view, std::wstring> m_deprecated_string_functions;
+            regex_set m_untranslatable_regexes;
+            regex_set m_translatable_regexes;
+
+            // expressions used while reviewing each string or file
+            // (these should never be constructed inside of those loops)
+            regex_pattern m_printf_int_macro_regex;
+            regex_pattern m_debug_define_regex;
+            regex_pattern m_debug_level_regex;
+            regex_pattern m_release_define_regex;
+            regex_pattern m_single_int_printf_regex;
+            regex_pattern m_single_float_printf_regex;
+            regex_pattern m_load_string_regex;
+            regex_pattern m_html_break_regex;
+            regex_pattern m_html_script_regex;
+            regex_pattern m_html_style_regex;
+            regex_pattern m_html_tag_regex;
+            regex_pattern m_html_entity_regex;
+            regex_pattern m_html_numeric_entity_regex;
+            regex_pattern m_punctuation_only_regex;
+            regex_pattern m_multiline_string_regex;
+            regex_pattern m_number_regex;
+            regex_pattern m_number_separators_regex;
+            regex_pattern m_positional_number_regex;
+            std::chrono::milliseconds m_build_time{ 0 };
+            };
+
+        /// @returns The shared rule tables, building them if necessary.
+        [[nodiscard]]
+        static const rule_tables& get_rule_tables();
+
         // once these are set (by our CTOR and/or by client), they shouldn't be reset
-        std::set<std::wstring_view> m_localization_functions;
-        std::set<std::wstring_view> m_localization_with_context_functions;
-        std::set<std::wstring_view> m_non_localizable_functions;
-        std::set<std::wstring_view> m_internal_functions;
-        std::set<std::wstring_view> m_log_functions;
-        std::set<std::wstring_view> m_exceptions;
-        std::set<std::wstring_view> m_ctors_to_ignore;
-        std::set<string_util::case_insensitive_wstring> m_known_internal_strings;
-        std::set<std::wstring_view> m_keywords;
+        // (these refer to the shared built-in tables, plus what the client added)
+        extendable_name_table m_localization_functions;
+        extendable_name_table m_localization_with_context_functions;
+        extendable_name_table m_non_localizable_functions;
+        extendable_name_table m_internal_functions;
+        extendable_name_table m_log_functions;
+        extendable_name_table m_exceptions;
+        extendable_name_table m_ctors_to_ignore;
+        extendable_name_table m_keywords;
         std::map<std::wstring_view, std::wstring> m_deprecated_string_macros;
         std::map<std::wstring_view, std::wstring> m_deprecated_string_functions;
         // These have built-in values, but can be added to by the client also.
         // These are static so that client's additions can propagate to other instances.
         static std::vector<std::wregex> m_variable_name_patterns_to_ignore;
+#ifdef QUNEIFORM_REGEX_PROFILING
+        // names that the variable patterns are profiled under (kept in sync
+        // with the patterns, as clients may clear those)
+        static void add_variable_name_pattern_profile_name(std::wstring pattern)
+            {
+            m_variable_name_pattern_profile_names.resize(
+                m_variable_name_patterns_to_ignore.size() - 1);
+            m_variable_name_pattern_profile_names.push_back(L"variable name: " + pattern);
+            }
+
+        [[nodiscard]]
+        static std::wstring_view get_variable_name_pattern_profile_name(const size_t index)
+            {
+            return (index < m_variable_name_pattern_profile_names.size()) ?
+                       std::wstring_view{ m_variable_name_pattern_profile_names[index] } :
+                       std::wstring_view{ L"variable name" };
+            }
+
+        static std::vector<std::wstring> m_variable_name_pattern_profile_names;
+#endif
         static std::set<std::wstring> m_variable_types_to_ignore;
-        static std::set<string_util::case_insensitive_wstring> m_font_names;
-        static std::set<string_util::case_insensitive_wstring> m_file_extensions;
+        static case_insensitive_name_set m_font_names;
+        static case_insensitive_name_set m_file_extensions;
         static std::set<std::wstring> m_untranslatable_exceptions;
+        static regex_set m_untranslatable_patterns;
         // results after parsing what the client should maybe review
         std::vector<string_info> m_localizable_strings;
         std::vector<string_info> m_marked_as_non_localizable_strings;
         std::vector<string_info> m_internal_strings;
         // results that are probably issues
-        std::vector<string_info> m_unsafe_localizable_strings;
-        std::vector<string_info> m_localizable_strings_with_unlocalizable_content;
-        std::vector<string_info> m_localizable_strings_with_urls;
-        std::vector<string_info> m_localizable_strings_ambiguous_needing_context;
         std::vector<string_info> m_localizable_strings_in_internal_call;
-        std::vector<string_info> m_localizable_strings_with_surrounding_spaces;
         std::vector<string_info> m_not_available_for_localization_strings;
+        std::vector<string_info> m_issue_only_strings;
+        // issues found in the above strings, which refer to them rather than copying them
+        std::array<std::vector<string_reference>, static_cast<size_t>(string_issue::issue_count)>
+            m_string_issues;
         std::vector<string_info> m_deprecated_macros;
-        std::vector<string_info> m_unencoded_strings;
-        std::vector<string_info> m_printf_single_numbers;
         std::vector<string_info> m_ids_assigned_number;
         std::vector<string_info> m_duplicates_value_assigned_to_ids;
-        std::vector<string_info> m_malformed_strings;
         std::vector<string_info> m_trailing_spaces;
         std::vector<string_info> m_tabs;
         std::vector<string_info> m_wide_lines;
         std::vector<string_info> m_comments_missing_space;
         std::vector<string_info> m_suspect_i18n_usage;
+        // the text of the above results, which is freed all at once when they are cleared
+        string_arena m_string_arena;
 
         bool m_context_comment_active{ false };
-
-        std::filesystem::path m_file_name;
-
-        static const std::wregex m_url_email_regex;
-        static const std::wregex m_us_phone_number_regex;
-        static const std::wregex m_non_us_phone_number_regex;
-        static const std::wregex m_html_regex;
-        static const std::wregex m_html_element_with_content_regex;
-        static const std::wregex m_html_tag_regex;
-        static const std::wregex m_html_tag_unicode_regex;
-        static const std::wregex m_xml_element_regex;
-        static const std::wregex m_not_xml_element_regex;
-        static const std::wregex m_html_known_elements_regex;
-        static const std::wregex m_angle_braced_one_word_regex;
-        static const std::wregex m_2letter_regex;
-        static const std::wregex m_1word_regex;
-        static const std::wregex m_keyboard_accelerator_regex;
-        static const std::wregex m_hashtag_regex;
-        static const std::wregex m_key_shortcut_regex;
-        static const std::wregex m_function_signature_regex;
-        static const std::wregex m_plural_regex;
-        static const std::wregex m_open_function_signature_regex;
-        static const std::wregex m_diagnostic_function_regex;
-        static const std::wregex m_id_assignment_regex;
-        static const std::wregex m_sql_code;
-        static const std::wregex m_malformed_html_tag;
-        static const std::wregex m_malformed_html_tag_bad_amp;
-        static const std::wregex m_printf_cpp_int_regex;
-        static const std::wregex m_printf_cpp_float_regex;
-        static const std::wregex m_printf_cpp_string_regex;
-        static const std::wregex m_printf_cpp_pointer_regex;
-        static const std::wregex m_positional_command_regex;
-        static const std::wregex m_file_filter_regex;
-        std::vector<std::wregex> m_untranslatable_regexes;
-        std::vector<std::wregex> m_translatable_regexes;
+        bool m_file_text_retained{ false };
+
+        // the files that results are connected to (kept for the reviewer's lifetime,
+        // as the error log isn't cleared between runs), and the file being reviewed
+        file_table m_file_table;
+        file_id m_file_id{ file_table::npos };
+
+        static const regex_pattern m_url_email_regex;
+        static const regex_pattern m_us_phone_number_regex;
+        static const regex_pattern m_non_us_phone_number_regex;
+        static const regex_pattern m_xml_element_regex;
+        static const regex_pattern m_not_xml_element_regex;
+        static const regex_pattern m_html_known_elements_regex;
+        static const regex_pattern m_angle_braced_one_word_regex;
+        static const regex_pattern m_2letter_regex;
+        static const regex_pattern m_1word_regex;
+        static const regex_pattern m_keyboard_accelerator_regex;
+        static const regex_pattern m_diagnostic_function_regex;
+        static const regex_pattern m_malformed_html_tag;
+        static const regex_pattern m_malformed_html_tag_bad_amp;
+        static const regex_pattern m_positional_command_regex;
+        static const regex_pattern m_file_filter_regex;
 
       private:
-        [[nodiscard]]
-        static std::wstring process_po_msg(std::wstring_view msg)
-            {
-            std::wstring msgId{ msg };
-
-            if (msgId.length() > 0 && msgId.front() == L'"')
-                {
-                msgId.erase(0, 1);
-                }
-
-            string_util::replace_all<std::wstring>(msgId, L"\"\r\n\"", L"");
-            string_util::replace_all<std::wstring>(msgId, L"\r\n\"", L"");
-            string_util::replace_all<std::wstring>(msgId, L"\"\n\"", L"");
-            string_util::replace_all<std::wstring>(msgId, L"\n\"", L"");
-
-            return msgId;
-            }
-
         [[nodiscard]]
         static std::vector<std::wstring>
         convert_positional_cpp_printf(const std::vector<std::wstring>& printfCommands,
@@ -1277,10 +1869,15 @@ namespace i18n_check
 
         // helpers
         mutable std::vector<parse_messages> m_error_log;
+        // the strings in the error log (which is kept until clear_error_log() is called)
+        mutable string_arena m_error_log_text;
+        mutable size_t m_dropped_error_log_count{ 0 };
+        size_t m_error_log_limit{ 0 };
+        log_level m_log_level{ log_level::errors };
 
         // bookkeeping diagnostics
 #ifndef NDEBUG
-        mutable std::pair<std::wstring, std::wregex> m_longest_internal_string;
+        mutable std::pair<std::wstring, regex_pattern> m_longest_internal_string;
 #endif
         };
     } // namespace i18n_check
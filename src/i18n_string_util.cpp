@@ -12,6 +12,9 @@
  ********************************************************************************/
 
 #include "i18n_string_util.h"
+#include "utfcpp/source/utf8.h"
+#include <cstdint>
+#include <iterator>
 
 namespace i18n_string_util
     {
@@ -370,4 +373,36 @@ namespace i18n_string_util
             ++i;
             }
         }
+
+    //--------------------------------------------------
+    std::string to_utf8(std::wstring_view text)
+        {
+        std::string utf8Str;
+        utf8Str.reserve(text.length());
+        if constexpr (sizeof(wchar_t) == sizeof(uint16_t))
+            {
+            utf8::utf16to8(text.cbegin(), text.cend(), std::back_inserter(utf8Str));
+            }
+        else if constexpr (sizeof(wchar_t) == sizeof(uint32_t))
+            {
+            utf8::utf32to8(text.cbegin(), text.cend(), std::back_inserter(utf8Str));
+            }
+        return utf8Str;
+        }
+
+    //--------------------------------------------------
+    std::wstring from_utf8(std::string_view text)
+        {
+        std::wstring wideStr;
+        wideStr.reserve(text.length());
+        if constexpr (sizeof(wchar_t) == sizeof(uint16_t))
+            {
+            utf8::utf8to16(text.cbegin(), text.cend(), std::back_inserter(wideStr));
+            }
+        else if constexpr (sizeof(wchar_t) == sizeof(uint32_t))
+            {
+            utf8::utf8to32(text.cbegin(), text.cend(), std::back_inserter(wideStr));
+            }
+        return wideStr;
+        }
     } // namespace i18n_string_util
@@ -74,12 +74,12 @@ namespace i18n_string_util
     [[nodiscard]]
     constexpr static bool is_apostrophe(const wchar_t ch) noexcept
         {
-        // clang-format off
-        return (ch == L'\'') ?       // '
-            true : (ch == 146) ?    // apostrophe
-            true : (ch == 180) ?    // apostrophe
-            true : (ch == 0xFF07) ? // full-width apostrophe
-            true : (ch == 0x2019) ? // right single apostrophe
+        // clang-format off
+        return (ch == L'\'') ?       // '
+            true : (ch == 146) ?    // apostrophe
+            true : (ch == 180) ?    // apostrophe
+            true : (ch == 0xFF07) ? // full-width apostrophe
+            true : (ch == 0x2019) ? // right single apostrophe
             true : false;
         // clang-format on
         }
@@ -89,15 +89,15 @@ namespace i18n_string_util
     [[nodiscard]]
     constexpr static bool is_period(const wchar_t ch) noexcept
         {
-        // clang-format off
-        return (ch == L'.') ?       // .
-            true : (ch == 0x2024) ? // one dot leader
-            true : (ch == 0x3002) ? // Japanese full stop
-            true : (ch == 0xFF61) ? // halfwidth full stop
-            true : (ch == 0xFF0E) ? // fullwidth full stop
-            true : (ch == 0xFE12) ? // vertical full stop
-            true : (ch == 0x06D4) ? // Arabic full stop
-            true : (ch == 0x2026) ? // ellipsis
+        // clang-format off
+        return (ch == L'.') ?       // .
+            true : (ch == 0x2024) ? // one dot leader
+            true : (ch == 0x3002) ? // Japanese full stop
+            true : (ch == 0xFF61) ? // halfwidth full stop
+            true : (ch == 0xFF0E) ? // fullwidth full stop
+            true : (ch == 0xFE12) ? // vertical full stop
+            true : (ch == 0x06D4) ? // Arabic full stop
+            true : (ch == 0x2026) ? // ellipsis
             true : false;
         // clang-format on
         }
@@ -107,14 +107,14 @@ namespace i18n_string_util
     [[nodiscard]]
     constexpr static bool is_exclamation(const wchar_t ch) noexcept
         {
-        // clang-format off
-        return (ch == L'!') ?       // !
-            true : (ch == 0xFE15) ? // presentation
-            true : (ch == 0xFE57) ? // small
-            true : (ch == 0x00A1) ? // inverted
-            true : (ch == 0xFF01) ? // fullwidth
-            true : (ch == 0xFE57) ? // small
-            true : (ch == 0xFE15) ? // presentation
+        // clang-format off
+        return (ch == L'!') ?       // !
+            true : (ch == 0xFE15) ? // presentation
+            true : (ch == 0xFE57) ? // small
+            true : (ch == 0x00A1) ? // inverted
+            true : (ch == 0xFF01) ? // fullwidth
+            true : (ch == 0xFE57) ? // small
+            true : (ch == 0xFE15) ? // presentation
             true : false;
         // clang-format on
         }
@@ -124,10 +124,10 @@ namespace i18n_string_util
     [[nodiscard]]
     constexpr static bool is_question(const wchar_t ch) noexcept
         {
-        // clang-format off
-        return (ch == L'?') ?       // !
-            true : (ch == 0x061F) ? // Arabic
-            true : (ch == 0xFF1F) ? // fullwidth
+        // clang-format off
+        return (ch == L'?') ?       // !
+            true : (ch == 0x061F) ? // Arabic
+            true : (ch == 0xFF1F) ? // fullwidth
             true : false;
         // clang-format on
         }
@@ -137,9 +137,9 @@ namespace i18n_string_util
     [[nodiscard]]
     constexpr static bool is_colon(const wchar_t ch) noexcept
         {
-        // clang-format off
-        return (ch == L':') ?       // !
-            true : (ch == 0xFF1A) ? // fullwidth
+        // clang-format off
+        return (ch == L':') ?       // !
+            true : (ch == 0xFF1A) ? // fullwidth
             true : false;
         // clang-format on
         }
@@ -149,9 +149,9 @@ namespace i18n_string_util
     [[nodiscard]]
     constexpr static bool is_close_parenthesis(const wchar_t ch) noexcept
         {
-        // clang-format off
-        return (ch == L')') ?       // )
-            true : (ch == 0xFF09) ? // fullwidth
+        // clang-format off
+        return (ch == L')') ?       // )
+            true : (ch == 0xFF09) ? // fullwidth
             true : false;
         // clang-format on
         }
@@ -219,7 +219,7 @@ namespace i18n_string_util
     /// @param str The string to have color values removed from.
     inline void remove_hex_color_values(std::wstring& str)
         {
-        const std::wregex colorRegex(L"#[[:xdigit:]]{6}");
+        static const std::wregex colorRegex(L"#[[:xdigit:]]{6}");
         try
             {
             str = std::regex_replace(str, colorRegex, L"");
@@ -254,6 +254,21 @@ namespace i18n_string_util
         return retVal;
         }
 
+    /** @brief Converts a wide string to UTF-8.
+        @param text The string to convert.
+        @returns The string, encoded as UTF-8.
+        @throws utf8::invalid_code_point If @c text contains an invalid code point
+            (e.g., an unpaired surrogate).*/
+    [[nodiscard]]
+    std::string to_utf8(std::wstring_view text);
+
+    /** @brief Converts a UTF-8 string to a wide string.
+        @param text The UTF-8 string to convert.
+        @returns The string, converted to a wstring.
+        @throws utf8::invalid_utf8 If @c text is not valid UTF-8.*/
+    [[nodiscard]]
+    std::wstring from_utf8(std::string_view text);
+
     /// @brief Converts escaped control characters (e.g., "\n")
     ///     inside of a string into spaces.
     /// @param[out] str The string being escaped.
@@ -0,0 +1,799 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+#include "language_server.h"
+#include <cctype>
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace i18n_check
+    {
+    namespace
+        {
+        /// @brief A parsed JSON value.
+        /// @details Only what is needed to read the client's messages is supported.
+        struct json_value
+            {
+            enum class value_type
+                {
+                null_value,
+                boolean_value,
+                number_value,
+                string_value,
+                array_value,
+                object_value
+                };
+
+            /// @returns The value of the given key (if this is an object), or null if not found.
+            [[nodiscard]]
+            const json_value* find(const std::string_view key) const noexcept
+                {
+                for (const auto& member : m_members)
+                    {
+                    if (member.first == key)
+                        {
+                        return &member.second;
+                        }
+                    }
+                return nullptr;
+                }
+
+            /// @returns The string value of the given key, or an empty string if not found.
+            [[nodiscard]]
+            std::string find_string(const std::string_view key) const
+                {
+                const auto* value = find(key);
+                return (value != nullptr && value->m_type == value_type::string_value) ?
+                           value->m_string :
+                           std::string{};
+                }
+
+            value_type m_type{ value_type::null_value };
+            bool m_boolean{ false };
+            // numbers are kept as they were written so that request IDs are echoed back verbatim
+            std::string m_string;
+            std::vector<json_value> m_items;
+            std::vector<std::pair<std::string, json_value>> m_members;
+            };
+
+        /// @brief Recursive descent JSON parser.
+        class json_parser
+            {
+          public:
+            /// @brief How deeply objects and arrays can be nested
+            ///     (so that a malicious message can't exhaust the stack).
+            constexpr static size_t max_depth{ 64 };
+
+            explicit json_parser(const std::string_view text) : m_text(text) {}
+
+            /// @returns The parsed document.
+            /// @throws std::runtime_error If the text is not valid JSON.
+            json_value parse()
+                {
+                auto value = parse_value();
+                skip_whitespace();
+                if (m_position != m_text.length())
+                    {
+                    throw std::runtime_error("Unexpected trailing content in JSON message.");
+                    }
+                return value;
+                }
+
+          private:
+            void skip_whitespace() noexcept
+                {
+                while (m_position < m_text.length() &&
+                       (m_text[m_position] == ' ' || m_text[m_position] == '\t' ||
+                        m_text[m_position] == '\n' || m_text[m_position] == '\r'))
+                    {
+                    ++m_position;
+                    }
+                }
+
+            void expect(const char ch)
+                {
+                skip_whitespace();
+                if (m_position >= m_text.length() || m_text[m_position] != ch)
+                    {
+                    throw std::runtime_error(std::string{ "Expected '" } + ch +
+                                             "' in JSON message.");
+                    }
+                ++m_position;
+                }
+
+            bool consume_literal(const std::string_view literal) noexcept
+                {
+                if (m_text.substr(m_position, literal.length()) == literal)
+                    {
+                    m_position += literal.length();
+                    return true;
+                    }
+                return false;
+                }
+
+            json_value parse_value()
+                {
+                skip_whitespace();
+                if (m_position >= m_text.length())
+                    {
+                    throw std::runtime_error("Unexpected end of JSON message.");
+                    }
+
+                json_value value;
+                const char ch{ m_text[m_position] };
+                if (ch == '{')
+                    {
+                    value.m_type = json_value::value_type::object_value;
+                    ++m_position;
+                    skip_whitespace();
+                    if (m_position < m_text.length() && m_text[m_position] == '}')
+                        {
+                        ++m_position;
+                        return value;
+                        }
+                    while (true)
+                        {
+                        skip_whitespace();
+                        auto key = parse_string();
+                        expect(':');
+                        value.m_members.emplace_back(std::move(key), parse_nested_value());
+                        skip_whitespace();
+                        if (m_position < m_text.length() && m_text[m_position] == ',')
+                            {
+                            ++m_position;
+                            continue;
+                            }
+                        expect('}');
+                        return value;
+                        }
+                    }
+                if (ch == '[')
+                    {
+                    value.m_type = json_value::value_type::array_value;
+                    ++m_position;
+                    skip_whitespace();
+                    if (m_position < m_text.length() && m_text[m_position] == ']')
+                        {
+                        ++m_position;
+                        return value;
+                        }
+                    while (true)
+                        {
+                        value.m_items.push_back(parse_nested_value());
+                        skip_whitespace();
+                        if (m_position < m_text.length() && m_text[m_position] == ',')
+                            {
+                            ++m_position;
+                            continue;
+                            }
+                        expect(']');
+                        return value;
+                        }
+                    }
+                if (ch == '"')
+                    {
+                    value.m_type = json_value::value_type::string_value;
+                    value.m_string = parse_string();
+                    return value;
+                    }
+                if (consume_literal("true"))
+                    {
+                    value.m_type = json_value::value_type::boolean_value;
+                    value.m_boolean = true;
+                    return value;
+                    }
+                if (consume_literal("false"))
+                    {
+                    value.m_type = json_value::value_type::boolean_value;
+                    return value;
+                    }
+                if (consume_literal("null"))
+                    {
+                    return value;
+                    }
+                if (ch == '-' || (ch >= '0' && ch <= '9'))
+                    {
+                    value.m_type = json_value::value_type::number_value;
+                    const auto start{ m_position };
+                    while (m_position < m_text.length() &&
+                           std::string_view{ "+-.eE0123456789" }.find(m_text[m_position]) !=
+                               std::string_view::npos)
+                        {
+                        ++m_position;
+                        }
+                    value.m_string = std::string{ m_text.substr(start, m_position - start) };
+                    return value;
+                    }
+                throw std::runtime_error("Invalid value in JSON message.");
+                }
+
+            /// @returns A value inside of an object or array.
+            json_value parse_nested_value()
+                {
+                if (m_depth >= max_depth)
+                    {
+                    throw std::runtime_error("JSON message is nested too deeply.");
+                    }
+                ++m_depth;
+                auto value = parse_value();
+                --m_depth;
+                return value;
+                }
+
+            uint32_t parse_hex4()
+                {
+                if (m_position + 4 > m_text.length())
+                    {
+                    throw std::runtime_error("Invalid unicode escape in JSON message.");
+                    }
+                uint32_t codePoint{ 0 };
+                for (size_t i = 0; i < 4; ++i)
+                    {
+                    const char ch{ m_text[m_position++] };
+                    codePoint <<= 4;
+                    if (ch >= '0' && ch <= '9')
+                        {
+                        codePoint |= static_cast<uint32_t>(ch - '0');
+                        }
+                    else if (ch >= 'a' && ch <= 'f')
+                        {
+                        codePoint |= static_cast<uint32_t>(ch - 'a' + 10);
+                        }
+                    else if (ch >= 'A' && ch <= 'F')
+                        {
+                        codePoint |= static_cast<uint32_t>(ch - 'A' + 10);
+                        }
+                    else
+                        {
+                        throw std::runtime_error("Invalid unicode escape in JSON message.");
+                        }
+                    }
+                return codePoint;
+                }
+
+            static void append_utf8(std::string& str, const uint32_t codePoint)
+                {
+                if (codePoint < 0x80)
+                    {
+                    str += static_cast<char>(codePoint);
+                    }
+                else if (codePoint < 0x800)
+                    {
+                    str += static_cast<char>(0xC0 | (codePoint >> 6));
+                    str += static_cast<char>(0x80 | (codePoint & 0x3F));
+                    }
+                else if (codePoint < 0x10000)
+                    {
+                    str += static_cast<char>(0xE0 | (codePoint >> 12));
+                    str += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                    str += static_cast<char>(0x80 | (codePoint & 0x3F));
+                    }
+                else
+                    {
+                    str += static_cast<char>(0xF0 | (codePoint >> 18));
+                    str += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+                    str += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                    str += static_cast<char>(0x80 | (codePoint & 0x3F));
+                    }
+                }
+
+            std::string parse_string()
+                {
+                expect('"');
+                std::string str;
+                while (m_position < m_text.length())
+                    {
+                    const char ch{ m_text[m_position++] };
+                    if (ch == '"')
+                        {
+                        return str;
+                        }
+                    if (ch != '\\')
+                        {
+                        str += ch;
+                        continue;
+                        }
+                    if (m_position >= m_text.length())
+                        {
+                        break;
+                        }
+                    const char escaped{ m_text[m_position++] };
+                    switch (escaped)
+                        {
+                    case 'b':
+                        str += '\b';
+                        break;
+                    case 'f':
+                        str += '\f';
+                        break;
+                    case 'n':
+                        str += '\n';
+                        break;
+                    case 'r':
+                        str += '\r';
+                        break;
+                    case 't':
+                        str += '\t';
+                        break;
+                    case 'u':
+                        {
+                        auto codePoint = parse_hex4();
+                        // surrogate pair
+                        if (codePoint >= 0xD800 && codePoint <= 0xDBFF &&
+                            m_text.substr(m_position, 2) == "\\u")
+                            {
+                            m_position += 2;
+                            const auto lowSurrogate = parse_hex4();
+                            codePoint = 0x10000 + ((codePoint - 0xD800) << 10) +
+                                        (lowSurrogate - 0xDC00);
+                            }
+                        append_utf8(str, codePoint);
+                        break;
+                        }
+                    default:
+                        // quotes, slashes, and backslashes
+                        str += escaped;
+                        }
+                    }
+                throw std::runtime_error("Unterminated string in JSON message.");
+                }
+
+            std::string_view m_text;
+            size_t m_position{ 0 };
+            size_t m_depth{ 0 };
+            };
+
+        //------------------------------------------------------
+        std::string json_escape(const std::string_view str)
+            {
+            std::string escaped{ "\"" };
+            escaped.reserve(str.length() + 2);
+            for (const char ch : str)
+                {
+                switch (ch)
+                    {
+                case '"':
+                    escaped += "\\\"";
+                    break;
+                case '\\':
+                    escaped += "\\\\";
+                    break;
+                case '\n':
+                    escaped += "\\n";
+                    break;
+                case '\r':
+                    escaped += "\\r";
+                    break;
+                case '\t':
+                    escaped += "\\t";
+                    break;
+                default:
+                    if (static_cast<unsigned char>(ch) < 0x20)
+                        {
+                        constexpr std::string_view hexDigits{ "0123456789ABCDEF" };
+                        escaped += "\\u00";
+                        escaped += hexDigits[(static_cast<unsigned char>(ch) >> 4) & 0xF];
+                        escaped += hexDigits[static_cast<unsigned char>(ch) & 0xF];
+                        }
+                    else
+                        {
+                        escaped += ch;
+                        }
+                    }
+                }
+            escaped += '"';
+            return escaped;
+            }
+
+        //------------------------------------------------------
+        std::string request_id_to_json(const json_value* requestId)
+            {
+            if (requestId == nullptr)
+                {
+                return "null";
+                }
+            if (requestId->m_type == json_value::value_type::string_value)
+                {
+                return json_escape(requestId->m_string);
+                }
+            if (requestId->m_type == json_value::value_type::number_value)
+                {
+                return requestId->m_string;
+                }
+            return "null";
+            }
+
+        /// @brief Converts a @c file:// URI into a local path.
+        /// @returns The path, or an empty value if the URI doesn't decode to valid UTF-8.
+        std::optional<std::filesystem::path> uri_to_path(const std::string_view uri)
+            {
+            constexpr std::string_view fileScheme{ "file://" };
+            std::string_view pathPart{ uri };
+            if (pathPart.starts_with(fileScheme))
+                {
+                pathPart.remove_prefix(fileScheme.length());
+                }
+
+            // percent decoding
+            std::string decoded;
+            decoded.reserve(pathPart.length());
+            for (size_t i = 0; i < pathPart.length(); ++i)
+                {
+                if (pathPart[i] == '%' && i + 2 < pathPart.length() &&
+                    std::isxdigit(static_cast<unsigned char>(pathPart[i + 1])) &&
+                    std::isxdigit(static_cast<unsigned char>(pathPart[i + 2])))
+                    {
+                    decoded += static_cast<char>(
+                        std::stoi(std::string{ pathPart.substr(i + 1, 2) }, nullptr, 16));
+                    i += 2;
+                    }
+                else
+                    {
+                    decoded += pathPart[i];
+                    }
+                }
+
+            // "/C:/folder" -> "C:/folder"
+            if (decoded.length() >= 3 && decoded[0] == '/' &&
+                std::isalpha(static_cast<unsigned char>(decoded[1])) && decoded[2] == ':')
+                {
+                decoded.erase(0, 1);
+                }
+            try
+                {
+                return std::filesystem::path{ i18n_string_util::from_utf8(decoded) };
+                }
+            catch (const std::exception&)
+                {
+                return std::nullopt;
+                }
+            }
+
+        /// @returns The offsets of where each line in @c text starts.
+        std::vector<size_t> get_line_starts(const std::wstring_view text)
+            {
+            std::vector<size_t> lineStarts{ 0 };
+            for (size_t i = 0; i < text.length(); ++i)
+                {
+                if (text[i] == L'\r' && i + 1 < text.length() && text[i + 1] == L'\n')
+                    {
+                    ++i;
+                    lineStarts.push_back(i + 1);
+                    }
+                else if (text[i] == L'\r' || text[i] == L'\n')
+                    {
+                    lineStarts.push_back(i + 1);
+                    }
+                }
+            return lineStarts;
+            }
+
+        /// @returns A column (as a count of characters) converted to UTF-16 code units,
+        ///     which is what LSP positions use.
+        size_t to_utf16_column(const std::wstring_view text, const size_t lineStart,
+                               const size_t column)
+            {
+            if constexpr (sizeof(wchar_t) == sizeof(uint16_t))
+                {
+                return column;
+                }
+            else
+                {
+                size_t utf16Column{ 0 };
+                for (size_t i = lineStart; i < lineStart + column && i < text.length(); ++i)
+                    {
+                    utf16Column += (static_cast<uint32_t>(text[i]) > 0xFFFF) ? 2 : 1;
+                    }
+                return utf16Column;
+                }
+            }
+        } // namespace
+
+    //------------------------------------------------------
+    void language_server::send_message(const std::string& message, std::ostream& output)
+        {
+        output << "Content-Length: " << message.length() << "\r\n\r\n" << message;
+        output.flush();
+        }
+
+    //------------------------------------------------------
+    void language_server::read_messages(std::istream& input,
+                                        const std::shared_ptr<message_queue>& queue,
+                                        const size_t maxMessageLength)
+        {
+        std::string line;
+        while (input)
+            {
+            // headers, ending with an empty line
+            size_t contentLength{ 0 };
+            bool hasLength{ false };
+            while (std::getline(input, line))
+                {
+                if (!line.empty() && line.back() == '\r')
+                    {
+                    line.pop_back();
+                    }
+                if (line.empty())
+                    {
+                    break;
+                    }
+                constexpr std::string_view lengthHeader{ "Content-Length:" };
+                if (line.starts_with(lengthHeader))
+                    {
+                    try
+                        {
+                        contentLength = std::stoull(line.substr(lengthHeader.length()));
+                        hasLength = true;
+                        }
+                    catch (...)
+                        {
+                        hasLength = false;
+                        }
+                    }
+                }
+            if (!input || !hasLength)
+                {
+                if (!input)
+                    {
+                    break;
+                    }
+                continue;
+                }
+
+            // skip messages that are too large to hold in memory
+            // (closing the connection if it is too large to even skip)
+            if (contentLength > maxMessageLength)
+                {
+                if (contentLength >=
+                        static_cast<size_t>(std::numeric_limits<std::streamsize>::max()) ||
+                    !input.ignore(static_cast<std::streamsize>(contentLength)))
+                    {
+                    break;
+                    }
+                continue;
+                }
+
+            std::string content(contentLength, '\0');
+            if (!input.read(content.data(), static_cast<std::streamsize>(contentLength)))
+                {
+                break;
+                }
+
+                {
+                std::lock_guard<std::mutex> lock{ queue->m_mutex };
+                queue->m_messages.push_back(std::move(content));
+                }
+            queue->m_condition.notify_one();
+            }
+
+            {
+            std::lock_guard<std::mutex> lock{ queue->m_mutex };
+            queue->m_inputClosed = true;
+            }
+        queue->m_condition.notify_one();
+        }
+
+    //------------------------------------------------------
+    int language_server::run(std::istream& input, std::ostream& output)
+        {
+        // the reader is detached because it may be blocked reading input
+        // when the client sends the "exit" notification
+        std::thread{ [queue = m_queue, &input, maxMessageLength = m_maxMessageLength]()
+                     { read_messages(input, queue, maxMessageLength); } }
+            .detach();
+
+        while (true)
+            {
+            std::string message;
+                {
+                std::unique_lock<std::mutex> lock{ m_queue->m_mutex };
+                const auto hasWork = [this]()
+                { return !m_queue->m_messages.empty() || m_queue->m_inputClosed; };
+
+                // wait for either a message or the next document that is due to be analyzed
+                std::optional<std::chrono::steady_clock::time_point> nextDeadline;
+                for (const auto& doc : m_documents)
+                    {
+                    if (doc.second.m_reanalyzeTime &&
+                        (!nextDeadline || *doc.second.m_reanalyzeTime < *nextDeadline))
+                        {
+                        nextDeadline = doc.second.m_reanalyzeTime;
+                        }
+                    }
+                if (nextDeadline)
+                    {
+                    m_queue->m_condition.wait_until(lock, *nextDeadline, hasWork);
+                    }
+                else
+                    {
+                    m_queue->m_condition.wait(lock, hasWork);
+                    }
+
+                if (!m_queue->m_messages.empty())
+                    {
+                    message = std::move(m_queue->m_messages.front());
+                    m_queue->m_messages.pop_front();
+                    }
+                // the client went away without sending "exit"
+                else if (m_queue->m_inputClosed)
+                    {
+                    return m_shutdownRequested ? 0 : 1;
+                    }
+                }
+
+            if (!message.empty() && !process_message(message, output))
+                {
+                return m_shutdownRequested ? 0 : 1;
+                }
+
+            // analyze any documents that have been idle long enough
+            const auto currentTime{ std::chrono::steady_clock::now() };
+            for (auto& doc : m_documents)
+                {
+                if (doc.second.m_reanalyzeTime && *doc.second.m_reanalyzeTime <= currentTime)
+                    {
+                    doc.second.m_reanalyzeTime.reset();
+                    publish_diagnostics(doc.first, doc.second, output);
+                    }
+                }
+            }
+        }
+
+    //------------------------------------------------------
+    bool language_server::process_message(const std::string& message, std::ostream& output)
+        {
+        json_value request;
+        try
+            {
+            request = json_parser{ message }.parse();
+            }
+        catch (const std::exception&)
+            {
+            send_message(R"({"jsonrpc":"2.0","id":null,"error":{"code":-32700,)"
+                         R"("message":"Parse error"}})",
+                         output);
+            return true;
+            }
+
+        const std::string method{ request.find_string("method") };
+        const auto* requestId = request.find("id");
+        const auto* params = request.find("params");
+        const auto* textDocument = (params != nullptr) ? params->find("textDocument") : nullptr;
+
+        if (method == "initialize")
+            {
+            // full document sync
+            send_message(R"({"jsonrpc":"2.0","id":)" + request_id_to_json(requestId) +
+                             R"(,"result":{"capabilities":{"textDocumentSync":1},)"
+                             R"("serverInfo":{"name":"quneiform"}}})",
+                         output);
+            }
+        else if (method == "shutdown")
+            {
+            m_shutdownRequested = true;
+            send_message(R"({"jsonrpc":"2.0","id":)" + request_id_to_json(requestId) +
+                             R"(,"result":null})",
+                         output);
+            }
+        else if (method == "exit")
+            {
+            return false;
+            }
+        else if (method == "textDocument/didOpen" && textDocument != nullptr)
+            {
+            auto& doc = m_documents[textDocument->find_string("uri")];
+            try
+                {
+                doc.m_text = i18n_string_util::from_utf8(textDocument->find_string("text"));
+                }
+            catch (const std::exception&)
+                {
+                doc.m_text.clear();
+                }
+            // analyze newly opened documents right away
+            doc.m_reanalyzeTime = std::chrono::steady_clock::now();
+            }
+        else if (method == "textDocument/didChange" && textDocument != nullptr)
+            {
+            const auto* changes = params->find("contentChanges");
+            auto docPos = m_documents.find(textDocument->find_string("uri"));
+            if (changes != nullptr && !changes->m_items.empty() && docPos != m_documents.end())
+                {
+                // with full syncing, the last change is the document's complete text
+                try
+                    {
+                    docPos->second.m_text =
+                        i18n_string_util::from_utf8(changes->m_items.back().find_string("text"));
+                    }
+                catch (const std::exception&)
+                    {
+                    docPos->second.m_text.clear();
+                    }
+                docPos->second.m_reanalyzeTime = std::chrono::steady_clock::now() + m_debounceDelay;
+                }
+            }
+        else if (method == "textDocument/didClose" && textDocument != nullptr)
+            {
+            const std::string uri{ textDocument->find_string("uri") };
+            m_documents.erase(uri);
+            send_message(R"({"jsonrpc":"2.0","method":"textDocument/publishDiagnostics",)"
+                         R"("params":{"uri":)" +
+                             json_escape(uri) + R"(,"diagnostics":[]}})",
+                         output);
+            }
+        else if (requestId != nullptr && !method.empty())
+            {
+            // unsupported request (notifications that we don't handle are ignored)
+            send_message(R"({"jsonrpc":"2.0","id":)" + request_id_to_json(requestId) +
+                             R"(,"error":{"code":-32601,"message":"Method not found"}})",
+                         output);
+            }
+
+        return true;
+        }
+
+    //------------------------------------------------------
+    void language_server::publish_diagnostics(const std::string& uri, const document& doc,
+                                              std::ostream& output)
+        {
+        const auto filePath = uri_to_path(uri);
+        // a URI that can't be decoded can't be analyzed (and shouldn't bring down the server)
+        if (!filePath)
+            {
+            return;
+            }
+
+        m_analyzer.analyze_buffer(doc.m_text, *filePath);
+        const auto lineStarts = get_line_starts(doc.m_text);
+
+        std::string diagnostics;
+        m_analyzer.for_each_result(
+            [&diagnostics, &doc, &lineStarts](const analysis_result& result)
+            {
+                const size_t line = (result.m_line != std::wstring::npos && result.m_line > 0 &&
+                                     result.m_line <= lineStarts.size()) ?
+                                        result.m_line - 1 :
+                                        0;
+                const size_t column =
+                    (result.m_column != std::wstring::npos && result.m_column > 0) ?
+                        to_utf16_column(doc.m_text, lineStarts[line], result.m_column - 1) :
+                        0;
+                const std::wstring message =
+                    result.m_value.empty() ?
+                        result.m_explanation :
+                        result.m_explanation + L"\n\"" + result.m_value + L"\"";
+
+                if (!diagnostics.empty())
+                    {
+                    diagnostics += ',';
+                    }
+                const std::string position{ R"({"line":)" + std::to_string(line) +
+                                            R"(,"character":)" + std::to_string(column) + "}" };
+                diagnostics += R"({"range":{"start":)" + position + R"(,"end":)" + position +
+                               R"(},"severity":2,"source":"quneiform","code":)" +
+                               json_escape(i18n_string_util::to_utf8(result.m_warningId)) +
+                               R"(,"message":)" +
+                               json_escape(i18n_string_util::to_utf8(message)) + "}";
+            });
+
+        send_message(R"({"jsonrpc":"2.0","method":"textDocument/publishDiagnostics",)"
+                     R"("params":{"uri":)" +
+                         json_escape(uri) + R"(,"diagnostics":[)" + diagnostics + "]}}",
+                     output);
+        }
+    } // namespace i18n_check
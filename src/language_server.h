@@ -0,0 +1,121 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+/** @addtogroup Internationalization
+    @brief i18n classes.
+@{*/
+
+#ifndef __I18N_LANGUAGE_SERVER_H__
+#define __I18N_LANGUAGE_SERVER_H__
+
+#include "analyze.h"
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+
+namespace i18n_check
+    {
+    /** @brief Language Server Protocol (LSP) server, communicating over a pair of streams
+            (normally stdin and stdout).
+        @details Open C++, C#, PO, and RC documents are analyzed from the editor's buffers
+            (the files are not read from disk), and their warnings are published
+            as diagnostics.\n
+            Reanalysis is debounced per document, so that a burst of edits only
+            triggers one analysis once the document has been idle for a short time.
+            The same analyzers are reused for every document.*/
+    class language_server
+        {
+      public:
+        /** @brief Constructor.
+            @param analyzer The analyzer (and its configured reviewers) to use.*/
+        explicit language_server(batch_analyze& analyzer) : m_analyzer(analyzer) {}
+
+        /// @private
+        language_server(const language_server&) = delete;
+        /// @private
+        language_server& operator=(const language_server&) = delete;
+
+        /** @brief Sets how long a document must go unchanged before it is reanalyzed.
+            @param delay The delay.*/
+        void set_debounce_delay(const std::chrono::milliseconds delay) noexcept
+            {
+            m_debounceDelay = delay;
+            }
+
+        /** @brief Sets the largest message (in bytes) that will be read from the client.
+            @details Larger messages are skipped (and their documents aren't analyzed).
+                The default is 64 megabytes.
+            @param length The maximum length.*/
+        void set_max_message_length(const size_t length) noexcept { m_maxMessageLength = length; }
+
+        /** @brief Processes messages until the client sends an @c exit notification
+                (or the input is closed).
+            @param input The stream that the client's messages are read from.
+            @param output The stream to write responses and diagnostics to.
+            @returns The process exit code: @c 0 if the client requested a shutdown
+                before exiting, @c 1 otherwise.*/
+        int run(std::istream& input, std::ostream& output);
+
+      private:
+        /// @brief An open document.
+        struct document
+            {
+            std::wstring m_text;
+            /// @brief When the document should be reanalyzed (empty if up to date).
+            std::optional<std::chrono::steady_clock::time_point> m_reanalyzeTime;
+            };
+
+        /// @brief Messages read from the client, waiting to be processed.
+        /// @details This is shared with the reader thread, which may outlive the server
+        ///     if it is still blocked reading input when the client exits.
+        struct message_queue
+            {
+            std::mutex m_mutex;
+            std::condition_variable m_condition;
+            std::deque<std::string> m_messages;
+            bool m_inputClosed{ false };
+            };
+
+        /// @brief Reads messages from the client and queues them for the main loop.
+        static void read_messages(std::istream& input, const std::shared_ptr<message_queue>& queue,
+                                  const size_t maxMessageLength);
+
+        /// @brief Handles a message from the client.
+        /// @returns @c false if the client requested to exit.
+        bool process_message(const std::string& message, std::ostream& output);
+
+        /// @brief Analyzes a document and publishes its diagnostics.
+        void publish_diagnostics(const std::string& uri, const document& doc,
+                                 std::ostream& output);
+
+        /// @brief Writes a message (with its header) to the client.
+        static void send_message(const std::string& message, std::ostream& output);
+
+        batch_analyze& m_analyzer;
+        std::chrono::milliseconds m_debounceDelay{ 300 };
+        size_t m_maxMessageLength{ 64 * 1024 * 1024 };
+        std::map<std::string, document> m_documents;
+        bool m_shutdownRequested{ false };
+        std::shared_ptr<message_queue> m_queue{ std::make_shared<message_queue>() };
+        };
+    } // namespace i18n_check
+
+/** @}*/
+
+#endif //__I18N_LANGUAGE_SERVER_H__
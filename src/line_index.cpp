@@ -0,0 +1,88 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+#include "line_index.h"
+#include <algorithm>
+#include <cwchar>
+#include <iterator>
+
+namespace i18n_check
+    {
+    //--------------------------------------------------
+    void line_index::assign(std::wstring_view text)
+        {
+        m_text = text;
+        m_line_starts.clear();
+        m_line_starts.push_back(0);
+
+        const wchar_t* const textStart{ text.data() };
+        const wchar_t* const textEnd{ std::next(textStart, static_cast<ptrdiff_t>(text.length())) };
+        // Most files only use \n, so if there are no carriage returns, then the newlines
+        // can be found with wmemchr() (which the C runtime vectorizes).
+        if (text.empty() || std::wmemchr(textStart, L'\r', text.length()) == nullptr)
+            {
+            const wchar_t* current{ textStart };
+            while (current < textEnd)
+                {
+                current = std::wmemchr(current, L'\n', static_cast<size_t>(textEnd - current));
+                if (current == nullptr)
+                    {
+                    break;
+                    }
+                std::advance(current, 1);
+                m_line_starts.push_back(static_cast<size_t>(current - textStart));
+                }
+            return;
+            }
+
+        for (size_t i = 0; i < text.length(); ++i)
+            {
+            if (text[i] == L'\r')
+                {
+                // CRLF is one line ending
+                if (i + 1 < text.length() && text[i + 1] == L'\n')
+                    {
+                    ++i;
+                    }
+                m_line_starts.push_back(i + 1);
+                }
+            else if (text[i] == L'\n')
+                {
+                m_line_starts.push_back(i + 1);
+                }
+            }
+        }
+
+    //--------------------------------------------------
+    std::pair<size_t, size_t> line_index::get_line_and_column(size_t position) const
+        {
+        if (position == std::wstring::npos || m_line_starts.empty())
+            {
+            return std::make_pair(std::wstring::npos, std::wstring::npos);
+            }
+
+        // the first line starting after the position
+        const auto nextLine =
+            std::upper_bound(m_line_starts.cbegin(), m_line_starts.cend(), position);
+        const auto lineNumber{ static_cast<size_t>(
+            std::distance(m_line_starts.cbegin(), nextLine)) };
+        // the \n of a CRLF is treated as the start of the following line
+        if (nextLine != m_line_starts.cend() && *nextLine == position + 1 && position > 0 &&
+            m_text[position] == L'\n' && m_text[position - 1] == L'\r')
+            {
+            return std::make_pair(lineNumber + 1, static_cast<size_t>(1));
+            }
+        // make one-indexed
+        return std::make_pair(lineNumber, position - *std::prev(nextLine) + 1);
+        }
+    } // namespace i18n_check
@@ -0,0 +1,95 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+/** @addtogroup Internationalization
+    @brief i18n classes.
+@{*/
+
+#ifndef __LINE_INDEX_H__
+#define __LINE_INDEX_H__
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace i18n_check
+    {
+    /** @brief The offsets of where each line in a text begins, used to convert
+            character positions into line and column numbers.
+        @details The text is scanned once when it is indexed, and then each position
+            is found with a binary search (rather than counting the newlines in front
+            of it every time).\n
+            Lines can end with @c \\n, @c \\r, or @c \\r\\n.
+        @note The text is not copied, so it must remain valid while the index is being used.*/
+    class line_index
+        {
+      public:
+        /// @brief Constructs an empty index.
+        line_index() = default;
+
+        /// @brief Indexes a text.
+        /// @param text The text to index.
+        explicit line_index(std::wstring_view text) { assign(text); }
+
+        /// @brief Indexes a text, replacing the current one.
+        /// @param text The text to index.
+        void assign(std::wstring_view text);
+
+        /// @brief Removes the text (and its line offsets).
+        void clear() noexcept
+            {
+            m_text = std::wstring_view{};
+            m_line_starts.clear();
+            }
+
+        /// @returns @c true if @c text is the same buffer (and length) that is indexed.
+        /// @param text The text to compare against.
+        [[nodiscard]]
+        bool is_indexing(std::wstring_view text) const noexcept
+            {
+            return !m_line_starts.empty() && text.data() == m_text.data() &&
+                   text.length() == m_text.length();
+            }
+
+        /// @returns The text being indexed.
+        [[nodiscard]]
+        std::wstring_view get_text() const noexcept
+            {
+            return m_text;
+            }
+
+        /// @returns The number of lines in the text.
+        [[nodiscard]]
+        size_t get_line_count() const noexcept
+            {
+            return m_line_starts.size();
+            }
+
+        /** @returns The (one-indexed) line and column of a character position,
+                or a pair of @c std::wstring::npos if nothing is indexed or
+                @c position is @c std::wstring::npos.
+            @param position The character position in the text.*/
+        [[nodiscard]]
+        std::pair<size_t, size_t> get_line_and_column(size_t position) const;
+
+      private:
+        std::wstring_view m_text;
+        // the offset of the first character of each line (the first is always zero)
+        std::vector<size_t> m_line_starts;
+        };
+    } // namespace i18n_check
+
+/** @}*/
+
+#endif //__LINE_INDEX_H__
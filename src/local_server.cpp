@@ -0,0 +1,397 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+#include "local_server.h"
+#include "i18n_string_util.h"
+#include <array>
+#include <cerrno>
+#include <charconv>
+#include <cstring>
+#include <exception>
+#include <streambuf>
+#include <string_view>
+#ifndef _WIN32
+    #include <csignal>
+    #include <sys/socket.h>
+    #include <sys/stat.h>
+    #include <sys/time.h>
+    #include <sys/types.h>
+    #include <sys/un.h>
+    #include <unistd.h>
+#endif
+
+namespace i18n_check
+    {
+#ifndef _WIN32
+    namespace
+        {
+        /// @brief How long (in seconds) a client can stall while sending its request
+        ///     or reading the response before it is dropped.
+        constexpr time_t client_timeout_seconds{ 30 };
+
+        /// @brief The longest that the exit code at the end of a response can be
+        ///     (including the @c NUL in front of it).
+        constexpr size_t max_exit_code_length{ 12 };
+
+        //------------------------------------------------------
+        std::wstring last_error_message()
+            {
+            return i18n_string_util::lazy_string_to_wstring(std::strerror(errno));
+            }
+
+        //------------------------------------------------------
+        bool fill_socket_address(const std::filesystem::path& socketPath, sockaddr_un& address,
+                                 std::wstring& errorInfo)
+            {
+            std::memset(&address, 0, sizeof(address));
+            address.sun_family = AF_UNIX;
+            const std::string pathStr{ socketPath.string() };
+            if (pathStr.empty() || pathStr.length() >= sizeof(address.sun_path))
+                {
+                errorInfo = L"Socket path is empty or too long: " + socketPath.wstring();
+                return false;
+                }
+            std::memcpy(address.sun_path, pathStr.c_str(), pathStr.length());
+            return true;
+            }
+
+        /// @returns @c true if the client connected to @c fd is running as the same user
+        ///     as the server.
+        bool is_same_user(const int fd)
+            {
+    #ifdef SO_PEERCRED
+            ucred credentials{};
+            socklen_t credentialsSize{ sizeof(credentials) };
+            return ::getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &credentials, &credentialsSize) == 0 &&
+                   credentials.uid == ::geteuid();
+    #else
+            uid_t userId{ 0 };
+            gid_t groupId{ 0 };
+            return ::getpeereid(fd, &userId, &groupId) == 0 && userId == ::geteuid();
+    #endif
+            }
+
+        //------------------------------------------------------
+        bool write_all(const int fd, std::string_view data)
+            {
+            size_t written{ 0 };
+            while (written < data.length())
+                {
+                const auto result = ::write(fd, std::next(data.data(), written),
+                                            data.length() - written);
+                if (result < 0)
+                    {
+                    if (errno == EINTR)
+                        {
+                        continue;
+                        }
+                    return false;
+                    }
+                written += static_cast<size_t>(result);
+                }
+            return true;
+            }
+
+        /// @brief Stream buffer that sends what is written to it to a socket.
+        class socket_output_buffer : public std::streambuf
+            {
+          public:
+            /// @brief Constructor.
+            /// @param fd The socket to write to.
+            explicit socket_output_buffer(const int fd) : m_fd(fd)
+                {
+                setp(m_buffer.data(), m_buffer.data() + m_buffer.size());
+                }
+
+          protected:
+            int_type overflow(int_type ch) override
+                {
+                if (sync() != 0)
+                    {
+                    return traits_type::eof();
+                    }
+                if (!traits_type::eq_int_type(ch, traits_type::eof()))
+                    {
+                    *pptr() = traits_type::to_char_type(ch);
+                    pbump(1);
+                    }
+                return traits_type::not_eof(ch);
+                }
+
+            int sync() override
+                {
+                const bool written{ write_all(
+                    m_fd, std::string_view{ pbase(), static_cast<size_t>(pptr() - pbase()) }) };
+                setp(m_buffer.data(), m_buffer.data() + m_buffer.size());
+                return written ? 0 : -1;
+                }
+
+          private:
+            int m_fd{ -1 };
+            std::array<char, 4096> m_buffer{};
+            };
+
+        /// @brief Reads a request (NUL-terminated fields: the working directory,
+        ///     the number of arguments, and then the arguments).
+        /// @returns The working directory and arguments, or an empty value if the request
+        ///     is malformed or the client hung up early
+        ///     (or stopped sending before the socket's receive timeout).
+        std::optional<std::vector<std::string>> read_request(const int fd)
+            {
+            std::vector<std::string> fields;
+            std::string currentField;
+            std::optional<size_t> argCount;
+            char buffer[4096]{};
+            while (true)
+                {
+                const auto bytesRead = ::read(fd, buffer, sizeof(buffer));
+                if (bytesRead < 0 && errno == EINTR)
+                    {
+                    continue;
+                    }
+                if (bytesRead <= 0)
+                    {
+                    return std::nullopt;
+                    }
+                for (ssize_t i = 0; i < bytesRead; ++i)
+                    {
+                    if (buffer[i] != 0)
+                        {
+                        currentField += buffer[i];
+                        continue;
+                        }
+                    // the argument count follows the working directory
+                    if (fields.size() == 1 && !argCount)
+                        {
+                        size_t count{ 0 };
+                        const auto fieldEnd = std::next(
+                            currentField.data(), static_cast<ptrdiff_t>(currentField.length()));
+                        if (currentField.empty() ||
+                            std::from_chars(currentField.data(), fieldEnd, count).ptr != fieldEnd)
+                            {
+                            return std::nullopt;
+                            }
+                        argCount = count;
+                        }
+                    else
+                        {
+                        fields.push_back(std::move(currentField));
+                        }
+                    currentField.clear();
+                    if (argCount && fields.size() == *argCount + 1)
+                        {
+                        return fields;
+                        }
+                    }
+                }
+            }
+        } // namespace
+#endif
+
+    //------------------------------------------------------
+    bool run_local_server(const std::filesystem::path& socketPath,
+                          const local_request_handler& handler, std::wstring& errorInfo)
+        {
+#ifdef _WIN32
+        [[maybe_unused]] const auto& unusedPath{ socketPath };
+        [[maybe_unused]] const auto& unusedHandler{ handler };
+        errorInfo = L"Server mode is not supported on this platform.";
+        return false;
+#else
+        sockaddr_un address{};
+        if (!fill_socket_address(socketPath, address, errorInfo))
+            {
+            return false;
+            }
+
+        // clients hanging up early shouldn't bring down the server
+        std::signal(SIGPIPE, SIG_IGN);
+
+        // remove a socket file left behind by a previous server
+        std::error_code ec;
+        if (std::filesystem::is_socket(socketPath, ec))
+            {
+            std::filesystem::remove(socketPath, ec);
+            }
+        else if (std::filesystem::exists(socketPath, ec))
+            {
+            errorInfo = L"Socket path already exists and is not a socket: " + socketPath.wstring();
+            return false;
+            }
+
+        const int serverFd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (serverFd < 0)
+            {
+            errorInfo = L"Unable to create socket: " + last_error_message();
+            return false;
+            }
+        // only the user running the server can connect to it
+        // (the socket file is created with the umask's permissions removed)
+        const mode_t previousMask = ::umask(S_IRWXG | S_IRWXO | S_IXUSR);
+        const bool bound{ ::bind(serverFd, reinterpret_cast<const sockaddr*>(&address),
+                                 sizeof(address)) == 0 };
+        ::umask(previousMask);
+        if (!bound || ::listen(serverFd, SOMAXCONN) != 0)
+            {
+            errorInfo =
+                L"Unable to listen on " + socketPath.wstring() + L": " + last_error_message();
+            ::close(serverFd);
+            return false;
+            }
+
+        while (true)
+            {
+            const int clientFd = ::accept(serverFd, nullptr, nullptr);
+            if (clientFd < 0)
+                {
+                if (errno == EINTR)
+                    {
+                    continue;
+                    }
+                errorInfo = L"Unable to accept connection: " + last_error_message();
+                break;
+                }
+
+            // requests are handled one at a time, so don't let a stalled client
+            // block the ones waiting behind it
+            const timeval timeout{ client_timeout_seconds, 0 };
+            ::setsockopt(clientFd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+            ::setsockopt(clientFd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+            // in case the socket's permissions were changed, also verify who is connecting
+            if (!is_same_user(clientFd))
+                {
+                ::close(clientFd);
+                continue;
+                }
+
+            const auto request = read_request(clientFd);
+            if (request)
+                {
+                socket_output_buffer responseBuffer{ clientFd };
+                std::ostream response{ &responseBuffer };
+                int exitCode{ 1 };
+                try
+                    {
+                    exitCode = handler(std::filesystem::path{ request->front() },
+                                       std::vector<std::string>(std::next(request->cbegin()),
+                                                                request->cend()),
+                                       response);
+                    }
+                catch (const std::exception& expt)
+                    {
+                    response << "Error: " << expt.what() << "\n";
+                    }
+                // the exit code goes after the output (it isn't known until the request is done)
+                response << '\0' << exitCode;
+                response.flush();
+                }
+            ::close(clientFd);
+            }
+
+        ::close(serverFd);
+        std::filesystem::remove(socketPath, ec);
+        return false;
+#endif
+        }
+
+    //------------------------------------------------------
+    std::optional<int> send_local_request(const std::filesystem::path& socketPath,
+                                          const std::filesystem::path& workingDirectory,
+                                          const std::vector<std::string>& args,
+                                          std::ostream& response, std::wstring& errorInfo)
+        {
+#ifdef _WIN32
+        [[maybe_unused]] const auto& unusedPath{ socketPath };
+        [[maybe_unused]] const auto& unusedWorkingDirectory{ workingDirectory };
+        [[maybe_unused]] const auto& unusedArgs{ args };
+        [[maybe_unused]] const auto& unusedResponse{ response };
+        errorInfo = L"Server mode is not supported on this platform.";
+        return std::nullopt;
+#else
+        sockaddr_un address{};
+        if (!fill_socket_address(socketPath, address, errorInfo))
+            {
+            return std::nullopt;
+            }
+
+        std::signal(SIGPIPE, SIG_IGN);
+
+        const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0)
+            {
+            errorInfo = L"Unable to create socket: " + last_error_message();
+            return std::nullopt;
+            }
+        if (::connect(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0)
+            {
+            errorInfo =
+                L"Unable to connect to " + socketPath.wstring() + L": " + last_error_message();
+            ::close(fd);
+            return std::nullopt;
+            }
+
+        std::string request{ workingDirectory.string() };
+        request += '\0';
+        request.append(std::to_string(args.size()));
+        request += '\0';
+        for (const auto& arg : args)
+            {
+            request.append(arg);
+            request += '\0';
+            }
+        if (!write_all(fd, request))
+            {
+            errorInfo = L"Unable to send request: " + last_error_message();
+            ::close(fd);
+            return std::nullopt;
+            }
+
+        // the response's text is passed along as it is received, except for what follows
+        // the last NUL character so far, which may be the exit code at the end
+        std::string pending;
+        char buffer[4096]{};
+        while (true)
+            {
+            const auto bytesRead = ::read(fd, buffer, sizeof(buffer));
+            if (bytesRead < 0 && errno == EINTR)
+                {
+                continue;
+                }
+            if (bytesRead <= 0)
+                {
+                break;
+                }
+            pending.append(buffer, static_cast<size_t>(bytesRead));
+            const auto lastNull = pending.rfind('\0');
+            const bool mayBeExitCode{ lastNull != std::string::npos &&
+                                      pending.length() - lastNull <= max_exit_code_length };
+            const size_t outputLength{ mayBeExitCode ? lastNull : pending.length() };
+            response.write(pending.data(), static_cast<std::streamsize>(outputLength));
+            pending.erase(0, outputLength);
+            }
+        ::close(fd);
+        response.flush();
+
+        int exitCode{ 1 };
+        const auto codeEnd = std::next(pending.data(), static_cast<ptrdiff_t>(pending.length()));
+        if (pending.length() < 2 ||
+            std::from_chars(std::next(pending.data()), codeEnd, exitCode).ptr != codeEnd)
+            {
+            errorInfo = L"Incomplete response from the server.";
+            return std::nullopt;
+            }
+        return exitCode;
+#endif
+        }
+    } // namespace i18n_check
@@ -0,0 +1,77 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+/** @addtogroup Internationalization
+    @brief i18n classes.
+@{*/
+
+#ifndef __I18N_LOCAL_SERVER_H__
+#define __I18N_LOCAL_SERVER_H__
+
+#include <filesystem>
+#include <functional>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace i18n_check
+    {
+    /// @brief Callback used by the server to handle a request.
+    /// @details Takes the client's working directory, its command line arguments,
+    ///     and the stream to write the (UTF-8) response to. The response is sent to the
+    ///     client as it is written, and the request's exit code (the return value)
+    ///     is sent after it.
+    using local_request_handler =
+        std::function<int(const std::filesystem::path& workingDirectory,
+                          const std::vector<std::string>& args, std::ostream& response)>;
+
+    /** @brief Runs a server listening on a local (Unix domain) socket.
+        @details Requests are handled one at a time, in the order that they are received.
+            Each request is the client's working directory, the number of arguments,
+            and then the arguments, each terminated by a @c NUL character.
+            The response is streamed back, followed by a @c NUL character and the request's
+            exit code, and the connection is closed when it is complete.\n
+            A client that stops sending its request (or reading the response) for 30 seconds
+            is disconnected, so that it doesn't block the requests waiting behind it.\n
+            The socket is only accessible by the user running the server,
+            and connections from other users are refused.\n
+            This will run until the process is ended.
+        @param socketPath The path of the socket file to create.
+            If a stale socket file already exists at this path, then it will be replaced.
+        @param handler The function to process each request.
+        @param[out] errorInfo Any error that prevented the server from starting.
+        @returns @c false if the server could not be started
+            (the reason will be written to @c errorInfo).
+        @note Only supported on POSIX systems.*/
+    bool run_local_server(const std::filesystem::path& socketPath,
+                          const local_request_handler& handler, std::wstring& errorInfo);
+
+    /** @brief Sends a request to a server started with run_local_server().
+        @param socketPath The path of the server's socket file.
+        @param workingDirectory The client's working directory (used to resolve relative paths).
+        @param args The command line arguments to send.
+        @param[out] response The stream to write the server's (UTF-8) response to
+            as it is received.
+        @param[out] errorInfo Any error that occurred while communicating with the server.
+        @returns The request's exit code, or an empty value if the request failed.*/
+    [[nodiscard]]
+    std::optional<int> send_local_request(const std::filesystem::path& socketPath,
+                                          const std::filesystem::path& workingDirectory,
+                                          const std::vector<std::string>& args,
+                                          std::ostream& response, std::wstring& errorInfo);
+    } // namespace i18n_check
+
+/** @}*/
+
+#endif //__I18N_LOCAL_SERVER_H__
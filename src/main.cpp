@@ -14,14 +14,210 @@
 #include "analyze.h"
 #include "cxxopts/include/cxxopts.hpp"
 #include "input.h"
+#include "language_server.h"
+#include "local_server.h"
+#include "warning_baseline.h"
+#include <algorithm>
+#include <array>
+#include <iomanip>
 #include <iostream>
+#include <list>
 #include <numeric>
+#include <optional>
 #include <sstream>
+#include <streambuf>
 
 namespace fs = std::filesystem;
 
+namespace
+    {
+    /// @brief The state of a file when it was last analyzed.
+    struct file_stamp
+        {
+        fs::path m_path;
+        fs::file_time_type m_lastWriteTime;
+        std::uintmax_t m_size{ 0 };
+
+        [[nodiscard]]
+        bool operator==(const file_stamp& that) const = default;
+        };
+
+    /// @brief The results of a previous request made to the server.
+    struct cached_report
+        {
+        fs::path m_directory;
+        std::vector<std::string> m_arguments;
+        std::vector<file_stamp> m_files;
+        std::wstring m_report;
+        std::wstring m_summary;
+        };
+
+    /// @brief Previous reports from the server, most recently used first.
+    /// @details Only the latest request from each working directory is kept.
+    using report_cache = std::list<cached_report>;
+
+    /// @brief The maximum number of working directories that the server keeps reports for.
+    constexpr size_t max_cached_reports{ 8 };
+
+    //-------------------------------------------------
+    std::vector<file_stamp> get_file_stamps(const std::vector<fs::path>& files)
+        {
+        std::vector<file_stamp> stamps;
+        stamps.reserve(files.size());
+        for (const auto& file : files)
+            {
+            std::error_code ec;
+            const auto lastWriteTime = fs::last_write_time(file, ec);
+            const auto fileSize = fs::file_size(file, ec);
+            stamps.push_back(file_stamp{ file, lastWriteTime, ec ? 0 : fileSize });
+            }
+        return stamps;
+        }
+
+    /// @brief Stream buffer that writes its (wide) text to a narrow stream as UTF-8,
+    ///     so that a report can be written to a file as it is being formatted.
+    class utf8_output_buffer : public std::wstreambuf
+        {
+      public:
+        /** @brief Constructor.
+            @param out The stream to write to.
+            @param tabsToCommas @c true to replace tabs with commas (for CSV output).*/
+        utf8_output_buffer(std::ostream& out, const bool tabsToCommas)
+            : m_out(out), m_tabsToCommas(tabsToCommas)
+            {
+            setp(m_buffer.data(), m_buffer.data() + m_buffer.size());
+            }
+
+      protected:
+        int_type overflow(int_type ch) override
+            {
+            if (sync() != 0)
+                {
+                return traits_type::eof();
+                }
+            if (!traits_type::eq_int_type(ch, traits_type::eof()))
+                {
+                *pptr() = traits_type::to_char_type(ch);
+                pbump(1);
+                }
+            return traits_type::not_eof(ch);
+            }
+
+        int sync() override
+            {
+            std::wstring_view text{ pbase(), static_cast<size_t>(pptr() - pbase()) };
+            // don't split a surrogate pair (if wchar_t is UTF-16) across two writes
+            const bool splitSurrogate{ sizeof(wchar_t) == sizeof(uint16_t) && !text.empty() &&
+                                       text.back() >= 0xD800 && text.back() <= 0xDBFF };
+            if (splitSurrogate)
+                {
+                text.remove_suffix(1);
+                }
+            std::string utf8Str{ i18n_string_util::to_utf8(text) };
+            if (m_tabsToCommas)
+                {
+                string_util::replace_all<std::string>(utf8Str, "\t", ",");
+                }
+            m_out << utf8Str;
+
+            setp(m_buffer.data(), m_buffer.data() + m_buffer.size());
+            if (splitSurrogate)
+                {
+                m_buffer[0] = text.data()[text.length()];
+                pbump(1);
+                }
+            return m_out ? 0 : -1;
+            }
+
+      private:
+        std::ostream& m_out;
+        bool m_tabsToCommas{ false };
+        std::array<wchar_t, 4096> m_buffer{};
+        };
+
+    /// @brief Stream buffer that writes the UTF-8 text written to it to a wide stream,
+    ///     so that a server's response can be displayed as it is received.
+    class wide_output_buffer : public std::streambuf
+        {
+      public:
+        /** @brief Constructor.
+            @param out The stream to write to.*/
+        explicit wide_output_buffer(std::wostream& out) : m_out(out)
+            {
+            setp(m_buffer.data(), m_buffer.data() + m_buffer.size());
+            }
+
+      protected:
+        int_type overflow(int_type ch) override
+            {
+            if (sync() != 0)
+                {
+                return traits_type::eof();
+                }
+            if (!traits_type::eq_int_type(ch, traits_type::eof()))
+                {
+                *pptr() = traits_type::to_char_type(ch);
+                pbump(1);
+                }
+            return traits_type::not_eof(ch);
+            }
+
+        int sync() override
+            {
+            std::string_view text{ pbase(), static_cast<size_t>(pptr() - pbase()) };
+            // don't split a multibyte character across two writes
+            size_t incompleteLength{ 0 };
+            for (size_t i = 1; i <= std::min<size_t>(3, text.length()); ++i)
+                {
+                const auto byte = static_cast<unsigned char>(text[text.length() - i]);
+                // continuation byte, keep looking for the start of the character
+                if ((byte & 0xC0) == 0x80)
+                    {
+                    continue;
+                    }
+                const size_t characterLength{ (byte >= 0xF0) ? 4U :
+                                              (byte >= 0xE0) ? 3U :
+                                              (byte >= 0xC0) ? 2U :
+                                                               1U };
+                if (characterLength > i)
+                    {
+                    incompleteLength = i;
+                    }
+                break;
+                }
+            text.remove_suffix(incompleteLength);
+            try
+                {
+                m_out << i18n_string_util::from_utf8(text);
+                }
+            catch (const std::exception&)
+                {
+                m_out << i18n_string_util::lazy_string_to_wstring(std::string{ text });
+                }
+
+            setp(m_buffer.data(), m_buffer.data() + m_buffer.size());
+            std::copy_n(text.data() + text.length(), incompleteLength, m_buffer.data());
+            pbump(static_cast<int>(incompleteLength));
+            return m_out ? 0 : -1;
+            }
+
+      private:
+        std::wostream& m_out;
+        std::array<char, 4096> m_buffer{};
+        };
+    } // namespace
+
 //-------------------------------------------------
-int main(int argc, char* argv[])
+/// @brief Runs the analysis described by the command line arguments.
+/// @param argc The number of arguments.
+/// @param argv The arguments.
+/// @param out Where to write the results.
+/// @param workingDirectory The folder that relative paths in the arguments are relative to.
+///     If empty, then they are relative to the current working directory.
+/// @param cache If running as a server, the reports from previous requests.
+///     Will be @c nullptr for regular command line usage.
+static int run_quneiform(const int argc, const char* const* argv, std::wostream& out,
+                         const fs::path& workingDirectory, report_cache* cache)
     {
     cxxopts::Options options("Quneiform", "Quneiform: Internationalization/localization analysis "
                                           "system, (c) 2021-2025 Blake Madden");
@@ -64,6 +260,33 @@ int main(int argc, char* argv[])
          cxxopts::value<std::string>())
         ("q,quiet", "Only print errors and the final output",
          cxxopts::value<bool>()->default_value("false"))
+        ("baseline", "A file of previously accepted warnings. If it exists, only warnings not in it "
+                     "are reported; otherwise, it is created from the current warnings",
+         cxxopts::value<std::string>())
+        ("timings", "Display how long each stage of the analysis took "
+                    "(including building the rule tables)",
+         cxxopts::value<bool>()->default_value("false"))
+        ("retain-file-text", "Keep each file's text in memory during the analysis so that "
+                             "results refer to it rather than copying their strings",
+         cxxopts::value<bool>()->default_value("false"))
+        ("memory-limit", "The approximate amount of memory (in megabytes) that the results can use "
+                         "before they are moved to a temporary file. 0 is no limit",
+         cxxopts::value<int>()->default_value("0"))
+        ("log-limit", "The maximum number of debug messages to log (with --verbose) for each "
+                      "file type. Additional messages are only counted. 0 is no limit",
+         cxxopts::value<int>()->default_value("0"))
+        ("profile", "Display how often each regular expression was run, how often it matched, "
+                    "and how long it took (requires building with QUNEIFORM_REGEX_PROFILING)",
+         cxxopts::value<bool>()->default_value("false"))
+        ("serve", "Run as a resident server, listening for analysis requests on the provided "
+                  "local socket path",
+         cxxopts::value<std::string>())
+        ("connect", "Send the analysis request to a server (started with --serve) "
+                    "listening on the provided local socket path",
+         cxxopts::value<std::string>())
+        ("lsp", "Run as a language server (over stdin and stdout), "
+                "reviewing the documents that are open in an editor",
+         cxxopts::value<bool>()->default_value("false"))
         ("v,verbose", "Display debug information",
          cxxopts::value<bool>()->default_value("false"))("h,help", "Print usage");
     // clang-format on
@@ -81,16 +304,104 @@ int main(int argc, char* argv[])
 
         if (result.count("help"))
             {
-            std::wcout << i18n_string_util::lazy_string_to_wstring(options.help()) << L"\n";
+            out << i18n_string_util::lazy_string_to_wstring(options.help()) << L"\n";
             return 0;
             }
         }
     catch (const cxxopts::exceptions::exception& exp)
         {
-        std::wcout << i18n_string_util::lazy_string_to_wstring(exp.what());
+        out << i18n_string_util::lazy_string_to_wstring(exp.what());
         return 0;
         }
 
+    if (cache != nullptr && result.count("lsp") > 0)
+        {
+        out << L"Server requests cannot include --lsp.\n";
+        return 1;
+        }
+
+    if (result.count("serve") > 0 || result.count("connect") > 0)
+        {
+        if (cache != nullptr)
+            {
+            out << L"Server requests cannot include --serve or --connect.\n";
+            return 1;
+            }
+        // resident server: keeps the compiled rules and previous results in memory,
+        // and runs each request as if it were a separate command line call
+        if (result.count("serve") > 0)
+            {
+            report_cache serverCache;
+            std::wstring errorInfo;
+            const fs::path socketPath{ result["serve"].as<std::string>() };
+            out << L"Listening for analysis requests on " << socketPath << L"...\n";
+            i18n_check::run_local_server(
+                socketPath,
+                [&serverCache](const fs::path& clientDirectory,
+                               const std::vector<std::string>& args, std::ostream& response)
+                {
+                    // the request's relative paths are resolved against the client's folder
+                    // (rather than changing the server's working directory)
+                    std::error_code dirEc;
+                    if (!clientDirectory.is_absolute() || !fs::is_directory(clientDirectory, dirEc))
+                        {
+                        response << "Invalid working directory: " << clientDirectory.string()
+                                 << "\n";
+                        return 1;
+                        }
+
+                    std::vector<const char*> requestArgs{ "quneiform" };
+                    for (const auto& arg : args)
+                        {
+                        requestArgs.push_back(arg.c_str());
+                        }
+                    // the output is sent to the client as it is written
+                    utf8_output_buffer responseBuffer{ response, false };
+                    std::wostream requestOutput{ &responseBuffer };
+                    const int exitCode = run_quneiform(static_cast<int>(requestArgs.size()),
+                                                       requestArgs.data(), requestOutput,
+                                                       clientDirectory, &serverCache);
+                    requestOutput.flush();
+                    return exitCode;
+                },
+                errorInfo);
+            out << errorInfo << L"\n";
+            return 1;
+            }
+
+        // thin client: forward everything except the connection info to the server
+        std::vector<std::string> args;
+        for (int i = 1; i < argc; ++i)
+            {
+            const std::string_view arg{ argv[i] };
+            if (arg == "--connect")
+                {
+                ++i;
+                continue;
+                }
+            if (arg.starts_with("--connect="))
+                {
+                continue;
+                }
+            args.emplace_back(arg);
+            }
+        std::error_code ec;
+        std::wstring errorInfo;
+        // display the server's output as it arrives, and exit with the request's exit code
+        wide_output_buffer responseBuffer{ out };
+        std::ostream response{ &responseBuffer };
+        const auto exitCode =
+            i18n_check::send_local_request(fs::path{ result["connect"].as<std::string>() },
+                                           fs::current_path(ec), args, response, errorInfo);
+        response.flush();
+        if (!exitCode)
+            {
+            out << errorInfo << L"\n";
+            return 1;
+            }
+        return *exitCode;
+        }
+
     // helper to get a boolean option (option not being present returns default)
     const auto readBoolOption = [&result](const std::string& option, const bool defaultValue)
     {
@@ -116,31 +427,40 @@ int main(int argc, char* argv[])
             }
     };
 
+    const auto resolvePath = [&workingDirectory](const fs::path& path)
+    { return (workingDirectory.empty() || path.is_absolute()) ? path : workingDirectory / path; };
+
+    // the language server reviews the documents opened in the editor,
+    // so it doesn't need an input folder
+    const bool isLanguageServer{ readBoolOption("lsp", false) };
+
     fs::path inputFolder;
     if (result.count("input"))
         {
-        inputFolder = fs::path{ result["input"].as<std::string>(), fs::path::native_format };
+        inputFolder =
+            resolvePath(fs::path{ result["input"].as<std::string>(), fs::path::native_format });
         if (!fs::exists(inputFolder))
             {
-            std::wcout << L"Input path does not exist: " << inputFolder;
+            out << L"Input path does not exist: " << inputFolder;
             return 0;
             }
         }
-    else
+    else if (!isLanguageServer)
         {
-        std::wcout << L"You must pass in at least one folder to analyze.\n\n";
-        std::wcout << i18n_string_util::lazy_string_to_wstring(options.help()) << L"\n";
+        out << L"You must pass in at least one folder to analyze.\n\n";
+        out << i18n_string_util::lazy_string_to_wstring(options.help()) << L"\n";
         return 0;
         }
 
-    if (!readBoolOption("quiet", false))
+    // nothing else can be written to stdout when talking to an editor
+    if (!readBoolOption("quiet", false) && !isLanguageServer)
         {
-        std::wcout << L"\n###################################################\n# "
-                   << i18n_string_util::lazy_string_to_wstring(options.program())
-                   << L":\n# Internationalization/localization analysis system\n# (c) 2021-2025 "
-                      L"Blake Madden\n"
-                   << L"###################################################\n\n";
-        std::wcout << L"Searching for files to analyze in " << inputFolder << L"...\n\n";
+        out << L"\n###################################################\n# "
+            << i18n_string_util::lazy_string_to_wstring(options.program())
+            << L":\n# Internationalization/localization analysis system\n# (c) 2021-2025 "
+               L"Blake Madden\n"
+            << L"###################################################\n\n";
+        out << L"Searching for files to analyze in " << inputFolder << L"...\n\n";
         }
 
     std::vector<std::string> providedIgnoredPaths{
@@ -151,15 +471,29 @@ int main(int argc, char* argv[])
     std::vector<fs::path> providedIgnoredPathsWidened;
     for (const auto& iPath : providedIgnoredPaths)
         {
-        providedIgnoredPathsWidened.push_back(i18n_string_util::lazy_string_to_wstring(iPath));
+        fs::path ignoredPath{ i18n_string_util::lazy_string_to_wstring(iPath) };
+        // paths not found relative to the working directory are relative to the input folder
+        if (auto resolvedPath = resolvePath(ignoredPath); fs::exists(resolvedPath))
+            {
+            ignoredPath = std::move(resolvedPath);
+            }
+        providedIgnoredPathsWidened.push_back(std::move(ignoredPath));
         }
-    // paths being ignored
-    const auto excludedInfo =
-        i18n_check::get_paths_files_to_exclude(inputFolder, providedIgnoredPathsWidened);
+    const auto fileSearchStartTime{ std::chrono::high_resolution_clock::now() };
 
-    // input folder
-    const auto filesToAnalyze = i18n_check::get_files_to_analyze(
-        inputFolder, excludedInfo.m_excludedPaths, excludedInfo.m_excludedFiles);
+    std::vector<fs::path> filesToAnalyze;
+    if (!isLanguageServer)
+        {
+        // paths being ignored
+        const auto excludedInfo =
+            i18n_check::get_paths_files_to_exclude(inputFolder, providedIgnoredPathsWidened);
+
+        // input folder
+        filesToAnalyze = i18n_check::get_files_to_analyze(
+            inputFolder, excludedInfo.m_excludedPaths, excludedInfo.m_excludedFiles);
+        }
+
+    const auto reviewerSetupStartTime{ std::chrono::high_resolution_clock::now() };
 
     const auto setSourceParserInfo = [&readBoolOption, &readIntOption](auto& parser)
     {
@@ -170,6 +504,11 @@ int main(int argc, char* argv[])
         parser.set_min_words_for_classifying_unavailable_string(
             readIntOption("min-l10n-wordcount", 2));
         parser.set_min_cpp_version(readIntOption("cpp-version", 2014));
+        // the debug messages are only displayed with verbose output
+        parser.set_log_level(readBoolOption("verbose", false) ?
+                                 i18n_check::i18n_review::log_level::diagnostics :
+                                 i18n_check::i18n_review::log_level::none);
+        parser.set_error_log_limit(static_cast<size_t>(std::max(readIntOption("log-limit", 0), 0)));
     };
 
     i18n_check::cpp_i18n_review cpp(readBoolOption("verbose", false));
@@ -308,9 +647,9 @@ int main(int argc, char* argv[])
                 }
             else
                 {
-                std::wcout << L"Unknown option passed to --enable: "
-                           << i18n_string_util::lazy_string_to_wstring(r) << L"\n\n"
-                           << i18n_string_util::lazy_string_to_wstring(options.help()) << L"\n";
+                out << L"Unknown option passed to --enable: "
+                    << i18n_string_util::lazy_string_to_wstring(r) << L"\n\n"
+                    << i18n_string_util::lazy_string_to_wstring(options.help()) << L"\n";
                 return 1;
                 }
             }
@@ -444,9 +783,9 @@ int main(int argc, char* argv[])
                 }
             else
                 {
-                std::wcout << L"Unknown option passed to --disable: "
-                           << i18n_string_util::lazy_string_to_wstring(r) << L"\n\n"
-                           << i18n_string_util::lazy_string_to_wstring(options.help()) << L"\n";
+                out << L"Unknown option passed to --disable: "
+                    << i18n_string_util::lazy_string_to_wstring(r) << L"\n\n"
+                    << i18n_string_util::lazy_string_to_wstring(options.help()) << L"\n";
                 return 1;
                 }
             }
@@ -456,51 +795,215 @@ int main(int argc, char* argv[])
         rc.set_style(static_cast<i18n_check::review_style>(rs));
         }
 
+    // keep the reviewers (and their compiled rules) warm,
+    // and reanalyze each open document as it is edited
+    if (isLanguageServer)
+        {
+        i18n_check::batch_analyze analyzer(&cpp, &rc, &po, &csharp);
+        return i18n_check::language_server(analyzer).run(std::cin, std::cout);
+        }
+
     const bool isQuiet{ readBoolOption("quiet", false) };
-    i18n_check::batch_analyze analyzer(&cpp, &rc, &po, &csharp);
-    analyzer.analyze(
-        filesToAnalyze, [](const size_t) {},
-        [&filesToAnalyze, isQuiet](const size_t currentFileIndex, const fs::path& file)
+#ifdef QUNEIFORM_REGEX_PROFILING
+    // only include this request's evaluations if running as a server
+    i18n_check::regex_profiler::reset();
+#endif
+    // likewise, the prefilter counters are shared by all requests
+    i18n_check::i18n_review::reset_regex_prefilter_statistics();
+    const auto analysisStartTime{ std::chrono::high_resolution_clock::now() };
+
+    // if running as a server, see if nothing has changed since the last time
+    // this request was made (and just reuse those results if so)
+    std::vector<std::string> requestArguments;
+    std::vector<file_stamp> fileStamps;
+    const cached_report* cachedReport{ nullptr };
+    if (cache != nullptr)
+        {
+        requestArguments.assign(std::next(argv), std::next(argv, argc));
+        fileStamps = get_file_stamps(filesToAnalyze);
+        const auto cachePos =
+            std::find_if(cache->begin(), cache->end(), [&workingDirectory](const auto& report)
+                         { return report.m_directory == workingDirectory; });
+        if (cachePos != cache->end() && cachePos->m_arguments == requestArguments &&
+            cachePos->m_files == fileStamps)
+            {
+            cache->splice(cache->begin(), *cache, cachePos);
+            cachedReport = &cache->front();
+            }
+        }
+
+    // the report is streamed from the analyzer (or the server's cache) to its destination
+    // when it is written below, so that it doesn't need to be held in memory
+    std::optional<i18n_check::batch_analyze> analyzer;
+    const std::wstring* reportText{ nullptr };
+    std::wstring summaryText;
+    const bool verbose{ readBoolOption("verbose", false) };
+    if (cachedReport != nullptr)
+        {
+        if (!isQuiet)
+            {
+            out << L"No changes since the previous request, reusing its results.\n";
+            }
+        reportText = &cachedReport->m_report;
+        summaryText = cachedReport->m_summary;
+        }
+    else
         {
-            if (!isQuiet)
+        analyzer.emplace(&cpp, &rc, &po, &csharp);
+        analyzer->retain_file_text(readBoolOption("retain-file-text", false));
+        analyzer->set_memory_limit(
+            static_cast<size_t>(std::max(readIntOption("memory-limit", 0), 0)) * 1024 * 1024);
+        analyzer->analyze(
+            filesToAnalyze, [](const size_t) {},
+            [&filesToAnalyze, &out, isQuiet](const size_t currentFileIndex, const fs::path& file)
+            {
+                if (!isQuiet)
+                    {
+                    out << L"Examining " << currentFileIndex << L" of " << filesToAnalyze.size()
+                        << L" files (" << file.filename() << L")\n";
+                    }
+                return true;
+            });
+
+        summaryText = analyzer->format_summary(true).str();
+
+        // the server needs to keep the report's text for later requests
+        if (cache != nullptr)
+            {
+            // (replacing this directory's previous report, and dropping the least recently
+            // used one if there are too many)
+            std::erase_if(*cache, [&workingDirectory](const auto& report)
+                          { return report.m_directory == workingDirectory; });
+            cache->push_front(cached_report{ workingDirectory, std::move(requestArguments),
+                                             std::move(fileStamps),
+                                             analyzer->format_results(verbose).str(),
+                                             summaryText });
+            if (cache->size() > max_cached_reports)
                 {
-                std::wcout << L"Examining " << currentFileIndex << L" of " << filesToAnalyze.size()
-                           << L" files (" << file.filename() << L")\n";
+                cache->pop_back();
                 }
-            return true;
-        });
+            reportText = &cache->front().m_report;
+            analyzer.reset();
+            }
+        }
 
-    const std::wstringstream report = analyzer.format_results(readBoolOption("verbose", false));
+    const auto analysisEndTime{ std::chrono::high_resolution_clock::now() };
 
-    // write the output to file (if requested)
-    if (result.count("output"))
-        {
-        fs::path outPath{ result["output"].as<std::string>() };
-        std::ofstream ofs(outPath);
+    const auto writeReport = [&analyzer, reportText, verbose](std::wostream& reportStream)
+    {
+        if (analyzer)
+            {
+            analyzer->format_results(reportStream, verbose);
+            }
+        else if (reportText != nullptr)
+            {
+            reportStream << *reportText;
+            }
+    };
 
-        // write the results report in UTF-8
-        std::string utf8Str;
-        const auto resText = report.str();
-        if constexpr (sizeof(wchar_t) == sizeof(uint16_t))
+    // compare against (or record) the previously accepted warnings,
+    // one row of the report at a time
+    std::wstringstream baselineInfo;
+    bool hasNewWarnings{ false };
+    const auto writeBaselineReport = [&](std::wostream& reportStream)
+    {
+        const fs::path baselinePath{ resolvePath(result["baseline"].as<std::string>()) };
+        i18n_check::warning_baseline baseline(fs::is_directory(inputFolder) ?
+                                                  inputFolder :
+                                                  inputFolder.parent_path());
+        const bool createBaseline{ !fs::exists(baselinePath) };
+        if (!createBaseline && !baseline.load(baselinePath))
             {
-            utf8::utf16to8(resText.cbegin(), resText.cend(), std::back_inserter(utf8Str));
+            writeReport(reportStream);
+            baselineInfo << L"\nUnable to read baseline file: " << baselinePath << L"\n";
+            return;
             }
-        else if constexpr (sizeof(wchar_t) == sizeof(uint32_t))
+
+        size_t warningCount{ 0 };
+        size_t newWarningCount{ 0 };
+        i18n_check::report_reader reader{
+            [&](i18n_check::report_row&& warning)
+            {
+                ++warningCount;
+                if (createBaseline)
+                    {
+                    baseline.add(warning);
+                    }
+                // only report the warnings that aren't in the baseline
+                else if (baseline.check(warning))
+                    {
+                    ++newWarningCount;
+                    }
+                else
+                    {
+                    return;
+                    }
+                reportStream << warning.m_text << L"\n";
+            },
+            [&reportStream](const std::wstring& header) { reportStream << header << L"\n"; }
+        };
+        std::wostream rowStream{ &reader };
+        writeReport(rowStream);
+        reader.finish();
+
+        if (createBaseline)
             {
-            utf8::utf32to8(resText.cbegin(), resText.cend(), std::back_inserter(utf8Str));
+            if (baseline.save(baselinePath))
+                {
+                baselineInfo << L"\nBaseline of " << baseline.size() << L" warning(s) written to "
+                             << baselinePath << L"\n";
+                }
+            else
+                {
+                baselineInfo << L"\nUnable to write baseline file: " << baselinePath << L"\n";
+                }
+            return;
             }
 
-        if (outPath.extension().compare(L"csv") == 0)
+        hasNewWarnings = (newWarningCount > 0);
+        baselineInfo << L"\n"
+                     << newWarningCount << L" new warning(s) not found in the baseline ("
+                     << (warningCount - newWarningCount)
+                     << L" accepted warning(s) suppressed).\n";
+        const auto removedWarnings = baseline.get_removed_warnings();
+        if (!removedWarnings.empty())
             {
-            string_util::replace_all<std::string>(utf8Str, "\t", ",");
+            baselineInfo << removedWarnings.size()
+                         << L" warning(s) from the baseline are no longer found "
+                            L"(delete the baseline file and rerun to update it):\n";
+            for (const auto& removedWarning : removedWarnings)
+                {
+                baselineInfo << L"  " << removedWarning << L"\n";
+                }
             }
+    };
+
+    const auto writeOutput = [&](std::wostream& reportStream)
+    {
+        if (result.count("baseline") > 0)
+            {
+            writeBaselineReport(reportStream);
+            }
+        else
+            {
+            writeReport(reportStream);
+            }
+        reportStream.flush();
+    };
 
-        ofs << utf8Str;
+    // write the output to file (if requested) in UTF-8...
+    if (result.count("output"))
+        {
+        const fs::path outPath{ resolvePath(result["output"].as<std::string>()) };
+        std::ofstream ofs(outPath);
+        utf8_output_buffer utf8Buffer{ ofs, outPath.extension().compare(L"csv") == 0 };
+        std::wostream fileStream{ &utf8Buffer };
+        writeOutput(fileStream);
         }
     // ...otherwise, send it to the console
     else
         {
-        std::wcout << report.str();
+        writeOutput(out);
         }
 
     if (!readBoolOption("quiet", false))
@@ -509,21 +1012,82 @@ int main(int argc, char* argv[])
 
         if (std::chrono::duration_cast<std::chrono::seconds>(endTime - startTime).count() < 1)
             {
-            std::wcout << L"\nFinished in "
-                       << std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime)
-                              .count()
-                       << L" milliseconds.\n\n";
+            out << L"\nFinished in "
+                << std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime)
+                       .count()
+                << L" milliseconds.\n\n";
             }
         else
             {
-            std::wcout
-                << L"\nFinished in "
+            out << L"\nFinished in "
                 << std::chrono::duration_cast<std::chrono::seconds>(endTime - startTime).count()
                 << L" seconds.\n\n";
             }
 
-        std::wcout << analyzer.format_summary(true).str();
+        out << summaryText;
+        }
+
+    out << baselineInfo.str();
+
+    if (readBoolOption("timings", false))
+        {
+        const auto toMilliseconds = [](const auto& start, const auto& end)
+        { return std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count(); };
+
+        out << L"\nTimings (milliseconds):\n"
+            << L"  Building rule tables (cold start): "
+            << i18n_check::i18n_review::get_rule_tables_build_time().count() << L"\n"
+            << L"  Setting up reviewers (includes rule tables): "
+            << toMilliseconds(reviewerSetupStartTime, analysisStartTime) << L"\n"
+            << L"  Searching for files: "
+            << toMilliseconds(fileSearchStartTime, reviewerSetupStartTime) << L"\n"
+            << L"  Analyzing files: "
+            << toMilliseconds(analysisStartTime, analysisEndTime) << L"\n"
+            << L"  Total: "
+            << toMilliseconds(startTime, std::chrono::high_resolution_clock::now())
+            << L"\n\n";
+        }
+
+    if (readBoolOption("verbose", false))
+        {
+        const auto prefilterStatistics{
+            i18n_check::i18n_review::get_regex_prefilter_statistics()
+        };
+        out << L"\nRegular expression prefilters:\n"
+            << L"  Skipped (first character can't match): "
+            << prefilterStatistics.m_first_character_skips << L"\n"
+            << L"  Skipped (required text not found): " << prefilterStatistics.m_literal_skips
+            << L"\n"
+            << L"  Evaluated: " << prefilterStatistics.m_regex_evaluations << L"\n\n";
+        }
+
+    if (readBoolOption("profile", false))
+        {
+#ifdef QUNEIFORM_REGEX_PROFILING
+        out << L"\nRegular expressions (run with "
+            << i18n_check::regex_pattern::get_engine_name() << L", most expensive first):\n"
+            << L"Time (ms)\tCalls\tMatches\tRule\n";
+        for (const auto& rule : i18n_check::regex_profiler::get_ranked_statistics())
+            {
+            out << std::fixed << std::setprecision(3)
+                << std::chrono::duration<double, std::milli>(rule.m_time).count() << L"\t"
+                << rule.m_invocations << L"\t"
+                << (rule.m_reports_matches ? std::to_wstring(rule.m_matches) : L"-") << L"\t"
+                << rule.m_name << L"\n";
+            }
+        out << L"\n";
+#else
+        out << L"\nRegular expression profiling is not available in this build "
+               L"(configure it with -DQUNEIFORM_REGEX_PROFILING=ON).\n\n";
+#endif
         }
 
-    return 0;
+    // new warnings (compared to the baseline) are treated as a failure
+    return hasNewWarnings ? 1 : 0;
+    }
+
+//-------------------------------------------------
+int main(int argc, char* argv[])
+    {
+    return run_quneiform(argc, argv, std::wcout, fs::path{}, nullptr);
     }
@@ -0,0 +1,298 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+/** @addtogroup Internationalization
+    @brief i18n classes.
+@{*/
+
+#ifndef __NAME_TABLE_H__
+#define __NAME_TABLE_H__
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cwctype>
+#include <functional>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace i18n_check
+    {
+    /** @brief A fixed set of names (e.g., functions or keywords), stored in a flat hash table.
+        @details The names are hashed into a single array (open addressing, with linear
+            probing) that is at most half full, so a lookup is usually one hash and
+            one string comparison. Each slot also stores its name's hash, so a
+            probe only compares the strings if their hashes are the same.
+        @note The names are not copied, so they must remain valid while the table
+            is being used (e.g., string literals).*/
+    class name_table
+        {
+      public:
+        /// @brief Constructs an empty table.
+        name_table() = default;
+
+        /// @brief Constructs a table from a list of names.
+        /// @param names The names (duplicates are ignored).
+        name_table(std::initializer_list<std::wstring_view> names)
+            {
+            // keep the table no more than half full so that the probe sequences stay short
+            m_slots.resize(std::bit_ceil(std::max<size_t>(names.size() * 2, 8)));
+            for (const auto& name : names)
+                {
+                insert(name);
+                }
+            }
+
+        /// @returns @c true if a name is in the table.
+        /// @param name The name to look for.
+        [[nodiscard]]
+        bool contains(std::wstring_view name) const noexcept
+            {
+            if (m_size == 0)
+                {
+                return false;
+                }
+            const size_t nameHash{ hash(name) };
+            for (size_t i = nameHash & (m_slots.size() - 1); /* in loop*/;
+                 i = (i + 1) & (m_slots.size() - 1))
+                {
+                const slot& current{ m_slots[i] };
+                if (current.m_name.data() == nullptr)
+                    {
+                    return false;
+                    }
+                if (current.m_hash == nameHash && current.m_name == name)
+                    {
+                    return true;
+                    }
+                }
+            }
+
+        /// @returns The number of names in the table.
+        [[nodiscard]]
+        size_t size() const noexcept
+            {
+            return m_size;
+            }
+
+        /// @returns The (FNV-1a) hash of a name.
+        /// @param name The name to hash.
+        [[nodiscard]]
+        static size_t hash(std::wstring_view name) noexcept
+            {
+            uint64_t nameHash{ 14'695'981'039'346'656'037ULL };
+            for (const wchar_t character : name)
+                {
+                nameHash ^= static_cast<uint64_t>(character);
+                nameHash *= 1'099'511'628'211ULL;
+                }
+            return static_cast<size_t>(nameHash);
+            }
+
+      private:
+        struct slot
+            {
+            // an empty slot's name has no data (an empty name's does)
+            std::wstring_view m_name{};
+            size_t m_hash{ 0 };
+            };
+
+        void insert(std::wstring_view name)
+            {
+            const size_t nameHash{ hash(name) };
+            for (size_t i = nameHash & (m_slots.size() - 1); /* in loop*/;
+                 i = (i + 1) & (m_slots.size() - 1))
+                {
+                slot& current{ m_slots[i] };
+                if (current.m_name.data() == nullptr)
+                    {
+                    current.m_name = name.data() != nullptr ? name : std::wstring_view{ L"" };
+                    current.m_hash = nameHash;
+                    ++m_size;
+                    return;
+                    }
+                if (current.m_hash == nameHash && current.m_name == name)
+                    {
+                    return;
+                    }
+                }
+            }
+
+        std::vector<slot> m_slots;
+        size_t m_size{ 0 };
+        };
+
+    /** @brief A shared set of built-in names, along with the names that a client added to it.
+        @details Lookups check the built-in table first, and then the client's additions
+            (which are usually empty).\n
+            Unlike the built-in names, added names are copied.*/
+    class extendable_name_table
+        {
+      public:
+        /// @brief Constructs an empty table.
+        extendable_name_table() = default;
+
+        /// @brief Constructor.
+        /// @param builtIn The built-in names. This table is not copied,
+        ///     so it must remain valid while this object is being used.
+        explicit extendable_name_table(const name_table& builtIn) : m_built_in(&builtIn) {}
+
+        /// @brief Adds a name.
+        /// @param name The name to add.
+        void add(std::wstring_view name)
+            {
+            if (!contains(name))
+                {
+                m_additions.emplace(name);
+                }
+            }
+
+        /// @returns @c true if a name is a built-in name or was added.
+        /// @param name The name to look for.
+        [[nodiscard]]
+        bool contains(std::wstring_view name) const
+            {
+            return (m_built_in != nullptr && m_built_in->contains(name)) ||
+                   (!m_additions.empty() && m_additions.find(name) != m_additions.cend());
+            }
+
+      private:
+        struct name_hash
+            {
+            using is_transparent = void;
+
+            [[nodiscard]]
+            size_t operator()(std::wstring_view name) const noexcept
+                {
+                return name_table::hash(name);
+                }
+            };
+
+        const name_table* m_built_in{ nullptr };
+        std::unordered_set<std::wstring, name_hash, std::equal_to<>> m_additions;
+        };
+
+    /** @brief A set of names that are compared case insensitively (e.g., font names).
+        @details The names are hashed by their lowercased characters, so a lookup
+            is one hash and (usually) one comparison, and any string view can be
+            looked up without being copied.\n
+            Lowercasing uses the C runtime for non-ASCII characters only; ASCII characters
+            (which most names and strings are) are converted directly.
+        @note Unlike name_table, the names are copied.*/
+    class case_insensitive_name_set
+        {
+      public:
+        /// @brief Constructs an empty set.
+        case_insensitive_name_set() = default;
+
+        /// @brief Constructs a set from a list of names.
+        /// @param names The names (duplicates, ignoring case, are ignored).
+        case_insensitive_name_set(std::initializer_list<std::wstring_view> names)
+            {
+            m_names.reserve(names.size());
+            for (const auto& name : names)
+                {
+                add(name);
+                }
+            }
+
+        /// @brief Adds a name.
+        /// @param name The name to add.
+        void add(std::wstring_view name)
+            {
+            if (!contains(name))
+                {
+                m_names.emplace(name);
+                }
+            }
+
+        /// @returns @c true if a name (ignoring case) is in the set.
+        /// @param name The name to look for.
+        [[nodiscard]]
+        bool contains(std::wstring_view name) const
+            {
+            return m_names.find(name) != m_names.cend();
+            }
+
+        /// @returns The number of names in the set.
+        [[nodiscard]]
+        size_t size() const noexcept
+            {
+            return m_names.size();
+            }
+
+        /// @returns A character converted to lowercase.
+        /// @param character The character to convert.
+        [[nodiscard]]
+        static wchar_t fold(const wchar_t character) noexcept
+            {
+            if (character < 0x80)
+                {
+                return (character >= L'A' && character <= L'Z') ?
+                           static_cast<wchar_t>(character + (L'a' - L'A')) :
+                           character;
+                }
+            return static_cast<wchar_t>(std::towlower(static_cast<wint_t>(character)));
+            }
+
+      private:
+        struct folded_hash
+            {
+            using is_transparent = void;
+
+            [[nodiscard]]
+            size_t operator()(std::wstring_view name) const noexcept
+                {
+                // FNV-1a, the same as name_table::hash(), but of the lowercased characters
+                uint64_t nameHash{ 14'695'981'039'346'656'037ULL };
+                for (const wchar_t character : name)
+                    {
+                    nameHash ^= static_cast<uint64_t>(fold(character));
+                    nameHash *= 1'099'511'628'211ULL;
+                    }
+                return static_cast<size_t>(nameHash);
+                }
+            };
+
+        struct folded_equal
+            {
+            using is_transparent = void;
+
+            [[nodiscard]]
+            bool operator()(std::wstring_view lhs, std::wstring_view rhs) const noexcept
+                {
+                if (lhs.length() != rhs.length())
+                    {
+                    return false;
+                    }
+                for (size_t i = 0; i < lhs.length(); ++i)
+                    {
+                    if (lhs[i] != rhs[i] && fold(lhs[i]) != fold(rhs[i]))
+                        {
+                        return false;
+                        }
+                    }
+                return true;
+                }
+            };
+
+        std::unordered_set<std::wstring, folded_hash, folded_equal> m_names;
+        };
+    } // namespace i18n_check
+
+/** @}*/
+
+#endif //__NAME_TABLE_H__
@@ -11,14 +11,110 @@
  *   Blake Madden - initial implementation
  ********************************************************************************/
 #include "po_file_review.h"
+#include <algorithm>
+#include <array>
+#include <optional>
 
 namespace i18n_check
     {
+    namespace
+        {
+        /// @brief The messages read from a catalog entry.
+        enum po_message_type
+            {
+            po_msgctxt,
+            po_msgid,
+            po_msgid_plural,
+            po_msgstr,
+            po_msgstr0,
+            po_msgstr1,
+            po_message_count
+            };
+
+        /// @returns The type of message that a line starts (or @c po_message_count if not
+        ///     one), and where the message's text (after its opening quote) starts in the line.
+        std::pair<po_message_type, size_t> classify_po_message_line(const std::wstring_view line)
+            {
+            const size_t tagStart{ line.find_first_not_of(L" \t") };
+            if (tagStart == std::wstring_view::npos || line[tagStart] != L'm')
+                {
+                return { po_message_count, 0 };
+                }
+            const std::wstring_view tagText{ line.substr(tagStart) };
+            for (const auto& [tag, messageType] :
+                 { std::make_pair(std::wstring_view{ L"msgctxt \"" }, po_msgctxt),
+                   std::make_pair(std::wstring_view{ L"msgid \"" }, po_msgid),
+                   std::make_pair(std::wstring_view{ L"msgid_plural \"" }, po_msgid_plural),
+                   std::make_pair(std::wstring_view{ L"msgstr \"" }, po_msgstr),
+                   std::make_pair(std::wstring_view{ L"msgstr[0] \"" }, po_msgstr0),
+                   std::make_pair(std::wstring_view{ L"msgstr[1] \"" }, po_msgstr1) })
+                {
+                if (tagText.starts_with(tag))
+                    {
+                    return { messageType, tagStart + tag.length() };
+                    }
+                }
+            return { po_message_count, 0 };
+            }
+
+        /// @returns @c true if the text after a "#, " is a list of flags
+        ///     (i.e., only contains lowercase letters, hyphens, commas, and spaces).
+        bool is_format_flags_line(const std::wstring_view flags)
+            {
+            return !flags.empty() && std::all_of(flags.cbegin(), flags.cend(),
+                                                 [](const wchar_t chr)
+                                                 {
+                                                     return (chr >= L'a' && chr <= L'z') ||
+                                                            chr == L'-' || chr == L',' ||
+                                                            chr == L' ';
+                                                 });
+            }
+
+        /// @brief Reads the flags (e.g., "fuzzy, c-format") from a "#, " line.
+        void read_format_flags(std::wstring_view flags, const bool reviewFuzzy,
+                               po_format_string& pofs, bool& formatSpecFound, bool& isFuzzy)
+            {
+            while (!flags.empty())
+                {
+                const size_t flagEnd{ std::min(flags.find_first_of(L" ,"), flags.length()) };
+                std::wstring_view formatFlag{ flags.substr(0, flagEnd) };
+                flags.remove_prefix(std::min(flagEnd + 1, flags.length()));
+                // hyphens at the ends of a flag aren't part of it (e.g., "-c-format")
+                const size_t firstLetter{ formatFlag.find_first_not_of(L'-') };
+                if (firstLetter == std::wstring_view::npos)
+                    {
+                    continue;
+                    }
+                formatFlag = formatFlag.substr(
+                    firstLetter, formatFlag.find_last_not_of(L'-') - firstLetter + 1);
+
+                if (formatFlag == L"c-format" || formatFlag == L"cpp-format")
+                    {
+                    pofs = po_format_string::cpp_format;
+                    formatSpecFound = true;
+                    }
+                else if (formatFlag == L"qt-format" || formatFlag == L"qt-plural-format" ||
+                         formatFlag == L"kde-format")
+                    {
+                    pofs = po_format_string::qt_format;
+                    formatSpecFound = true;
+                    }
+                else if (!reviewFuzzy && formatFlag == _DT(L"fuzzy"))
+                    {
+                    pofs = po_format_string::no_format;
+                    formatSpecFound = true;
+                    isFuzzy = true;
+                    break;
+                    }
+                }
+            }
+        } // namespace
+
     //------------------------------------------------
     void po_file_review::operator()(std::wstring_view poFileText,
                                     const std::filesystem::path& fileName)
         {
-        m_file_name = fileName;
+        m_file_id = m_file_table.add(fileName);
 
         const std::wstring_view originalPoFileText{ poFileText };
 
@@ -27,31 +123,7 @@ namespace i18n_check
             return;
             }
 
-        static const std::wstring_view MSGID{ L"msgid \"" };
-        static const std::wstring_view MSGID_PLURAL{ L"msgid_plural \"" };
-        static const std::wstring_view MSGSTR{ L"msgstr \"" };
-        static const std::wstring_view MSGSTR0{ L"msgstr[0] \"" };
-        static const std::wstring_view MSGSTR1{ L"msgstr[1] \"" };
-        static const std::wstring_view MSGCTXT{ L"msgctxt \"" };
-        // type of printf formatting the string uses, and its fuzzy status
-        static const std::wregex entryLineRegEx{ LR"(^#, ([,a-z \-]+)+$)",
-        // MSVC doesn't have the std::regex::multiline flag, but behaves like multiline implicitly.
-        // GCC and Clang require this flag though.
-#ifdef _MSC_VER
-                                                 std::regex::ECMAScript };
-#else
-                                                 std::regex::ECMAScript | std::regex::multiline };
-#endif
-        // translator comments, where they go to the end of the line
-        static const std::wregex commentLineRegEx{ LR"(^#[.] ([^\n\r]+)+$)" };
-
-        // captures the "no-" prefix (in case it's in there) so that we know
-        // to ignore this entry later
-        static const std::wregex printfResourceRegEx{ LR"(\b([a-zA-Z\-])+\b)" };
-
-        std::vector<std::wstring> entryLines;
-        std::vector<std::wstring> commentLines;
-        std::vector<std::wstring> formatFlags;
+        m_line_index.assign(originalPoFileText);
 
         size_t currentPos{ 0 };
 
@@ -73,6 +145,9 @@ namespace i18n_check
             currentPos = newLinePos + 1;
             }
 
+        translation_catalog& catalog{ m_catalogs.emplace_back() };
+        catalog.m_file_id = m_file_id;
+
         while (!poFileText.empty())
             {
             auto [entryFound, entry, entryPos] = read_po_catalog_entry(poFileText);
@@ -85,103 +160,96 @@ namespace i18n_check
             // update the position in the original text of where this entry is
             currentPos += entryPos + entry.length();
 
-            // load information about the string's fuzzy status and its printf format
-            entryLines.clear();
-            std::copy(std::regex_token_iterator<decltype(entry)::const_iterator>(
-                          entry.cbegin(), entry.cend(), entryLineRegEx, 1),
-                      std::regex_token_iterator<decltype(entry)::const_iterator>{},
-                      std::back_inserter(entryLines));
-
+            // Read the entry's lines in one pass, loading the string's fuzzy status and its
+            // printf format (from the first "#," line that has them), translator comments,
+            // context, source strings, and translations.
             po_format_string pofs{ po_format_string::no_format };
             bool formatSpecFound{ false };
             bool isFuzzy{ false };
-            for (const auto& entryLine : entryLines)
+            // If a comment is multiline in the source code, then it gets separate "#." entries
+            // in the PO file. These need to be pieced back together into one string.
+            std::wstring comment;
+            std::array<std::optional<std::wstring_view>, po_message_count> messages;
+
+            size_t linePos{ 0 };
+            while (linePos < entry.length())
                 {
-                formatFlags.clear();
-                std::copy(std::regex_token_iterator<std::wstring::const_iterator>(
-                              entryLine.cbegin(), entryLine.cend(), printfResourceRegEx, 0),
-                          std::regex_token_iterator<std::wstring::const_iterator>{},
-                          std::back_inserter(formatFlags));
-                for (const auto& formatFlag : formatFlags)
+                size_t lineEnd = entry.find_first_of(L"\r\n", linePos);
+                if (lineEnd == std::wstring_view::npos)
                     {
-                    if (formatFlag == L"c-format" || formatFlag == L"cpp-format")
-                        {
-                        pofs = po_format_string::cpp_format;
-                        formatSpecFound = true;
-                        }
-                    else if (formatFlag == L"qt-format" || formatFlag == L"qt-plural-format" ||
-                        formatFlag == L"kde-format")
-                        {
-                        pofs = po_format_string::qt_format;
-                        formatSpecFound = true;
-                        }
-                    else if (!is_reviewing_fuzzy_translations() && formatFlag == _DT(L"fuzzy"))
+                    lineEnd = entry.length();
+                    }
+                const std::wstring_view line{ entry.substr(linePos, lineEnd - linePos) };
+
+                if (line.starts_with(L"#, "))
+                    {
+                    if (!formatSpecFound && is_format_flags_line(line.substr(3)))
                         {
-                        pofs = po_format_string::no_format;
-                        formatSpecFound = true;
-                        isFuzzy = true;
-                        break;
+                        read_format_flags(line.substr(3), is_reviewing_fuzzy_translations(), pofs,
+                                          formatSpecFound, isFuzzy);
                         }
                     }
-                // stop looking at the comment lines if we loaded a printf specification already
-                if (formatSpecFound)
+                // translator comments, where they go to the end of the line
+                else if (line.starts_with(L"#. ") && line.length() > 3)
                     {
-                    break;
+                    comment.append(line.substr(3)).append(L" ");
                     }
-                }
-
-            // Load any translator comments.
-            // If a comment is multiline in the source code, then it gets separate "#." entries
-            // in the PO file. These need to be pieced back together into one string.
-            commentLines.clear();
-            std::copy(std::regex_token_iterator<decltype(entry)::const_iterator>(
-                          entry.cbegin(), entry.cend(), commentLineRegEx, 1),
-                      std::regex_token_iterator<decltype(entry)::const_iterator>{},
-                      std::back_inserter(commentLines));
-            std::wstring comment = [&commentLines]()
-            {
-                std::wstring fullComment;
-                for (const auto& str : commentLines)
+                // previous and obsolete entries are commented out and are ignored
+                else if (!line.starts_with(L'#'))
                     {
-                    fullComment.append(str).append(L" ");
+                    const auto [messageType, messageOffset] = classify_po_message_line(line);
+                    if (messageType != po_message_count && !messages[messageType])
+                        {
+                        const size_t messageStart{ linePos + messageOffset };
+                        // move past a multiline message's continuation lines
+                        const size_t messageLength{ find_po_msg_end(entry.substr(messageStart)) };
+                        if (messageLength != std::wstring_view::npos)
+                            {
+                            messages[messageType] = entry.substr(messageStart, messageLength);
+                            lineEnd = entry.find_first_of(L"\r\n", messageStart + messageLength);
+                            if (lineEnd == std::wstring_view::npos)
+                                {
+                                lineEnd = entry.length();
+                                }
+                            }
+                        }
                     }
-                string_util::trim(fullComment);
-                return fullComment;
-            }();
+                linePos = lineEnd + 1;
+                }
+
+            string_util::trim(comment);
             // also look for a context string
-            auto [msgCTextFound, msgCText, msgCTextPos, msgCTextLen] = read_po_msg(entry, MSGCTXT);
-            if (msgCTextFound)
+            if (messages[po_msgctxt])
                 {
-                comment.append(msgCText);
+                comment.append(process_po_msg(*messages[po_msgctxt]));
                 }
 
-            // read section from catalog entry
-            auto [msgIdFound, msgId, msgPos, msgLen] = read_po_msg(entry, MSGID);
-            if (!msgIdFound)
+            if (!messages[po_msgid])
                 {
                 continue;
                 }
-            // plural is optional, translations may be one string or two (for plural)
-            auto [msgIdPluralFound, msgPluralId, msgPosPlural, msgPluralLen] =
-                read_po_msg(entry, MSGID_PLURAL);
-            auto [msgStrFound, msgStr, msgStrPos, msgStrLen] = read_po_msg(entry, MSGSTR);
-            auto [msgStr0Found, msg0Str, msgStr0Pos, msgStr0Len] = read_po_msg(entry, MSGSTR0);
-            auto [msgStr1Found, msg1Str, msgStr1Pos, msgStr1Len] = read_po_msg(entry, MSGSTR1);
 
             if (!is_reviewing_fuzzy_translations() && isFuzzy)
                 {
                 continue;
                 }
 
-            get_catalog_entries().push_back(std::make_pair(
-                fileName,
-                translation_catalog_entry{
-                    std::move(msgId), std::move(msgPluralId),
-                    // when there is a plural, then msgstr 0-1 is where the
-                    // singular and plural translations are kept
-                    msgStr.empty() ? std::move(msg0Str) : std::move(msgStr), std::move(msg1Str),
-                    pofs, std::vector<std::pair<translation_issue, std::wstring>>{},
-                    get_line_and_column(currentPos, originalPoFileText).first, comment }));
+            // the catalog's strings are stored together (rather than each being allocated)
+            const auto readMessage = [this, &messages](const po_message_type messageType)
+            {
+                return messages[messageType] ?
+                           m_string_arena.store(process_po_msg(*messages[messageType])) :
+                           std::wstring_view{};
+            };
+
+            const std::wstring_view msgStr{ readMessage(po_msgstr) };
+            catalog.m_entries.push_back(translation_catalog_entry{
+                readMessage(po_msgid), readMessage(po_msgid_plural),
+                // when there is a plural, then msgstr 0-1 is where the
+                // singular and plural translations are kept
+                msgStr.empty() ? readMessage(po_msgstr0) : msgStr, readMessage(po_msgstr1),
+                m_string_arena.store(comment),
+                get_line_and_column(currentPos, originalPoFileText).first, pofs });
             }
         }
     } // namespace i18n_check
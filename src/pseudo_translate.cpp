@@ -167,7 +167,7 @@ namespace i18n_check
             }
 
         // mark the file's encoding as UTF-8
-        const std::wregex CONTENT_TYPE_RE{
+        static const std::wregex CONTENT_TYPE_RE{
             LR"((\r|\n)\"Content-Type:[ ]*text/plain;[ ]*charset[ ]*=[ ]*([a-zA-Z0-9\-]*))"
         };
         std::wsmatch matches;
@@ -177,7 +177,7 @@ namespace i18n_check
             }
 
         // if target language is missing, then set to Esperanto
-        const std::wregex LANG_RE{ LR"((\r|\n)\"Language:[ ]*([a-zA-Z0-9\-]*))" };
+        static const std::wregex LANG_RE{ LR"((\r|\n)\"Language:[ ]*([a-zA-Z0-9\-]*))" };
         if (std::regex_search(poFileText, matches, LANG_RE) && matches.size() >= 3 &&
             matches.length(2) == 0)
             {
@@ -12,246 +12,411 @@
  ********************************************************************************/
 
 #include "rc_file_review.h"
+#include <cwctype>
+#include <optional>
 
 namespace i18n_check
     {
-    void rc_file_review::operator()(const std::wstring_view rcFileText,
-                                    const std::filesystem::path& fileName)
+    namespace
         {
-        m_file_name = fileName;
-
-        if (rcFileText.empty())
+        enum class rc_token_type
             {
-            return;
-            }
+            identifier,
+            number,
+            string,
+            punctuation,
+            end
+            };
 
-        if (static_cast<bool>(get_style() & check_l10n_strings))
+        /// @brief A token from a resource script.
+        struct rc_token
             {
-            /* This regex:
+            rc_token_type m_type{ rc_token_type::end };
+            /// @brief The token's text (for strings, the text between the quotes).
+            std::wstring_view m_text;
+            /// @brief Where the token's text starts in the file.
+            size_t m_position{ 0 };
+
+            [[nodiscard]]
+            bool is_keyword(const std::wstring_view keyword) const noexcept
+                {
+                return m_type == rc_token_type::identifier && m_text == keyword;
+                }
 
-               STRINGTABLE[[:space:]]*(BEGIN|\{)[\n\r]*([[:space:]]*[A-Za-z0-9_]+[,]?[[:space:]]*[L]?"[^\n\r]*[\n\r]*)+(END|\}))
+            [[nodiscard]]
+            bool is_punctuation(const wchar_t chr) const noexcept
+                {
+                return m_type == rc_token_type::punctuation && m_text.front() == chr;
+                }
+            };
 
-               can find a full string table, but causes an error_stack exception with std::regex
-               with some files, so need to more crudely parse string tables by looking for the start
-               and end tags.*/
-            std::vector<std::pair<size_t, std::wstring>> stringTables;
-            const std::wregex stringTableRegEx{
-                LR"(STRINGTABLE[[:space:]]*(BEGIN|\{)[[:space:]]*)"
+        /// @brief A dialog's FONT statement.
+        struct font_entry
+            {
+            size_t m_position{ 0 };
+            std::wstring_view m_size;
+            std::wstring_view m_name;
             };
-            const std::wregex stringTableEndRegEx{ LR"([\r\n]+[[:space:]]*(END|\}))" };
 
-            auto currentTextBlock{ rcFileText };
-            std::match_results<decltype(currentTextBlock)::const_iterator> stPositions;
-            std::match_results<decltype(currentTextBlock)::const_iterator> endPositions;
-            size_t currentBlockOffset{ 0 };
-            while (std::regex_search(currentTextBlock.cbegin(), currentTextBlock.cend(),
-                                     stPositions, stringTableRegEx))
+        /** @brief Splits a resource script into tokens in a single pass, skipping whitespace,
+                comments, and preprocessor directives.
+            @details This is cheap to copy, so copies can be used to look ahead.*/
+        class rc_tokenizer
+            {
+          public:
+            explicit rc_tokenizer(const std::wstring_view text) : m_text(text) {}
+
+            /// @returns The next token, or a token of type @c end at the end of the file.
+            [[nodiscard]]
+            rc_token next()
                 {
-                currentBlockOffset += stPositions.position();
-                currentTextBlock = currentTextBlock.substr(stPositions.position());
-                if (std::regex_search(currentTextBlock.cbegin(), currentTextBlock.cend(),
-                                      endPositions, stringTableEndRegEx))
+                skip_whitespace();
+                if (m_position >= m_text.length())
                     {
-                    stringTables.emplace_back(
-                        currentBlockOffset, currentTextBlock.substr(0, endPositions.position() +
-                                                                           endPositions.length()));
-
-                    currentBlockOffset += endPositions.length();
+                    return rc_token{ rc_token_type::end, std::wstring_view{}, m_text.length() };
+                    }
+                m_at_line_start = false;
 
-                    currentTextBlock = currentTextBlock.substr(endPositions.length());
+                const size_t tokenStart{ m_position };
+                const wchar_t chr{ m_text[m_position] };
+                // "text" or L"text"
+                if (chr == L'"' ||
+                    ((chr == L'L' || chr == L'l') && is_char_at(m_position + 1, L'"')))
+                    {
+                    return read_string();
                     }
-                else
+                if (is_identifier_char(chr))
                     {
-                    break;
+                    // identifiers and numbers (including hex numbers and suffixes, like 0x1FL)
+                    while (m_position < m_text.length() && is_identifier_char(m_text[m_position]))
+                        {
+                        ++m_position;
+                        }
+                    return rc_token{ std::iswdigit(chr) ? rc_token_type::number :
+                                                          rc_token_type::identifier,
+                                     m_text.substr(tokenStart, m_position - tokenStart),
+                                     tokenStart };
                     }
+                ++m_position;
+                return rc_token{ rc_token_type::punctuation, m_text.substr(tokenStart, 1),
+                                 tokenStart };
                 }
 
-            std::vector<std::pair<size_t, std::wstring>> tableEntries;
-            const std::wregex tableEntryRE{ LR"("([^\n\r]*))" };
-            for (std::pair<size_t, std::wstring> sTab : stringTables)
+          private:
+            [[nodiscard]]
+            static bool is_identifier_char(const wchar_t chr)
                 {
-                size_t matchLenghtOffset{ 0 };
-                std::wsmatch tabEntryResults;
-                while (std::regex_search(sTab.second, tabEntryResults, tableEntryRE))
-                    {
-                    tableEntries.emplace_back(sTab.first + tabEntryResults.position(1) +
-                                                  matchLenghtOffset,
-                                              tabEntryResults.str(1));
-                    sTab.second.erase(0, tabEntryResults.position(1) + tabEntryResults.length(1));
-                    matchLenghtOffset += tabEntryResults.position(1) + tabEntryResults.length(1);
-                    }
+                return std::iswalnum(chr) || chr == L'_';
                 }
 
-            // review table entries
-            for (auto& tableEntry : tableEntries)
+            [[nodiscard]]
+            bool is_char_at(const size_t position, const wchar_t chr) const noexcept
                 {
-                // strip off trailing quote
-                if (tableEntry.second.length() > 0)
-                    {
-                    tableEntry.second.pop_back();
-                    }
-                if (is_untranslatable_string(tableEntry.second, false).first)
+                return position < m_text.length() && m_text[position] == chr;
+                }
+
+            void skip_to_line_end()
+                {
+                m_position = m_text.find_first_of(L"\r\n", m_position);
+                if (m_position == std::wstring_view::npos)
                     {
-                    m_unsafe_localizable_strings.emplace_back(
-                        tableEntry.second,
-                        string_info::usage_info(string_info::usage_info::usage_type::orphan,
-                                                std::wstring{}, std::wstring{}),
-                        m_file_name,
-                        std::make_pair(get_line_and_column(tableEntry.first, rcFileText).first,
-                                       std::wstring::npos));
+                    m_position = m_text.length();
                     }
-                else
+                }
+
+            void skip_whitespace()
+                {
+                while (m_position < m_text.length())
                     {
-                    m_localizable_strings.emplace_back(
-                        tableEntry.second,
-                        string_info::usage_info(string_info::usage_info::usage_type::orphan,
-                                                std::wstring{}, std::wstring{}),
-                        m_file_name,
-                        std::make_pair(get_line_and_column(tableEntry.first, rcFileText).first,
-                                       std::wstring::npos));
+                    const wchar_t chr{ m_text[m_position] };
+                    if (chr == L'\n' || chr == L'\r')
+                        {
+                        m_at_line_start = true;
+                        ++m_position;
+                        }
+                    else if (std::iswspace(chr))
+                        {
+                        ++m_position;
+                        }
+                    else if (chr == L'/' && is_char_at(m_position + 1, L'/'))
+                        {
+                        skip_to_line_end();
+                        }
+                    else if (chr == L'/' && is_char_at(m_position + 1, L'*'))
+                        {
+                        const size_t commentEnd{ m_text.find(L"*/", m_position + 2) };
+                        m_position = (commentEnd == std::wstring_view::npos) ? m_text.length() :
+                                                                               commentEnd + 2;
+                        }
+                    // preprocessor directives (with any line continuations)
+                    else if (chr == L'#' && m_at_line_start)
+                        {
+                        skip_to_line_end();
+                        while (m_position > 0 && m_text[m_position - 1] == L'\\' &&
+                               m_position < m_text.length())
+                            {
+                            m_position += (m_text.substr(m_position, 2) == L"\r\n") ? 2 : 1;
+                            skip_to_line_end();
+                            }
+                        }
+                    else
+                        {
+                        break;
+                        }
                     }
+                }
 
-                if (m_review_styles & check_l10n_contains_url)
+            /// @brief Reads a string literal, where quotes are escaped by doubling them
+            ///     (or with a backslash). An unterminated string ends at the end of its line.
+            [[nodiscard]]
+            rc_token read_string()
+                {
+                m_position = m_text.find(L'"', m_position) + 1;
+                const size_t contentStart{ m_position };
+                while (m_position < m_text.length())
                     {
-                    std::wsmatch results;
-                    if (std::regex_search(tableEntry.second, results, m_url_email_regex))
+                    const wchar_t chr{ m_text[m_position] };
+                    if (chr == L'\r' || chr == L'\n')
                         {
-                        m_localizable_strings_with_urls.emplace_back(
-                            tableEntry.second,
-                            string_info::usage_info(string_info::usage_info::usage_type::orphan,
-                                                    std::wstring{}, std::wstring{}),
-                            m_file_name,
-                            std::make_pair(get_line_and_column(tableEntry.first, rcFileText).first,
-                                           std::wstring::npos));
+                        return rc_token{ rc_token_type::string,
+                                         m_text.substr(contentStart, m_position - contentStart),
+                                         contentStart };
+                        }
+                    if (chr == L'\\' && m_position + 1 < m_text.length() &&
+                        m_text[m_position + 1] != L'\r' && m_text[m_position + 1] != L'\n')
+                        {
+                        m_position += 2;
+                        }
+                    else if (chr == L'"' && is_char_at(m_position + 1, L'"'))
+                        {
+                        m_position += 2;
+                        }
+                    else if (chr == L'"')
+                        {
+                        ++m_position;
+                        return rc_token{ rc_token_type::string,
+                                         m_text.substr(contentStart, m_position - 1 - contentStart),
+                                         contentStart };
+                        }
+                    else
+                        {
+                        ++m_position;
                         }
                     }
+                return rc_token{ rc_token_type::string, m_text.substr(contentStart),
+                                 contentStart };
+                }
+
+            std::wstring_view m_text;
+            size_t m_position{ 0 };
+            bool m_at_line_start{ true };
+            };
+        } // namespace
+
+    //------------------------------------------------
+    void rc_file_review::operator()(const std::wstring_view rcFileText,
+                                    const std::filesystem::path& fileName)
+        {
+        m_file_id = m_file_table.add(fileName);
+        m_retained_file_text = std::wstring_view{};
 
-                if (m_review_styles & check_l10n_contains_excessive_nonl10n_content)
+        if (rcFileText.empty())
+            {
+            return;
+            }
+
+        m_line_index.assign(rcFileText);
+
+        const bool reviewStrings{ static_cast<bool>(get_style() & check_l10n_strings) };
+        const bool reviewFonts{ static_cast<bool>(get_style() & check_fonts) };
+        if (!reviewStrings && !reviewFonts)
+            {
+            return;
+            }
+
+        // Read the string tables and dialog fonts in one pass over the file.
+        // (A regex to find full string tables can cause error_stack exceptions with std::regex
+        // on large files, so the file is tokenized instead.)
+        std::vector<std::pair<size_t, std::wstring_view>> tableEntries;
+        std::vector<font_entry> fontEntries;
+        rc_tokenizer tokenizer{ rcFileText };
+        bool inStringTable{ false };
+        bool readingStringTableHeader{ false };
+        for (auto token = tokenizer.next(); token.m_type != rc_token_type::end;
+             token = tokenizer.next())
+            {
+            if (inStringTable)
+                {
+                if (token.m_type == rc_token_type::string)
                     {
-                    const auto [isunTranslatable, translatableContentLength] =
-                        is_untranslatable_string(tableEntry.second, false);
-                    if ((m_review_styles & check_l10n_contains_excessive_nonl10n_content) &&
-                        !isunTranslatable &&
-                        tableEntry.second.length() > (translatableContentLength * 3))
+                    if (reviewStrings)
                         {
-                        m_localizable_strings_with_unlocalizable_content.emplace_back(
-                            tableEntry.second,
-                            string_info::usage_info(string_info::usage_info::usage_type::orphan,
-                                                    std::wstring{}, std::wstring{}),
-                            m_file_name,
-                            std::make_pair(get_line_and_column(tableEntry.first, rcFileText).first,
-                                           std::wstring::npos));
+                        tableEntries.emplace_back(token.m_position, token.m_text);
                         }
                     }
-
-                if ((m_review_styles & check_l10n_has_surrounding_spaces) &&
-                    has_surrounding_spaces(tableEntry.second))
+                else if (token.is_keyword(L"END") || token.is_punctuation(L'}'))
                     {
-                    m_localizable_strings_with_surrounding_spaces.emplace_back(
-                        tableEntry.second,
-                        string_info::usage_info(string_info::usage_info::usage_type::orphan,
-                                                std::wstring{}, std::wstring{}),
-                        m_file_name,
-                        std::make_pair(get_line_and_column(tableEntry.first, rcFileText).first,
-                                       std::wstring::npos));
+                    inStringTable = false;
+                    }
+                }
+            // options (e.g., DISCARDABLE) can appear before the table's BEGIN
+            else if (readingStringTableHeader)
+                {
+                if (token.is_keyword(L"BEGIN") || token.is_punctuation(L'{'))
+                    {
+                    inStringTable = true;
+                    readingStringTableHeader = false;
+                    }
+                else if (token.m_type != rc_token_type::identifier &&
+                         token.m_type != rc_token_type::number)
+                    {
+                    readingStringTableHeader = false;
+                    }
+                }
+            else if (token.is_keyword(L"STRINGTABLE"))
+                {
+                readingStringTableHeader = true;
+                }
+            // FONT pointsize, "typeface"[, weight, italic, charset]
+            else if (reviewFonts && token.is_keyword(L"FONT"))
+                {
+                auto lookAhead{ tokenizer };
+                const auto fontSize = lookAhead.next();
+                if (fontSize.m_type != rc_token_type::number ||
+                    !lookAhead.next().is_punctuation(L','))
+                    {
+                    continue;
+                    }
+                const auto fontName = lookAhead.next();
+                if (fontName.m_type == rc_token_type::string)
+                    {
+                    fontEntries.push_back(
+                        font_entry{ token.m_position, fontSize.m_text, fontName.m_text });
+                    tokenizer = lookAhead;
                     }
                 }
             }
 
-        // read the fonts
-        if (static_cast<bool>(get_style() & check_fonts))
-            {
-            std::vector<std::pair<size_t, std::wstring>> fontEntries;
-            const std::wregex fontRE{ L"\\bFONT[ ]*([0-9]+),[ ]*\"([^\"]*)\"" };
+        // the table strings and font names are views into the file's text,
+        // so they can refer to it if it is retained
+        m_retained_file_text = is_file_text_retained() ? rcFileText : std::wstring_view{};
 
-            auto currentTextBlock{ rcFileText };
-            std::match_results<decltype(currentTextBlock)::const_iterator> stPositions;
-            size_t currentBlockOffset{ 0 };
-            while (std::regex_search(currentTextBlock.cbegin(), currentTextBlock.cend(),
-                                     stPositions, fontRE))
+        // review table entries
+        for (auto& tableEntry : tableEntries)
+            {
+            // the string is only stored once; issues found in it refer to it
+            string_info tableString{
+                tableEntry.second,
+                string_info::usage_info(string_info::usage_info::usage_type::orphan,
+                                        std::wstring_view{}, std::wstring_view{}),
+                m_file_id,
+                std::make_pair(get_line_and_column(tableEntry.first, rcFileText).first,
+                               std::wstring::npos)
+            };
+            string_reference tableStringReference;
+            if (is_untranslatable_string(std::wstring{ tableEntry.second }, false).first)
                 {
-                currentBlockOffset += stPositions.position();
-                currentTextBlock = currentTextBlock.substr(stPositions.position());
-
-                fontEntries.emplace_back(
-                    currentBlockOffset,
-                    currentTextBlock.substr(0, stPositions.position() + stPositions.length()));
-
-                currentBlockOffset += stPositions.length();
+                tableStringReference =
+                    add_string_issue(string_issue::unsafe_localizable, std::move(tableString));
+                }
+            else
+                {
+                add_string(m_localizable_strings, std::move(tableString));
+                tableStringReference = get_last_string_reference(string_list::localizable);
+                }
 
-                currentTextBlock = currentTextBlock.substr(stPositions.length());
+            if (m_review_styles & check_l10n_contains_url)
+                {
+                if (I18N_PROFILE_REGEX(L"m_url_email_regex",
+                                       m_url_email_regex.contains(tableEntry.second)))
+                    {
+                    add_string_issue(string_issue::url, tableStringReference);
+                    }
                 }
 
-            std::vector<std::wstring> fontParts;
-            for (const auto& fontEntry : fontEntries)
+            if (m_review_styles & check_l10n_contains_excessive_nonl10n_content)
                 {
-                fontParts.clear();
-                auto theFontEntry{ fontEntry.second };
-                std::copy(std::regex_token_iterator<
-                              std::remove_reference_t<decltype(theFontEntry)>::const_iterator>(
-                              theFontEntry.cbegin(), theFontEntry.cend(), fontRE, { 1, 2 }),
-                          std::regex_token_iterator<
-                              std::remove_reference_t<decltype(theFontEntry)>::const_iterator>{},
-                          std::back_inserter(fontParts));
+                const auto [isunTranslatable, translatableContentLength] =
+                    is_untranslatable_string(std::wstring{ tableEntry.second }, false);
+                if ((m_review_styles & check_l10n_contains_excessive_nonl10n_content) &&
+                    !isunTranslatable &&
+                    tableEntry.second.length() > (translatableContentLength * 3))
+                    {
+                    add_string_issue(string_issue::unlocalizable_content, tableStringReference);
+                    }
+                }
 
-                const auto fontSize = [&fontParts]()
+            if ((m_review_styles & check_l10n_has_surrounding_spaces) &&
+                has_surrounding_spaces(tableEntry.second))
                 {
-                    try
-                        {
-                        if (fontParts[0].starts_with(L"0x"))
-                            {
-                            return std::optional<int32_t>(std::stol(fontParts[0], nullptr, 16));
-                            }
-                        return std::optional<int32_t>(std::stol(fontParts[0]));
-                        }
-                    catch (...)
+                add_string_issue(string_issue::surrounding_spaces, tableStringReference);
+                }
+            }
+
+        // review the fonts
+        for (const auto& fontEntry : fontEntries)
+            {
+            const std::wstring fontSizeText{ fontEntry.m_size };
+            const std::wstring fontName{ fontEntry.m_name };
+            const auto fontSize = [&fontSizeText]()
+            {
+                try
+                    {
+                    if (fontSizeText.starts_with(L"0x"))
                         {
-                        return std::optional<int32_t>{ std::nullopt };
+                        return std::optional<int32_t>(std::stol(fontSizeText, nullptr, 16));
                         }
-                }();
-
-                // 8 is the standard size, but accept up to 10
-                constexpr int32_t minFontSize{ 8 };
-                constexpr int32_t maxFontSize{ 10 };
-                if (fontSize && (fontSize.value() > maxFontSize || fontSize.value() < minFontSize))
+                    return std::optional<int32_t>(std::stol(fontSizeText));
+                    }
+                catch (...)
                     {
-                    m_badFontSizes.push_back(string_info{
-                        std::to_wstring(fontSize.value()),
-                        string_info::usage_info{
+                    return std::optional<int32_t>{ std::nullopt };
+                    }
+            }();
+
+            // 8 is the standard size, but accept up to 10
+            constexpr int32_t minFontSize{ 8 };
+            constexpr int32_t maxFontSize{ 10 };
+            if (fontSize && (fontSize.value() > maxFontSize || fontSize.value() < minFontSize))
+                {
+                add_string(
+                    m_badFontSizes, std::to_wstring(fontSize.value()),
+                    string_info::usage_info{
 #ifdef wxVERSION_NUMBER
-                            wxString::Format(_(L"Font size %s is non-standard (8 is recommended)."),
-                                             fontParts[0])
-                                .wc_string()
+                        wxString::Format(_(L"Font size %s is non-standard (8 is recommended)."),
+                                         fontSizeText)
+                            .wc_string()
 #else
-                            _DT(L"Font size ") + fontParts[0] +
-                            _DT(L" is non-standard (8 is recommended).")
+                        _DT(L"Font size ") + fontSizeText +
+                        _DT(L" is non-standard (8 is recommended).")
 #endif
-                        },
-                        fileName,
-                        std::make_pair(get_line_and_column(fontEntry.first, rcFileText).first,
-                                       std::wstring::npos) });
-                    }
+                    },
+                    m_file_id,
+                    std::make_pair(get_line_and_column(fontEntry.m_position, rcFileText).first,
+                                   std::wstring::npos));
+                }
 
-                if (fontParts[1] != L"MS Shell Dlg" && fontParts[1] != L"MS Shell Dlg 2")
-                    {
-                    m_nonSystemFontNames.push_back(string_info{
-                        fontParts[1],
+            if (fontName != L"MS Shell Dlg" && fontName != L"MS Shell Dlg 2")
+                {
+                add_string(
+                    m_nonSystemFontNames, fontEntry.m_name,
 #ifdef wxVERSION_NUMBER
-                        string_info::usage_info{
-                            wxString::Format(_(L"Font '%s' may not map well on some systems "
-                                               "(MS Shell Dlg is recommended)."),
-                                             fontParts[1])
-                                .wc_string() },
+                    string_info::usage_info{
+                        wxString::Format(_(L"Font '%s' may not map well on some systems "
+                                           "(MS Shell Dlg is recommended)."),
+                                         fontName)
+                            .wc_string() },
 #else
-                        string_info::usage_info{ _DT(L"Font '") + fontParts[1] +
-                                                 _DT(L"' may not map well on some systems (MS "
-                                                     "Shell Dlg is recommended).") },
+                    string_info::usage_info{ _DT(L"Font '") + fontName +
+                                             _DT(L"' may not map well on some systems (MS "
+                                                 "Shell Dlg is recommended).") },
 #endif
-                        fileName,
-                        std::make_pair(get_line_and_column(fontEntry.first, rcFileText).first,
-                                       std::wstring::npos) });
-                    }
+                    m_file_id,
+                    std::make_pair(get_line_and_column(fontEntry.m_position, rcFileText).first,
+                                   std::wstring::npos));
                 }
             }
+
+        m_retained_file_text = std::wstring_view{};
         }
     } // namespace i18n_check
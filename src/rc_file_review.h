@@ -56,6 +56,22 @@ namespace i18n_check
             return m_nonSystemFontNames;
             }
 
+        /// @brief Clears all results from the previous parsing.
+        void clear_results() noexcept final
+            {
+            m_badFontSizes.clear();
+            m_nonSystemFontNames.clear();
+            i18n_review::clear_results();
+            }
+
+        /// @returns An estimate of the memory (in bytes) used by the current results.
+        [[nodiscard]]
+        size_t get_results_memory_usage() const noexcept final
+            {
+            return ((m_badFontSizes.size() + m_nonSystemFontNames.size()) * sizeof(string_info)) +
+                   i18n_review::get_results_memory_usage();
+            }
+
       private:
         std::vector<string_info> m_badFontSizes;
         std::vector<string_info> m_nonSystemFontNames;
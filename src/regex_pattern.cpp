@@ -0,0 +1,973 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+#include "regex_pattern.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cwchar>
+#include <cwctype>
+#include <iterator>
+#include <stdexcept>
+
+#ifdef QUNEIFORM_USE_PCRE2
+    // PCRE2 is built for a specific code unit size, so use the one that matches wchar_t
+    #if WCHAR_MAX > 0xFFFF
+        #define PCRE2_CODE_UNIT_WIDTH 32
+    #else
+        #define PCRE2_CODE_UNIT_WIDTH 16
+    #endif
+    #include <pcre2.h>
+#endif
+
+namespace i18n_check
+    {
+    namespace
+        {
+        // the prefilter counters for expressions that aren't run through a regex_set
+        std::atomic<size_t> firstCharacterSkips{ 0 };
+        std::atomic<size_t> literalSkips{ 0 };
+        std::atomic<size_t> regexEvaluations{ 0 };
+
+        /// @returns The traits used to fold the case of required text and the text searched.
+        [[nodiscard]]
+        const std::regex_traits<wchar_t>& get_traits()
+            {
+            static const std::regex_traits<wchar_t> traits;
+            return traits;
+            }
+
+        /// @brief What is known about a (sub)expression: the characters that its match
+        ///     can begin with and the text that every match must contain.
+        struct expression_info
+            {
+            std::bitset<128> m_ascii;
+            bool m_non_ascii{ false };
+            // whether it can match an empty string (and thus be "transparent")
+            bool m_nullable{ false };
+            // whether it only matches m_literal (e.g., "abc" or "a[b]c", but not "a[bc]")
+            bool m_is_literal{ false };
+            std::wstring m_literal;
+            // the longest text that every match contains
+            std::wstring m_required;
+
+            void set_literal(const wchar_t ch)
+                {
+                m_is_literal = true;
+                m_literal.assign(1, ch);
+                m_required = m_literal;
+                }
+
+            void clear_literals()
+                {
+                m_is_literal = false;
+                m_literal.clear();
+                m_required.clear();
+                }
+
+            void keep_longer_required(const std::wstring& text)
+                {
+                if (text.length() > m_required.length())
+                    {
+                    m_required = text;
+                    }
+                }
+
+            void set_all()
+                {
+                m_ascii.set();
+                m_non_ascii = true;
+                }
+
+            void merge(const expression_info& that)
+                {
+                m_ascii |= that.m_ascii;
+                m_non_ascii = m_non_ascii || that.m_non_ascii;
+                }
+            };
+
+        /// @brief Thrown when an expression uses syntax that isn't analyzed.
+        class unsupported_syntax : public std::runtime_error
+            {
+          public:
+            unsupported_syntax() : std::runtime_error("unsupported regex syntax") {}
+            };
+
+        /** @brief Recursive-descent reader of an ECMAScript expression that collects
+                the characters that a match can start with and the literal text
+                that a match must contain.
+            @details This is conservative: anything that it isn't sure about
+                (e.g., negated bracket expressions) is treated as being able to start
+                with any character and not requiring any text.*/
+        class expression_analyzer
+            {
+          public:
+            explicit expression_analyzer(std::wstring_view pattern) : m_pattern(pattern) {}
+
+            [[nodiscard]]
+            expression_info analyze()
+                {
+                auto result = read_alternation();
+                if (m_position != m_pattern.length())
+                    {
+                    throw unsupported_syntax();
+                    }
+                return result;
+                }
+
+          private:
+            [[nodiscard]]
+            bool at_end() const noexcept
+                {
+                return m_position >= m_pattern.length();
+                }
+
+            [[nodiscard]]
+            wchar_t peek() const
+                {
+                if (at_end())
+                    {
+                    throw unsupported_syntax();
+                    }
+                return m_pattern[m_position];
+                }
+
+            wchar_t next()
+                {
+                const auto ch = peek();
+                ++m_position;
+                return ch;
+                }
+
+            static void add_character(expression_info& chars, const wchar_t ch)
+                {
+                if (static_cast<uint32_t>(ch) < chars.m_ascii.size())
+                    {
+                    chars.m_ascii.set(static_cast<size_t>(ch));
+                    }
+                else
+                    {
+                    chars.m_non_ascii = true;
+                    }
+                }
+
+            void add_class(expression_info& chars, const std::wstring& className) const
+                {
+                const auto classMask =
+                    m_traits.lookup_classname(className.cbegin(), className.cend());
+                if (classMask == std::regex_traits<wchar_t>::char_class_type{})
+                    {
+                    throw unsupported_syntax();
+                    }
+                for (size_t i = 0; i < chars.m_ascii.size(); ++i)
+                    {
+                    if (m_traits.isctype(static_cast<wchar_t>(i), classMask))
+                        {
+                        chars.m_ascii.set(i);
+                        }
+                    }
+                // can't enumerate what the class includes beyond 7-bit characters
+                chars.m_non_ascii = true;
+                }
+
+            /// @returns Whether the escape was a class (e.g., @c \\d), which is added to
+            ///     @c chars. Otherwise, the escaped character is returned via @c literal.
+            bool read_escape(expression_info& chars, wchar_t& literal)
+                {
+                const auto ch = next();
+                switch (ch)
+                    {
+                case L'd':
+                    add_class(chars, L"d");
+                    return true;
+                case L's':
+                    add_class(chars, L"s");
+                    return true;
+                case L'w':
+                    add_class(chars, L"w");
+                    // '_' is also included in \w
+                    chars.m_ascii.set(L'_');
+                    return true;
+                case L'D':
+                    [[fallthrough]];
+                case L'S':
+                    [[fallthrough]];
+                case L'W':
+                    chars.set_all();
+                    return true;
+                case L'n':
+                    literal = L'\n';
+                    return false;
+                case L'r':
+                    literal = L'\r';
+                    return false;
+                case L't':
+                    literal = L'\t';
+                    return false;
+                case L'f':
+                    literal = L'\f';
+                    return false;
+                case L'v':
+                    literal = L'\v';
+                    return false;
+                default:
+                    // hex, Unicode, control, and back references are not analyzed
+                    if (std::iswalnum(ch))
+                        {
+                        throw unsupported_syntax();
+                        }
+                    literal = ch;
+                    return false;
+                    }
+                }
+
+            expression_info read_alternation()
+                {
+                auto result = read_sequence();
+                while (!at_end() && peek() == L'|')
+                    {
+                    ++m_position;
+                    const auto branch = read_sequence();
+                    result.merge(branch);
+                    result.m_nullable = result.m_nullable || branch.m_nullable;
+                    // not looking for text common to all of the branches
+                    result.clear_literals();
+                    }
+                return result;
+                }
+
+            expression_info read_sequence()
+                {
+                expression_info result;
+                result.m_nullable = true;
+                // consecutive literal terms (e.g., "ab[c]") are combined
+                std::wstring literalRun;
+                bool allLiteral{ true };
+                while (!at_end() && peek() != L'|' && peek() != L')')
+                    {
+                    const auto term = read_quantified();
+                    // a term only contributes if everything in front of it can be empty
+                    if (result.m_nullable)
+                        {
+                        result.merge(term);
+                        result.m_nullable = term.m_nullable;
+                        }
+                    if (term.m_is_literal)
+                        {
+                        literalRun += term.m_literal;
+                        }
+                    else
+                        {
+                        result.keep_longer_required(literalRun);
+                        result.keep_longer_required(term.m_required);
+                        literalRun.clear();
+                        allLiteral = false;
+                        }
+                    }
+                result.keep_longer_required(literalRun);
+                result.m_is_literal = allLiteral;
+                if (allLiteral)
+                    {
+                    result.m_literal = std::move(literalRun);
+                    }
+                return result;
+                }
+
+            expression_info read_quantified()
+                {
+                auto result = read_atom();
+                if (at_end())
+                    {
+                    return result;
+                    }
+                const auto ch = peek();
+                if (ch == L'*' || ch == L'?')
+                    {
+                    ++m_position;
+                    result.m_nullable = true;
+                    result.clear_literals();
+                    }
+                else if (ch == L'+')
+                    {
+                    ++m_position;
+                    // still required (at least once), but not the only thing matched
+                    result.m_is_literal = false;
+                    result.m_literal.clear();
+                    }
+                else if (ch == L'{')
+                    {
+                    ++m_position;
+                    size_t minCount{ 0 };
+                    bool hasDigits{ false };
+                    while (!at_end() && std::iswdigit(peek()))
+                        {
+                        minCount = (minCount * 10) + static_cast<size_t>(next() - L'0');
+                        hasDigits = true;
+                        }
+                    if (!hasDigits)
+                        {
+                        throw unsupported_syntax();
+                        }
+                    while (peek() != L'}')
+                        {
+                        const auto rangeChar = next();
+                        if (rangeChar != L',' && !std::iswdigit(rangeChar))
+                            {
+                            throw unsupported_syntax();
+                            }
+                        }
+                    ++m_position;
+                    if (minCount == 0)
+                        {
+                        result.m_nullable = true;
+                        result.clear_literals();
+                        }
+                    else
+                        {
+                        result.m_is_literal = false;
+                        result.m_literal.clear();
+                        }
+                    }
+                else
+                    {
+                    return result;
+                    }
+                // non-greedy
+                if (!at_end() && peek() == L'?')
+                    {
+                    ++m_position;
+                    }
+                return result;
+                }
+
+            expression_info read_atom()
+                {
+                expression_info result;
+                const auto ch = next();
+                switch (ch)
+                    {
+                case L'(':
+                    if (!at_end() && peek() == L'?')
+                        {
+                        ++m_position;
+                        // non-capturing groups are fine, but not lookaheads
+                        if (next() != L':')
+                            {
+                            throw unsupported_syntax();
+                            }
+                        }
+                    result = read_alternation();
+                    if (next() != L')')
+                        {
+                        throw unsupported_syntax();
+                        }
+                    return result;
+                case L'^':
+                    [[fallthrough]];
+                case L'$':
+                    // anchors don't consume anything
+                    result.m_nullable = true;
+                    result.m_is_literal = true;
+                    return result;
+                case L'.':
+                    result.set_all();
+                    return result;
+                case L'[':
+                    return read_bracket();
+                case L'\\':
+                    {
+                    if (!at_end() && (peek() == L'b' || peek() == L'B'))
+                        {
+                        ++m_position;
+                        result.m_nullable = true;
+                        result.m_is_literal = true;
+                        return result;
+                        }
+                    wchar_t literal{ 0 };
+                    if (!read_escape(result, literal))
+                        {
+                        add_character(result, literal);
+                        result.set_literal(literal);
+                        }
+                    return result;
+                    }
+                case L'*':
+                    [[fallthrough]];
+                case L'+':
+                    [[fallthrough]];
+                case L'?':
+                    [[fallthrough]];
+                case L'{':
+                    [[fallthrough]];
+                case L')':
+                    [[fallthrough]];
+                case L'|':
+                    throw unsupported_syntax();
+                default:
+                    add_character(result, ch);
+                    result.set_literal(ch);
+                    return result;
+                    }
+                }
+
+            expression_info read_bracket()
+                {
+                expression_info result;
+                const bool negated = (!at_end() && peek() == L'^');
+                if (negated)
+                    {
+                    ++m_position;
+                    }
+                if (peek() == L']')
+                    {
+                    throw unsupported_syntax();
+                    }
+                // a single character in brackets (e.g., "[(]") is the same as a literal
+                size_t itemCount{ 0 };
+                bool hasSingleCharacter{ false };
+                wchar_t singleCharacter{ 0 };
+                while (peek() != L']')
+                    {
+                    ++itemCount;
+                    wchar_t rangeStart{ 0 };
+                    if (peek() == L'[' && m_position + 1 < m_pattern.length() &&
+                        m_pattern[m_position + 1] == L':')
+                        {
+                        const auto classEnd = m_pattern.find(L":]", m_position + 2);
+                        if (classEnd == std::wstring_view::npos)
+                            {
+                            throw unsupported_syntax();
+                            }
+                        add_class(result, std::wstring{ m_pattern.substr(
+                                              m_position + 2, classEnd - (m_position + 2)) });
+                        m_position = classEnd + 2;
+                        continue;
+                        }
+                    if (peek() == L'[' && m_position + 1 < m_pattern.length() &&
+                        (m_pattern[m_position + 1] == L'.' || m_pattern[m_position + 1] == L'='))
+                        {
+                        throw unsupported_syntax();
+                        }
+                    if (peek() == L'\\')
+                        {
+                        ++m_position;
+                        if (read_escape(result, rangeStart))
+                            {
+                            continue;
+                            }
+                        }
+                    else
+                        {
+                        rangeStart = next();
+                        }
+
+                    // a range (unless the '-' is the last character in the brackets)
+                    if (peek() == L'-' && m_position + 1 < m_pattern.length() &&
+                        m_pattern[m_position + 1] != L']')
+                        {
+                        ++m_position;
+                        wchar_t rangeEnd{ 0 };
+                        if (peek() == L'\\')
+                            {
+                            ++m_position;
+                            if (read_escape(result, rangeEnd))
+                                {
+                                throw unsupported_syntax();
+                                }
+                            }
+                        else
+                            {
+                            rangeEnd = next();
+                            }
+                        for (auto i = static_cast<uint32_t>(rangeStart);
+                             i <= static_cast<uint32_t>(rangeEnd); ++i)
+                            {
+                            if (i >= result.m_ascii.size())
+                                {
+                                result.m_non_ascii = true;
+                                break;
+                                }
+                            result.m_ascii.set(i);
+                            }
+                        }
+                    else
+                        {
+                        add_character(result, rangeStart);
+                        hasSingleCharacter = true;
+                        singleCharacter = rangeStart;
+                        }
+                    }
+                ++m_position;
+
+                if (negated)
+                    {
+                    result.set_all();
+                    }
+                else if (itemCount == 1 && hasSingleCharacter)
+                    {
+                    result.set_literal(singleCharacter);
+                    }
+                return result;
+                }
+
+            std::wstring_view m_pattern;
+            size_t m_position{ 0 };
+            std::regex_traits<wchar_t> m_traits;
+            };
+        } // namespace
+
+#ifdef QUNEIFORM_USE_PCRE2
+    namespace
+        {
+        using pcre2_code_ptr = std::unique_ptr<pcre2_code, decltype(&pcre2_code_free)>;
+
+        [[nodiscard]]
+        PCRE2_SPTR to_pcre2_string(std::wstring_view text) noexcept
+            {
+            return reinterpret_cast<PCRE2_SPTR>(text.data());
+            }
+
+        /// @returns The compile settings shared by all expressions.
+        [[nodiscard]]
+        pcre2_compile_context* get_compile_context()
+            {
+            static const std::unique_ptr<pcre2_compile_context,
+                                         decltype(&pcre2_compile_context_free)>
+                context{ []()
+                         {
+                             auto* newContext = pcre2_compile_context_create(nullptr);
+                             // ECMAScript's '.' doesn't match carriage returns either
+                             pcre2_set_newline(newContext, PCRE2_NEWLINE_ANYCRLF);
+                             return newContext;
+                         }(),
+                         &pcre2_compile_context_free };
+            return context.get();
+            }
+
+        /// @brief The (per-thread) buffers used while matching.
+        class match_resources
+            {
+          public:
+            match_resources()
+                : m_match_data(pcre2_match_data_create(1, nullptr)),
+                  m_context(pcre2_match_context_create(nullptr)),
+                  // expressions with a lot of backtracking need more than the default 32K
+                  m_jit_stack(pcre2_jit_stack_create(32 * 1024, 1024 * 1024, nullptr))
+                {
+                if (m_context != nullptr && m_jit_stack != nullptr)
+                    {
+                    pcre2_jit_stack_assign(m_context, nullptr, m_jit_stack);
+                    }
+                }
+
+            match_resources(const match_resources&) = delete;
+            match_resources& operator=(const match_resources&) = delete;
+
+            ~match_resources()
+                {
+                pcre2_match_data_free(m_match_data);
+                pcre2_match_context_free(m_context);
+                pcre2_jit_stack_free(m_jit_stack);
+                }
+
+            pcre2_match_data* m_match_data{ nullptr };
+            pcre2_match_context* m_context{ nullptr };
+            pcre2_jit_stack* m_jit_stack{ nullptr };
+            };
+
+        [[nodiscard]]
+        match_resources& get_match_resources()
+            {
+            thread_local match_resources resources;
+            return resources;
+            }
+
+        /// @returns The compiled (and JIT compiled, if supported) expression,
+        ///     or null if PCRE2 can't compile it.
+        [[nodiscard]]
+        pcre2_code_ptr compile_pcre2(std::wstring_view pattern, const uint32_t options)
+            {
+            int errorCode{ 0 };
+            PCRE2_SIZE errorOffset{ 0 };
+            pcre2_code_ptr code{ pcre2_compile(to_pcre2_string(pattern), pattern.length(),
+                                               options, &errorCode, &errorOffset,
+                                               get_compile_context()),
+                                 &pcre2_code_free };
+            if (code != nullptr)
+                {
+                // if JIT isn't available, then the expression is interpreted
+                pcre2_jit_compile(code.get(), PCRE2_JIT_COMPLETE);
+                }
+            return code;
+            }
+
+        /// @returns The position and length of the match starting the search at
+        ///     @c offset, or an empty value if there isn't one.
+        /// @throws std::regex_error If PCRE2 fails while matching.
+        [[nodiscard]]
+        std::optional<regex_pattern::match_position>
+        match_pcre2(const pcre2_code* code, std::wstring_view text, const size_t offset,
+                    const uint32_t options = 0)
+            {
+            auto& resources{ get_match_resources() };
+            const int result =
+                pcre2_match(code, to_pcre2_string(text), text.length(), offset, options,
+                            resources.m_match_data, resources.m_context);
+            if (result == PCRE2_ERROR_NOMATCH)
+                {
+                return std::nullopt;
+                }
+            // zero means that there are more groups than the match data has room for,
+            // but the whole match's position is still available
+            if (result < 0)
+                {
+                throw std::regex_error(std::regex_constants::error_complexity);
+                }
+            const PCRE2_SIZE* ovector = pcre2_get_ovector_pointer(resources.m_match_data);
+            return regex_pattern::match_position{ ovector[0], ovector[1] - ovector[0] };
+            }
+        } // namespace
+
+    /// @private
+    struct regex_pattern::pcre2_expressions
+        {
+        pcre2_code_ptr m_search{ nullptr, &pcre2_code_free };
+        // anchored at both ends, for matching the whole text
+        pcre2_code_ptr m_whole_match{ nullptr, &pcre2_code_free };
+        };
+#endif
+
+    //--------------------------------------------------
+    regex_pattern::regex_pattern(std::wstring_view pattern,
+                                 const std::regex_constants::syntax_option_type flags)
+        : m_pattern(pattern), m_prefilter(make_prefilter(pattern, flags))
+        {
+#ifdef QUNEIFORM_USE_PCRE2
+        constexpr std::regex_constants::syntax_option_type noFlags{};
+        constexpr auto supportedFlags{ std::regex_constants::ECMAScript |
+                                       std::regex_constants::icase |
+                                       std::regex_constants::nosubs |
+                                       std::regex_constants::optimize };
+        if ((flags & ~supportedFlags) == noFlags)
+            {
+            // follow ECMAScript's rules for \u escapes and '$',
+            // and use Unicode properties for \w, \d, \b, and POSIX classes
+            // (std::wregex classifies wide characters with the locale's ctype)
+            const uint32_t options{ PCRE2_UTF | PCRE2_UCP | PCRE2_MATCH_INVALID_UTF |
+                                    PCRE2_ALT_BSUX | PCRE2_DOLLAR_ENDONLY |
+                                    (((flags & std::regex_constants::icase) != noFlags) ?
+                                         PCRE2_CASELESS :
+                                         0) };
+            auto expressions = std::make_shared<pcre2_expressions>();
+            expressions->m_search = compile_pcre2(pattern, options);
+            expressions->m_whole_match = compile_pcre2(
+                L"(?:" + m_pattern + L")\\z", options | PCRE2_ANCHORED);
+            if (expressions->m_search != nullptr && expressions->m_whole_match != nullptr)
+                {
+                m_pcre2 = std::move(expressions);
+                return;
+                }
+            }
+#endif
+        m_std_regex = std::wregex{ pattern.cbegin(), pattern.cend(), flags };
+        }
+
+    //--------------------------------------------------
+    regex_pattern::regex_pattern(const std::wregex& expression)
+        : m_prefilter(make_prefilter(std::wstring_view{}, expression.flags())),
+          m_std_regex(expression)
+        {
+        }
+
+    //--------------------------------------------------
+    regex_pattern::prefilter
+    regex_pattern::make_prefilter(std::wstring_view pattern,
+                                  const std::regex_constants::syntax_option_type flags)
+        {
+        expression_info info;
+        constexpr std::regex_constants::syntax_option_type noFlags{};
+        constexpr auto supportedFlags{ std::regex_constants::ECMAScript |
+                                       std::regex_constants::icase |
+                                       std::regex_constants::nosubs |
+                                       std::regex_constants::optimize };
+        if (pattern.empty() || (flags & ~supportedFlags) != noFlags)
+            {
+            info.set_all();
+            info.m_nullable = true;
+            }
+        else
+            {
+            try
+                {
+                info = expression_analyzer{ pattern }.analyze();
+                }
+            catch (const unsupported_syntax&)
+                {
+                info = expression_info{};
+                info.set_all();
+                info.m_nullable = true;
+                }
+            }
+
+        const auto& traits{ get_traits() };
+        const bool ignoreCase{ (flags & std::regex_constants::icase) != noFlags };
+        if (ignoreCase)
+            {
+            // include the other case of every letter (in either direction)
+            const auto caseSensitiveChars{ info.m_ascii };
+            for (size_t i = 0; i < info.m_ascii.size(); ++i)
+                {
+                const auto ch = static_cast<wchar_t>(i);
+                for (const auto otherCase :
+                     { traits.translate_nocase(ch),
+                       std::use_facet<std::ctype<wchar_t>>(traits.getloc()).toupper(ch) })
+                    {
+                    if (static_cast<uint32_t>(otherCase) < info.m_ascii.size() &&
+                        caseSensitiveChars.test(static_cast<size_t>(otherCase)))
+                        {
+                        info.m_ascii.set(i);
+                        }
+                    if (caseSensitiveChars.test(i) &&
+                        static_cast<uint32_t>(otherCase) < info.m_ascii.size())
+                        {
+                        info.m_ascii.set(static_cast<size_t>(otherCase));
+                        }
+                    }
+                }
+            // non-7-bit characters may fold to these
+            info.m_non_ascii = true;
+
+            // compared against the text's characters after they are folded the same way
+            for (auto& ch : info.m_required)
+                {
+                ch = traits.translate_nocase(ch);
+                }
+            }
+
+        return prefilter{ info.m_ascii, info.m_non_ascii, info.m_nullable,
+                          std::move(info.m_required), ignoreCase };
+        }
+
+    //--------------------------------------------------
+    bool regex_pattern::can_begin_with(std::wstring_view text) const noexcept
+        {
+        if (text.empty())
+            {
+            return m_prefilter.m_matches_empty;
+            }
+        return (static_cast<uint32_t>(text.front()) < m_prefilter.m_first_ascii.size()) ?
+                   m_prefilter.m_first_ascii.test(static_cast<size_t>(text.front())) :
+                   m_prefilter.m_first_non_ascii;
+        }
+
+    //--------------------------------------------------
+    bool regex_pattern::has_required_text(std::wstring_view text) const
+        {
+        const auto& required{ m_prefilter.m_required_text };
+        if (required.empty())
+            {
+            return true;
+            }
+        if (!m_prefilter.m_ignore_case)
+            {
+            return text.find(required) != std::wstring_view::npos;
+            }
+        // (characters beyond 7-bit are let through, as some of them fold
+        //  to 7-bit letters with Unicode case folding, such as the Kelvin sign)
+        const auto& traits{ get_traits() };
+        return std::search(text.cbegin(), text.cend(), required.cbegin(), required.cend(),
+                           [&traits](const wchar_t textChar, const wchar_t requiredChar)
+                           {
+                               return static_cast<uint32_t>(textChar) > 0x7F ||
+                                      traits.translate_nocase(textChar) == requiredChar;
+                           }) != text.cend();
+        }
+
+    //--------------------------------------------------
+    bool regex_pattern::passes_prefilter(std::wstring_view text) const
+        {
+        if (!has_required_text(text))
+            {
+            literalSkips.fetch_add(1, std::memory_order_relaxed);
+            return false;
+            }
+        regexEvaluations.fetch_add(1, std::memory_order_relaxed);
+        return true;
+        }
+
+    //--------------------------------------------------
+    bool regex_pattern::matches(std::wstring_view text) const
+        {
+        if (!can_begin_with(text))
+            {
+            firstCharacterSkips.fetch_add(1, std::memory_order_relaxed);
+            return false;
+            }
+        return passes_prefilter(text) && run_match(text);
+        }
+
+    //--------------------------------------------------
+    bool regex_pattern::run_match(std::wstring_view text) const
+        {
+#ifdef QUNEIFORM_USE_PCRE2
+        if (m_pcre2 != nullptr)
+            {
+            return match_pcre2(m_pcre2->m_whole_match.get(), text, 0).has_value();
+            }
+#endif
+        return std::regex_match(text.cbegin(), text.cend(), m_std_regex);
+        }
+
+    //--------------------------------------------------
+    std::optional<regex_pattern::match_position>
+    regex_pattern::search(std::wstring_view text) const
+        {
+        if (!passes_prefilter(text))
+            {
+            return std::nullopt;
+            }
+#ifdef QUNEIFORM_USE_PCRE2
+        if (m_pcre2 != nullptr)
+            {
+            return match_pcre2(m_pcre2->m_search.get(), text, 0);
+            }
+#endif
+        std::match_results<std::wstring_view::const_iterator> results;
+        if (std::regex_search(text.cbegin(), text.cend(), results, m_std_regex))
+            {
+            return match_position{ static_cast<size_t>(results.position()),
+                                   static_cast<size_t>(results.length()) };
+            }
+        return std::nullopt;
+        }
+
+    //--------------------------------------------------
+    size_t regex_pattern::count(std::wstring_view text) const
+        {
+        if (!passes_prefilter(text))
+            {
+            return 0;
+            }
+#ifdef QUNEIFORM_USE_PCRE2
+        if (m_pcre2 != nullptr)
+            {
+            size_t matchCount{ 0 };
+            size_t offset{ 0 };
+            while (offset <= text.length())
+                {
+                auto match = match_pcre2(m_pcre2->m_search.get(), text, offset);
+                if (!match)
+                    {
+                    break;
+                    }
+                ++matchCount;
+                if (match->m_length > 0)
+                    {
+                    offset = match->m_position + match->m_length;
+                    continue;
+                    }
+                // like std::regex_iterator, try for a non-empty match at the same
+                // position after an empty one, and move ahead if there isn't one
+                const size_t emptyMatchPosition{ match->m_position };
+                match = match_pcre2(m_pcre2->m_search.get(), text, emptyMatchPosition,
+                                    PCRE2_NOTEMPTY_ATSTART | PCRE2_ANCHORED);
+                if (match)
+                    {
+                    ++matchCount;
+                    offset = match->m_position + match->m_length;
+                    }
+                else
+                    {
+                    offset = emptyMatchPosition + 1;
+                    }
+                }
+            return matchCount;
+            }
+#endif
+        return static_cast<size_t>(std::distance(
+            std::regex_iterator<std::wstring_view::const_iterator>(text.cbegin(), text.cend(),
+                                                                   m_std_regex),
+            std::regex_iterator<std::wstring_view::const_iterator>()));
+        }
+
+    //--------------------------------------------------
+    std::wstring regex_pattern::replace(std::wstring_view text, std::wstring_view format) const
+        {
+        if (!passes_prefilter(text))
+            {
+            return std::wstring{ text };
+            }
+#ifdef QUNEIFORM_USE_PCRE2
+        if (m_pcre2 != nullptr)
+            {
+            std::wstring result(text.length() + 1, L'\0');
+            const uint32_t options{ PCRE2_SUBSTITUTE_GLOBAL | PCRE2_SUBSTITUTE_OVERFLOW_LENGTH |
+                                    PCRE2_SUBSTITUTE_UNSET_EMPTY };
+            // if the buffer isn't big enough, then the length needed is returned
+            // and it is run again
+            for (int attempt = 0; attempt < 2; ++attempt)
+                {
+                PCRE2_SIZE resultLength{ result.length() };
+                const int substituteResult = pcre2_substitute(
+                    m_pcre2->m_search.get(), to_pcre2_string(text), text.length(), 0, options,
+                    nullptr, get_match_resources().m_context, to_pcre2_string(format),
+                    format.length(), reinterpret_cast<PCRE2_UCHAR*>(result.data()),
+                    &resultLength);
+                if (substituteResult >= 0)
+                    {
+                    result.resize(resultLength);
+                    return result;
+                    }
+                if (substituteResult != PCRE2_ERROR_NOMEMORY)
+                    {
+                    break;
+                    }
+                result.resize(resultLength);
+                }
+            throw std::regex_error(std::regex_constants::error_complexity);
+            }
+#endif
+        std::wstring result;
+        std::regex_replace(std::back_inserter(result), text.cbegin(), text.cend(), m_std_regex,
+                           std::wstring{ format });
+        return result;
+        }
+
+    //--------------------------------------------------
+    std::wstring_view regex_pattern::get_engine_name()
+        {
+#ifdef QUNEIFORM_USE_PCRE2
+        uint32_t hasJit{ 0 };
+        pcre2_config(PCRE2_CONFIG_JIT, &hasJit);
+        return (hasJit != 0) ? std::wstring_view{ L"PCRE2 (JIT)" } : std::wstring_view{ L"PCRE2" };
+#else
+        return L"std::regex";
+#endif
+        }
+
+    //--------------------------------------------------
+    regex_pattern::match_statistics regex_pattern::get_statistics() noexcept
+        {
+        return match_statistics{ firstCharacterSkips.load(std::memory_order_relaxed),
+                                 literalSkips.load(std::memory_order_relaxed),
+                                 regexEvaluations.load(std::memory_order_relaxed) };
+        }
+
+    //--------------------------------------------------
+    void regex_pattern::reset_statistics() noexcept
+        {
+        firstCharacterSkips.store(0, std::memory_order_relaxed);
+        literalSkips.store(0, std::memory_order_relaxed);
+        regexEvaluations.store(0, std::memory_order_relaxed);
+        }
+    } // namespace i18n_check
@@ -0,0 +1,208 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+/** @addtogroup Internationalization
+    @brief i18n classes.
+@{*/
+
+#ifndef __REGEX_PATTERN_H__
+#define __REGEX_PATTERN_H__
+
+#include <bitset>
+#include <memory>
+#include <optional>
+#include <regex>
+#include <string>
+#include <string_view>
+
+namespace i18n_check
+    {
+    /** @brief A compiled regular expression (ECMAScript syntax), run by the regex engine
+            selected when building the program.
+        @details By default, expressions are run with @c std::wregex.\n
+            If built with @c QUNEIFORM_USE_PCRE2 defined (which CMake does when that option
+            is enabled and it finds PCRE2), then expressions are compiled (and JIT compiled)
+            with PCRE2 instead.
+            PCRE2 is set up to follow ECMAScript's rules where they differ
+            (e.g., @c \\uXXXX escapes and @c $ only matching at the end of the text)
+            and uses Unicode properties for character classes such as @c \\w.
+            Any expression that PCRE2 can't compile falls back to @c std::wregex.\n
+            When an expression is compiled, the longest literal text that every match must
+            contain (e.g., "&amp;" for `&amp;[a-zA-Z]{3,5};`) and the characters that a match
+            can begin with are worked out from its text. The regex engine is not run on text
+            that doesn't contain that literal (or, for matches(), doesn't begin with one of
+            those characters). Expressions using syntax that isn't analyzed are always run.
+        @note Errors while matching (e.g., running out of stack space) are thrown as
+            @c std::regex_error with either engine.*/
+    class regex_pattern
+        {
+      public:
+        /// @brief The location of a match within the searched text.
+        struct match_position
+            {
+            size_t m_position{ 0 };
+            size_t m_length{ 0 };
+            };
+
+        /// @brief How often the prefilters avoided running an expression.
+        struct match_statistics
+            {
+            /// @brief Expressions skipped because they can't begin with the
+            ///     text's first character.
+            size_t m_first_character_skips{ 0 };
+            /// @brief Expressions skipped because the text didn't contain
+            ///     their required literal text.
+            size_t m_literal_skips{ 0 };
+            /// @brief Expressions that were run (i.e., got past the prefilters).
+            size_t m_regex_evaluations{ 0 };
+
+            match_statistics& operator+=(const match_statistics& that) noexcept
+                {
+                m_first_character_skips += that.m_first_character_skips;
+                m_literal_skips += that.m_literal_skips;
+                m_regex_evaluations += that.m_regex_evaluations;
+                return *this;
+                }
+            };
+
+        /// @brief Constructs an expression that doesn't match anything.
+        regex_pattern() = default;
+
+        /** @brief Compiles an expression.
+            @param pattern The expression's text.
+            @param flags The flags to construct the expression with.
+                (@c icase is the only one that changes how PCRE2 runs the expression;
+                if any flags other than @c icase, @c nosubs, or @c optimize are used,
+                then @c std::wregex is used.)
+            @throws std::regex_error If @c pattern is not a valid expression.*/
+        explicit regex_pattern(
+            std::wstring_view pattern,
+            std::regex_constants::syntax_option_type flags = std::regex_constants::ECMAScript);
+
+        /** @brief Uses an already compiled @c std::wregex.
+            @details Because its text is not available, @c std::wregex will always be used
+                to run it.
+            @param expression The expression.*/
+        explicit regex_pattern(const std::wregex& expression);
+
+        /// @returns @c true if the whole text matches the expression
+        ///     (like @c std::regex_match()).
+        /// @param text The text to review.
+        [[nodiscard]]
+        bool matches(std::wstring_view text) const;
+
+        /// @returns The first match in @c text (like @c std::regex_search()),
+        ///     or an empty value if there isn't one.
+        /// @param text The text to search.
+        [[nodiscard]]
+        std::optional<match_position> search(std::wstring_view text) const;
+
+        /// @returns @c true if the expression is found anywhere in @c text.
+        /// @param text The text to search.
+        [[nodiscard]]
+        bool contains(std::wstring_view text) const
+            {
+            return search(text).has_value();
+            }
+
+        /// @returns The number of (non-overlapping) matches in @c text
+        ///     (like iterating through it with a @c std::wsregex_iterator).
+        /// @param text The text to search.
+        [[nodiscard]]
+        size_t count(std::wstring_view text) const;
+
+        /** @returns A copy of @c text with every match replaced with @c format
+                (like @c std::regex_replace()).
+            @param text The text to search.
+            @param format The replacement text, which can include the groups
+                from the match (e.g., @c $1).*/
+        [[nodiscard]]
+        std::wstring replace(std::wstring_view text, std::wstring_view format) const;
+
+        /// @returns The expression's text (will be empty if constructed from a @c std::wregex).
+        [[nodiscard]]
+        const std::wstring& get_pattern() const noexcept
+            {
+            return m_pattern;
+            }
+
+        /// @returns The name of the engine that runs the expressions
+        ///     (unless they can only be run by @c std::wregex).
+        [[nodiscard]]
+        static std::wstring_view get_engine_name();
+
+        /// @returns How often the prefilters skipped running expressions, across all
+        ///     expressions (since the program started or the last call to reset_statistics()).
+        /// @note Expressions run through a regex_set are counted by the set instead.
+        [[nodiscard]]
+        static match_statistics get_statistics() noexcept;
+
+        /// @brief Resets the prefilter counters of all expressions.
+        static void reset_statistics() noexcept;
+
+      private:
+        // regex_set keeps its own candidate lists and counters, so it uses the prefilter
+        // and the engine separately
+        friend class regex_set;
+
+        /// @brief What an expression's text says about the strings that it can match.
+        struct prefilter
+            {
+            // the 7-bit characters that a match can begin with
+            std::bitset<128> m_first_ascii;
+            bool m_first_non_ascii{ false };
+            bool m_matches_empty{ false };
+            // the longest text that every match contains (case folded if ignoring case)
+            std::wstring m_required_text;
+            bool m_ignore_case{ false };
+            };
+
+        /// @returns The prefilter for an expression, which lets everything through
+        ///     if it uses syntax (or flags) that isn't analyzed.
+        [[nodiscard]]
+        static prefilter make_prefilter(std::wstring_view pattern,
+                                        std::regex_constants::syntax_option_type flags);
+
+        /// @returns @c true if a match of the whole text can begin with its first character.
+        [[nodiscard]]
+        bool can_begin_with(std::wstring_view text) const noexcept;
+
+        /// @returns @c true if @c text contains the required literal (or there isn't one).
+        [[nodiscard]]
+        bool has_required_text(std::wstring_view text) const;
+
+        /// @returns @c true if the regex engine should be run on @c text,
+        ///     updating the counters.
+        [[nodiscard]]
+        bool passes_prefilter(std::wstring_view text) const;
+
+        /// @returns @c true if the whole text matches (without checking the prefilter).
+        [[nodiscard]]
+        bool run_match(std::wstring_view text) const;
+
+        std::wstring m_pattern;
+        // (a default constructed expression doesn't match anything, not even empty text)
+        prefilter m_prefilter;
+        std::wregex m_std_regex;
+#ifdef QUNEIFORM_USE_PCRE2
+        // the compiled expressions for searching and for matching the whole text
+        // (shared, as they are never modified after compiling)
+        struct pcre2_expressions;
+        std::shared_ptr<const pcre2_expressions> m_pcre2;
+#endif
+        };
+    } // namespace i18n_check
+
+/** @}*/
+
+#endif //__REGEX_PATTERN_H__
@@ -0,0 +1,168 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+/** @addtogroup Internationalization
+    @brief i18n classes.
+@{*/
+
+#ifndef __REGEX_PROFILER_H__
+#define __REGEX_PROFILER_H__
+
+/** @def I18N_PROFILE_REGEX
+    @brief Evaluates a regular expression call, recording it under a rule name
+        if profiling is enabled.
+    @details Build with @c QUNEIFORM_REGEX_PROFILING defined to enable profiling;
+        otherwise, this is just the call itself (and the profiler is not compiled).\n
+        For example:
+    @code
+    if (I18N_PROFILE_REGEX(L"m_url_email_regex", m_url_email_regex.contains(str)))
+    @endcode
+    @note If the call returns a @c bool (or a @c std::optional), then it is counted as a
+        match when it returns @c true (or a value); other calls (e.g., replacing text)
+        only record the number of calls and time.*/
+
+#ifdef QUNEIFORM_REGEX_PROFILING
+
+    #include <algorithm>
+    #include <chrono>
+    #include <map>
+    #include <optional>
+    #include <string>
+    #include <string_view>
+    #include <type_traits>
+    #include <vector>
+
+namespace i18n_check
+    {
+    /** @brief Records how often (and how long) each named regular expression was run.
+        @note These are diagnostic counters and are not synchronized.*/
+    class regex_profiler
+        {
+      public:
+        /// @brief A rule's evaluations.
+        struct rule_statistics
+            {
+            /// @brief The rule (e.g., the member that holds the expression or its pattern).
+            std::wstring m_name;
+            /// @brief The number of times that the expression was run.
+            size_t m_invocations{ 0 };
+            /// @brief The number of times that the expression matched
+            ///     (only counted for calls that return whether it matched).
+            size_t m_matches{ 0 };
+            /// @brief @c true if any of the calls returned whether it matched.
+            bool m_reports_matches{ false };
+            /// @brief The total time spent running the expression.
+            std::chrono::nanoseconds m_time{ 0 };
+            };
+
+        /// @brief Runs @c evaluate and records it under @c name.
+        /// @param name The rule's name.
+        /// @param evaluate The regex call.
+        /// @returns The result of @c evaluate.
+        template<typename Fn>
+        static auto profile(std::wstring_view name, Fn&& evaluate)
+            {
+            const auto startTime{ std::chrono::steady_clock::now() };
+            auto result = evaluate();
+            const auto elapsed{ std::chrono::steady_clock::now() - startTime };
+            if constexpr (std::is_same_v<decltype(result), bool>)
+                {
+                record(name, elapsed, result);
+                }
+            else if constexpr (is_optional<decltype(result)>::value)
+                {
+                record(name, elapsed, result.has_value());
+                }
+            else
+                {
+                record(name, elapsed);
+                }
+            return result;
+            }
+
+        /// @brief Adds an evaluation of a rule.
+        /// @param name The rule's name.
+        /// @param elapsed How long the evaluation took.
+        /// @param matched Whether the expression matched (if known).
+        static void record(std::wstring_view name, const std::chrono::nanoseconds elapsed,
+                           const std::optional<bool> matched = std::nullopt)
+            {
+            auto statistics = get_statistics_map().find(name);
+            if (statistics == get_statistics_map().end())
+                {
+                statistics =
+                    get_statistics_map().emplace(std::wstring{ name }, rule_statistics{}).first;
+                statistics->second.m_name = name;
+                }
+            ++statistics->second.m_invocations;
+            statistics->second.m_time += elapsed;
+            if (matched.has_value())
+                {
+                statistics->second.m_reports_matches = true;
+                if (matched.value())
+                    {
+                    ++statistics->second.m_matches;
+                    }
+                }
+            }
+
+        /// @returns The rules that were run, the most expensive (total time) first.
+        [[nodiscard]]
+        static std::vector<rule_statistics> get_ranked_statistics()
+            {
+            std::vector<rule_statistics> ranked;
+            ranked.reserve(get_statistics_map().size());
+            for (const auto& [name, statistics] : get_statistics_map())
+                {
+                ranked.push_back(statistics);
+                }
+            std::stable_sort(ranked.begin(), ranked.end(), [](const auto& lhs, const auto& rhs)
+                             { return lhs.m_time > rhs.m_time; });
+            return ranked;
+            }
+
+        /// @brief Clears the recorded evaluations.
+        static void reset() { get_statistics_map().clear(); }
+
+      private:
+        template<typename T>
+        struct is_optional : std::false_type
+            {
+            };
+
+        template<typename T>
+        struct is_optional<std::optional<T>> : std::true_type
+            {
+            };
+
+        [[nodiscard]]
+        static std::map<std::wstring, rule_statistics, std::less<>>& get_statistics_map()
+            {
+            static std::map<std::wstring, rule_statistics, std::less<>> statistics;
+            return statistics;
+            }
+        };
+    } // namespace i18n_check
+
+    #define I18N_PROFILE_REGEX(name, ...)                                                          \
+        (i18n_check::regex_profiler::profile((name), [&]() { return (__VA_ARGS__); }))
+
+#else
+
+    #define I18N_PROFILE_REGEX(name, ...) (__VA_ARGS__)
+
+#endif
+
+/** @}*/
+
+#endif //__REGEX_PROFILER_H__
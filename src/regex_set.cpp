@@ -0,0 +1,113 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+#include "regex_set.h"
+#include "regex_profiler.h"
+#include <cstdint>
+
+namespace i18n_check
+    {
+    //--------------------------------------------------
+    void regex_set::add(std::wstring_view pattern,
+                        const std::regex_constants::syntax_option_type flags)
+        {
+        m_regexes.emplace_back(pattern, flags);
+        add_candidate(m_regexes.size() - 1);
+#ifdef QUNEIFORM_REGEX_PROFILING
+        m_profile_patterns.emplace_back(pattern);
+        m_profile_names.push_back(make_profile_name(m_profile_names.size()));
+#endif
+        }
+
+    //--------------------------------------------------
+    void regex_set::add(const std::wregex& pattern)
+        {
+        m_regexes.emplace_back(pattern);
+        // no text to analyze, so it is always tried
+        add_candidate(m_regexes.size() - 1);
+#ifdef QUNEIFORM_REGEX_PROFILING
+        m_profile_patterns.emplace_back();
+        m_profile_names.push_back(make_profile_name(m_profile_names.size()));
+#endif
+        }
+
+#ifdef QUNEIFORM_REGEX_PROFILING
+    //--------------------------------------------------
+    void regex_set::set_profile_name(std::wstring_view name)
+        {
+        m_profile_name = name;
+        for (size_t i = 0; i < m_profile_names.size(); ++i)
+            {
+            m_profile_names[i] = make_profile_name(i);
+            }
+        }
+
+    //--------------------------------------------------
+    std::wstring regex_set::make_profile_name(const size_t index) const
+        {
+        return m_profile_name + L": " +
+               (m_profile_patterns[index].empty() ?
+                    L"(compiled expression #" + std::to_wstring(index + 1) + L")" :
+                    m_profile_patterns[index]);
+        }
+#endif
+
+    //--------------------------------------------------
+    void regex_set::add_candidate(const size_t index)
+        {
+        const auto& filter = m_regexes[index].m_prefilter;
+        for (size_t i = 0; i < m_ascii_candidates.size(); ++i)
+            {
+            if (filter.m_first_ascii.test(i))
+                {
+                m_ascii_candidates[i].push_back(index);
+                }
+            }
+        if (filter.m_first_non_ascii)
+            {
+            m_non_ascii_candidates.push_back(index);
+            }
+        if (filter.m_matches_empty)
+            {
+            m_empty_candidates.push_back(index);
+            }
+        }
+
+    //--------------------------------------------------
+    size_t regex_set::find_match(std::wstring_view text) const
+        {
+        const auto& candidates =
+            text.empty() ? m_empty_candidates :
+            (static_cast<uint32_t>(text.front()) < m_ascii_candidates.size()) ?
+                           m_ascii_candidates[static_cast<size_t>(text.front())] :
+                           m_non_ascii_candidates;
+        for (size_t i = 0; i < candidates.size(); ++i)
+            {
+            const auto index = candidates[i];
+            if (!m_regexes[index].has_required_text(text))
+                {
+                ++m_statistics.m_literal_skips;
+                continue;
+                }
+            ++m_statistics.m_regex_evaluations;
+            if (I18N_PROFILE_REGEX(m_profile_names[index], m_regexes[index].run_match(text)))
+                {
+                // the expressions in front of this one that weren't candidates
+                m_statistics.m_first_character_skips += index - i;
+                return index;
+                }
+            }
+        m_statistics.m_first_character_skips += m_regexes.size() - candidates.size();
+        return npos;
+        }
+    } // namespace i18n_check
@@ -0,0 +1,166 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+/** @addtogroup Internationalization
+    @brief i18n classes.
+@{*/
+
+#ifndef __REGEX_SET_H__
+#define __REGEX_SET_H__
+
+#include "regex_pattern.h"
+#include <array>
+#include <initializer_list>
+#include <limits>
+#include <regex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace i18n_check
+    {
+    /** @brief A list of regular expressions that a string is compared against
+            (as whole matches), reporting the first one that matches.
+        @details When a pattern is added, it is listed under the characters that a matching
+            string can begin with (as worked out by regex_pattern). When matching, only the
+            patterns that can start with the string's first character are considered
+            (in the order that they were added), and the regex engine is only run if the
+            string contains the pattern's required text (e.g., "SELECT *" for
+            `.*(SELECT \*).*`).\n
+            Expressions using syntax that isn't analyzed (or added as an already compiled
+            @c std::wregex) are always tried, so the results are the same as looping
+            through the list and calling @c regex_pattern::matches() on each one.*/
+    class regex_set
+        {
+      public:
+        /// @brief The value returned from find_match() when nothing matches.
+        constexpr static size_t npos = std::numeric_limits<size_t>::max();
+
+        /// @brief An expression's text and flags.
+        struct pattern_info
+            {
+            std::wstring_view m_pattern;
+            std::regex_constants::syntax_option_type m_flags{ std::regex_constants::ECMAScript };
+            };
+
+        /// @brief How often the prefilters avoided running an expression.
+        using match_statistics = regex_pattern::match_statistics;
+
+        /// @private
+        regex_set() = default;
+
+        /** @brief Constructs the set from a list of expressions.
+            @param patterns The expressions' text and flags.
+            @throws std::regex_error If any of the patterns is not a valid expression.*/
+        regex_set(std::initializer_list<pattern_info> patterns)
+            {
+            for (const auto& pattern : patterns)
+                {
+                add(pattern.m_pattern, pattern.m_flags);
+                }
+            }
+
+        /** @brief Adds a regular expression.
+            @param pattern The expression's text.
+            @param flags The flags to construct the expression with.
+            @throws std::regex_error If @c pattern is not a valid expression.*/
+        void add(std::wstring_view pattern,
+                 std::regex_constants::syntax_option_type flags = std::regex_constants::ECMAScript);
+
+        /** @brief Adds a compiled regular expression.
+            @details Because the expression's text is not available, it will be
+                tried against every string.
+            @param pattern The expression.*/
+        void add(const std::wregex& pattern);
+
+        /// @returns The index of the first expression that fully matches @c text,
+        ///     or @c npos if none do.
+        /// @param text The text to review.
+        [[nodiscard]]
+        size_t find_match(std::wstring_view text) const;
+
+        /// @returns @c true if any expression fully matches @c text.
+        /// @param text The text to review.
+        [[nodiscard]]
+        bool is_match(std::wstring_view text) const
+            {
+            return find_match(text) != npos;
+            }
+
+        /// @returns The expression at @c index.
+        /// @param index The index of the expression (e.g., from find_match()).
+        [[nodiscard]]
+        const regex_pattern& get_regex(const size_t index) const { return m_regexes[index]; }
+
+        /// @returns The number of expressions.
+        [[nodiscard]]
+        size_t size() const noexcept
+            {
+            return m_regexes.size();
+            }
+
+        /// @returns @c true if there are no expressions.
+        [[nodiscard]]
+        bool empty() const noexcept
+            {
+            return m_regexes.empty();
+            }
+
+        /// @returns How often the prefilters skipped running the expressions
+        ///     (since construction or the last call to reset_statistics()).
+        /// @note These are diagnostic counters and are not synchronized.
+        [[nodiscard]]
+        const match_statistics& get_statistics() const noexcept
+            {
+            return m_statistics;
+            }
+
+        /// @brief Resets the prefilter counters.
+        void reset_statistics() const noexcept { m_statistics = match_statistics{}; }
+
+#ifdef QUNEIFORM_REGEX_PROFILING
+        /// @brief Sets the name that the expressions are profiled under
+        ///     (each expression is listed as this name followed by its pattern).
+        /// @param name The name of the set.
+        void set_profile_name(std::wstring_view name);
+#endif
+
+      private:
+        /// @brief Adds an expression's index to the lists of the characters
+        ///     that it can start with.
+        void add_candidate(size_t index);
+
+        std::vector<regex_pattern> m_regexes;
+        // for each 7-bit character, the (ascending) indices of the expressions
+        // that can match a string beginning with it
+        std::array<std::vector<size_t>, 128> m_ascii_candidates;
+        std::vector<size_t> m_non_ascii_candidates;
+        std::vector<size_t> m_empty_candidates;
+        mutable match_statistics m_statistics;
+#ifdef QUNEIFORM_REGEX_PROFILING
+        /// @returns The set's name followed by the expression's pattern.
+        [[nodiscard]]
+        std::wstring make_profile_name(size_t index) const;
+
+        std::wstring m_profile_name{ L"regex set" };
+        // the expressions' text (empty for compiled expressions)
+        std::vector<std::wstring> m_profile_patterns;
+        // the set's name and the pattern for each expression
+        std::vector<std::wstring> m_profile_names;
+#endif
+        };
+    } // namespace i18n_check
+
+/** @}*/
+
+#endif //__REGEX_SET_H__
@@ -0,0 +1,95 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+/** @addtogroup Internationalization
+    @brief i18n classes.
+@{*/
+
+#ifndef __STRING_ARENA_H__
+#define __STRING_ARENA_H__
+
+#include <algorithm>
+#include <memory_resource>
+#include <string_view>
+
+namespace i18n_check
+    {
+    /** @brief Storage for the text of a review's results.
+        @details Strings are copied into large blocks (rather than each one being
+            allocated separately), and all of them are freed at once when the arena
+            is released.\n
+            The blocks are allocated from an upstream memory resource, which is the
+            default (heap) resource unless another one is provided.
+        @warning The views returned by store() are only valid until release() is called
+            (or the arena is destroyed).*/
+    class string_arena
+        {
+      public:
+        /// @brief The size (in bytes) of the first block.
+        /// @details Each block after that is larger than the one before it.
+        constexpr static size_t initial_block_size{ 64 * 1024 };
+
+        /// @brief Constructor.
+        /// @param upstream The memory resource to allocate the blocks from.
+        explicit string_arena(
+            std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+            : m_resource(initial_block_size, upstream)
+            {
+            }
+
+        /// @private
+        string_arena(const string_arena&) = delete;
+        /// @private
+        string_arena& operator=(const string_arena&) = delete;
+
+        /** @brief Copies a string into the arena.
+            @param text The string to copy.
+            @returns A view of the copy.*/
+        [[nodiscard]]
+        std::wstring_view store(std::wstring_view text)
+            {
+            if (text.empty())
+                {
+                return std::wstring_view{};
+                }
+            auto* const buffer = static_cast<wchar_t*>(
+                m_resource.allocate(text.length() * sizeof(wchar_t), alignof(wchar_t)));
+            std::copy(text.cbegin(), text.cend(), buffer);
+            m_length += text.length();
+            return std::wstring_view{ buffer, text.length() };
+            }
+
+        /// @brief Frees all the strings in the arena.
+        /// @warning Any views from the arena will no longer be valid.
+        void release() noexcept
+            {
+            m_resource.release();
+            m_length = 0;
+            }
+
+        /// @returns The number of characters stored since the arena was last released.
+        [[nodiscard]]
+        size_t get_length() const noexcept
+            {
+            return m_length;
+            }
+
+      private:
+        std::pmr::monotonic_buffer_resource m_resource;
+        size_t m_length{ 0 };
+        };
+    } // namespace i18n_check
+
+/** @}*/
+
+#endif //__STRING_ARENA_H__
@@ -24,7 +24,6 @@ namespace i18n_check
 
         std::vector<std::wstring> srcResults;
         std::vector<std::wstring> transResults;
-        std::wsmatch reMatches;
 
         const auto unrollStrings = [](const auto& strs)
         {
@@ -40,478 +39,582 @@ namespace i18n_check
             return result;
         };
 
-        resetCallback(m_catalog_entries.size());
-        size_t currentCatalogIndex{ 0 };
-        for (auto& catEntry : m_catalog_entries)
+        // Results of the checks that only look at the source string.
+        // The same msgid will appear in the catalog of every language that it
+        // is translated into, so these are only evaluated once per unique string.
+        struct source_review_results
             {
-            if (!callback(++currentCatalogIndex, std::wstring{}))
+            bool m_untranslatable{ false };
+            bool m_excessive_nonl10n_content{ false };
+            bool m_has_url{ false };
+            bool m_surrounding_spaces{ false };
+            bool m_ambiguous{ false };
+            };
+
+        // (keyed by views of the catalogs' strings, which don't move during the review)
+        std::unordered_map<std::wstring_view, source_review_results> reviewedSources;
+        const auto reviewSource =
+            [&reviewedSources, this](std::wstring_view src) -> const source_review_results&
+        {
+            const auto [resultsPos, inserted] = reviewedSources.try_emplace(src);
+            if (!inserted)
                 {
-                return;
+                return resultsPos->second;
                 }
-            if (static_cast<bool>(m_review_styles & check_l10n_strings))
+            auto& results = resultsPos->second;
+            if (static_cast<bool>(m_review_styles & check_l10n_strings) ||
+                static_cast<bool>(m_review_styles & check_l10n_contains_excessive_nonl10n_content))
                 {
-                if (is_untranslatable_string(catEntry.second.m_source, false).first)
-                    {
-                    catEntry.second.m_issues.emplace_back(translation_issue::suspect_source_issue,
-                                                          catEntry.second.m_source);
-                    }
-                if (!catEntry.second.m_source_plural.empty() &&
-                    is_untranslatable_string(catEntry.second.m_source_plural, false).first)
-                    {
-                    catEntry.second.m_issues.emplace_back(translation_issue::suspect_source_issue,
-                                                          catEntry.second.m_source_plural);
-                    }
+                const auto [isUntranslatable, translatableContentLength] =
+                    is_untranslatable_string(std::wstring{ src }, false);
+                results.m_untranslatable = isUntranslatable;
+                results.m_excessive_nonl10n_content =
+                    !isUntranslatable && src.length() > (translatableContentLength * 3);
                 }
             if (static_cast<bool>(m_review_styles & check_l10n_contains_url))
                 {
-                std::wsmatch results;
-
-                if (std::regex_search(catEntry.second.m_source, results, m_url_email_regex))
-                    {
-                    catEntry.second.m_issues.emplace_back(translation_issue::suspect_source_issue,
-                                                          catEntry.second.m_source);
-                    }
-                if (!catEntry.second.m_source_plural.empty() &&
-                    std::regex_search(catEntry.second.m_source_plural, results, m_url_email_regex))
-                    {
-                    catEntry.second.m_issues.emplace_back(translation_issue::suspect_source_issue,
-                                                          catEntry.second.m_source_plural);
-                    }
+                results.m_has_url =
+                    I18N_PROFILE_REGEX(L"m_url_email_regex", m_url_email_regex.contains(src));
                 }
-            if (static_cast<bool>(m_review_styles & check_l10n_contains_excessive_nonl10n_content))
+            if (static_cast<bool>(m_review_styles & check_l10n_has_surrounding_spaces))
                 {
-                if (const auto [isunTranslatable, translatableContentLength] =
-                        is_untranslatable_string(catEntry.second.m_source, false);
-                    (m_review_styles & check_l10n_contains_excessive_nonl10n_content) &&
-                    !isunTranslatable &&
-                    catEntry.second.m_source.length() > (translatableContentLength * 3) &&
-                    catEntry.second.m_comment.empty())
+                results.m_surrounding_spaces = has_surrounding_spaces(src);
+                }
+            if (static_cast<bool>(m_review_styles & check_needing_context))
+                {
+                results.m_ambiguous = is_string_ambiguous(src);
+                }
+            return results;
+        };
+
+        resetCallback(get_catalog_entry_count());
+        size_t currentCatalogIndex{ 0 };
+        for (auto& catalog : m_catalogs)
+            {
+            for (size_t entryIndex = 0; entryIndex < catalog.m_entries.size(); ++entryIndex)
+                {
+                if (!callback(++currentCatalogIndex, std::wstring{}))
                     {
-                    catEntry.second.m_issues.emplace_back(
-                        translation_issue::excessive_nonl10n_content, catEntry.second.m_source);
+                    return;
                     }
+                const translation_catalog_entry& entry{ catalog.m_entries[entryIndex] };
+                const auto addIssue =
+                    [this, &catalog, entryIndex](
+                        const translation_issue issue, const translation_form form,
+                        const translation_issue_value value = translation_issue_value::source,
+                        std::wstring_view details = std::wstring_view{})
+                { add_catalog_issue(catalog, entryIndex, issue, form, value, details); };
+                // source-only checks (shared by every catalog containing this msgid)
+                const auto& sourceResults = reviewSource(entry.m_source);
+                const auto& sourcePluralResults = reviewSource(entry.m_source_plural);
 
-                if (const auto [isunTranslatable, translatableContentLength] =
-                        is_untranslatable_string(catEntry.second.m_source_plural, false);
-                    (m_review_styles & check_l10n_contains_excessive_nonl10n_content) &&
-                    !isunTranslatable &&
-                    catEntry.second.m_source_plural.length() > (translatableContentLength * 3) &&
-                    catEntry.second.m_comment.empty())
+                if (static_cast<bool>(m_review_styles & check_l10n_strings))
+                    {
+                    if (sourceResults.m_untranslatable)
+                        {
+                        addIssue(translation_issue::suspect_source_issue,
+                                 translation_form::singular);
+                        }
+                    if (!entry.m_source_plural.empty() &&
+                        sourcePluralResults.m_untranslatable)
+                        {
+                        addIssue(translation_issue::suspect_source_issue, translation_form::plural);
+                        }
+                    }
+                if (static_cast<bool>(m_review_styles & check_l10n_contains_url))
                     {
-                    catEntry.second.m_issues.emplace_back(
-                        translation_issue::excessive_nonl10n_content,
-                        catEntry.second.m_source_plural);
+                    if (sourceResults.m_has_url)
+                        {
+                        addIssue(translation_issue::suspect_source_issue,
+                                 translation_form::singular);
+                        }
+                    if (!entry.m_source_plural.empty() && sourcePluralResults.m_has_url)
+                        {
+                        addIssue(translation_issue::suspect_source_issue, translation_form::plural);
+                        }
                     }
-                }
-            if (static_cast<bool>(m_review_styles & check_l10n_has_surrounding_spaces))
-                {
-                if (has_surrounding_spaces(catEntry.second.m_source))
+                if (static_cast<bool>(m_review_styles &
+                                      check_l10n_contains_excessive_nonl10n_content) &&
+                    entry.m_comment.empty())
                     {
-                    catEntry.second.m_issues.emplace_back(
-                        translation_issue::source_surrounding_spaces_issue,
-                        catEntry.second.m_source);
+                    if (sourceResults.m_excessive_nonl10n_content)
+                        {
+                        addIssue(translation_issue::excessive_nonl10n_content,
+                                 translation_form::singular);
+                        }
+                    if (sourcePluralResults.m_excessive_nonl10n_content)
+                        {
+                        addIssue(translation_issue::excessive_nonl10n_content,
+                                 translation_form::plural);
+                        }
                     }
-                if (!catEntry.second.m_source_plural.empty() &&
-                    has_surrounding_spaces(catEntry.second.m_source_plural))
+                if (static_cast<bool>(m_review_styles & check_l10n_has_surrounding_spaces))
                     {
-                    catEntry.second.m_issues.emplace_back(
-                        translation_issue::source_surrounding_spaces_issue,
-                        catEntry.second.m_source_plural);
+                    if (sourceResults.m_surrounding_spaces)
+                        {
+                        addIssue(translation_issue::source_surrounding_spaces_issue,
+                                 translation_form::singular);
+                        }
+                    if (!entry.m_source_plural.empty() &&
+                        sourcePluralResults.m_surrounding_spaces)
+                        {
+                        addIssue(translation_issue::source_surrounding_spaces_issue,
+                                 translation_form::plural);
+                        }
                     }
-                }
-            if (static_cast<bool>(m_review_styles & check_needing_context))
-                {
-                if (catEntry.second.m_comment.empty() &&
-                    is_string_ambiguous(catEntry.second.m_source))
+                if (static_cast<bool>(m_review_styles & check_needing_context))
                     {
-                    catEntry.second.m_issues.emplace_back(
-                        translation_issue::source_needing_context_issue, catEntry.second.m_source);
+                    if (entry.m_comment.empty() && sourceResults.m_ambiguous)
+                        {
+                        addIssue(translation_issue::source_needing_context_issue,
+                                 translation_form::singular);
+                        }
                     }
-                }
-            if (static_cast<bool>(m_review_styles & check_mismatching_printf_commands))
-                {
-                if (catEntry.second.m_po_format == po_format_string::cpp_format)
+                if (static_cast<bool>(m_review_styles & check_mismatching_printf_commands))
                     {
-                    // only look at strings that have a translation
-                    if (!catEntry.second.m_translation.empty())
+                    if (entry.m_po_format == po_format_string::cpp_format)
                         {
-                        printfStrings1 =
-                            load_cpp_printf_commands(catEntry.second.m_source, errorInfo);
-                        printfStrings2 =
-                            load_cpp_printf_commands(catEntry.second.m_translation, errorInfo);
+                        // only look at strings that have a translation
+                        if (!entry.m_translation.empty())
+                            {
+                            printfStrings1 =
+                                load_cpp_printf_commands(entry.m_source, errorInfo);
+                            printfStrings2 =
+                                load_cpp_printf_commands(entry.m_translation, errorInfo);
 
-                        if (printfStrings1.size() || printfStrings2.size())
+                            if (printfStrings1.size() || printfStrings2.size())
+                                {
+                                if (printfStrings1 != printfStrings2)
+                                    {
+                                    addIssue(translation_issue::printf_issue,
+                                             translation_form::singular,
+                                             translation_issue_value::source_and_translation,
+                                             errorInfo);
+                                    }
+                                }
+                            }
+
+                        if (!entry.m_translation_plural.empty())
                             {
-                            if (printfStrings1 != printfStrings2)
+                            printfStrings1 =
+                                load_cpp_printf_commands(entry.m_source_plural, errorInfo);
+                            printfStrings2 = load_cpp_printf_commands(
+                                entry.m_translation_plural, errorInfo);
+
+                            if (printfStrings1.size() || printfStrings2.size())
                                 {
-                                catEntry.second.m_issues.emplace_back(
-                                    translation_issue::printf_issue,
-                                    L"'" + catEntry.second.m_source + L"' vs. '" +
-                                        catEntry.second.m_translation + L"'" + errorInfo);
+                                if (printfStrings1 != printfStrings2)
+                                    {
+                                    addIssue(translation_issue::printf_issue,
+                                             translation_form::plural,
+                                             translation_issue_value::source_and_translation,
+                                             errorInfo);
+                                    }
                                 }
                             }
                         }
 
-                    if (!catEntry.second.m_translation_plural.empty())
+                    if (entry.m_po_format == po_format_string::qt_format)
                         {
-                        printfStrings1 =
-                            load_cpp_printf_commands(catEntry.second.m_source_plural, errorInfo);
-                        printfStrings2 = load_cpp_printf_commands(
-                            catEntry.second.m_translation_plural, errorInfo);
-
-                        if (printfStrings1.size() || printfStrings2.size())
-                            {
-                            if (printfStrings1 != printfStrings2)
+                        const auto reviewPositionals =
+                            [&addIssue, &printfStrings1, &printfStrings2,
+                             &unrollStrings](const auto& src, const auto& trans,
+                                             const translation_form form)
+                        {
+                            // only look at strings that have a translation
+                            if (!trans.empty())
                                 {
-                                catEntry.second.m_issues.emplace_back(
-                                    translation_issue::printf_issue,
-                                    L"'" + catEntry.second.m_source_plural + L"' vs. '" +
-                                        catEntry.second.m_translation_plural + L"'" + errorInfo);
+                                printfStrings1 = load_positional_commands(src);
+                                printfStrings2 = load_positional_commands(trans);
+
+                                if (printfStrings1.size() || printfStrings2.size())
+                                    {
+                                    if (printfStrings1 != printfStrings2)
+                                        {
+                                        addIssue(translation_issue::printf_issue, form,
+                                                 translation_issue_value::details,
+                                                 _WXTRANS_WSTR(
+                                                     L"Positional values differences: '") +
+                                                     unrollStrings(printfStrings1) +
+                                                     _WXTRANS_WSTR(L"' vs. '") +
+                                                     unrollStrings(printfStrings2) + L"'");
+                                        }
+                                    }
                                 }
-                            }
+                        };
+
+                        reviewPositionals(entry.m_source, entry.m_translation,
+                                          translation_form::singular);
+                        reviewPositionals(entry.m_source_plural, entry.m_translation_plural,
+                                          translation_form::plural);
                         }
                     }
 
-                if (catEntry.second.m_po_format == po_format_string::qt_format)
+                if (static_cast<bool>(m_review_styles & check_accelerators) ||
+                    static_cast<bool>(m_review_styles & check_malformed_strings))
                     {
-                    const auto reviewPositionals =
-                        [&catEntry, &printfStrings1, &printfStrings2,
-                         &unrollStrings](const auto& src, const auto& trans)
+                    const auto reviewAccelerators =
+                        [&addIssue, &srcResults, &transResults, this](
+                            std::wstring_view src, std::wstring_view trans,
+                            const translation_form form)
                     {
-                        // only look at strings that have a translation
                         if (!trans.empty())
                             {
-                            printfStrings1 = load_positional_commands(src);
-                            printfStrings2 = load_positional_commands(trans);
+                            srcResults.clear();
+                            transResults.clear();
+                            std::wstring_view searchSrc{ src };
+                            std::wstring_view searchTrans{ trans };
+                            while (const auto match = I18N_PROFILE_REGEX(
+                                       L"m_keyboard_accelerator_regex",
+                                       m_keyboard_accelerator_regex.search(searchSrc)))
+                                {
+                                srcResults.emplace_back(
+                                    searchSrc.substr(match->m_position, match->m_length));
+                                searchSrc.remove_prefix(match->m_position + match->m_length);
+                                }
+                            while (const auto match = I18N_PROFILE_REGEX(
+                                       L"m_keyboard_accelerator_regex",
+                                       m_keyboard_accelerator_regex.search(searchTrans)))
+                                {
+                                transResults.emplace_back(
+                                    searchTrans.substr(match->m_position, match->m_length));
+                                searchTrans.remove_prefix(match->m_position + match->m_length);
+                                }
 
-                            if (printfStrings1.size() || printfStrings2.size())
+                            if ((srcResults.size() == 1 && transResults.size() != 1) ||
+                                (srcResults.size() != 1 && transResults.size() == 1))
                                 {
-                                if (printfStrings1 != printfStrings2)
+                                if (static_cast<bool>(m_review_styles & check_accelerators))
+                                    {
+                                    addIssue(translation_issue::accelerator_issue, form,
+                                             translation_issue_value::source_and_translation);
+                                    }
+                                // if source has an accelerator key but the translation does not
+                                // but it does have a %, then that probably was meant to be an &
+                                if (static_cast<bool>(m_review_styles & check_malformed_strings) &&
+                                    srcResults.size() == 1 &&
+                                    src.find(L'%') == std::wstring::npos &&
+                                    trans.find(L'%') != std::wstring::npos)
                                     {
-                                    catEntry.second.m_issues.emplace_back(
-                                        translation_issue::printf_issue,
-                                        _WXTRANS_WSTR(L"Positional values differences: '") +
-                                            unrollStrings(printfStrings1) +
-                                            _WXTRANS_WSTR(L"' vs. '") +
-                                            unrollStrings(printfStrings2) + L"'");
+                                    addIssue(translation_issue::malformed_translation, form,
+                                             translation_issue_value::source_and_translation);
                                     }
                                 }
                             }
                     };
 
-                    reviewPositionals(catEntry.second.m_source, catEntry.second.m_translation);
-                    reviewPositionals(catEntry.second.m_source_plural,
-                                      catEntry.second.m_translation_plural);
+                    reviewAccelerators(entry.m_source, entry.m_translation,
+                                       translation_form::singular);
+                    reviewAccelerators(entry.m_source_plural, entry.m_translation_plural,
+                                       translation_form::plural);
                     }
-                }
 
-            if (static_cast<bool>(m_review_styles & check_accelerators) ||
-                static_cast<bool>(m_review_styles & check_malformed_strings))
-                {
-                const auto reviewAccelerators =
-                    [&catEntry, &srcResults, &transResults, &reMatches, this](auto src, auto trans)
-                {
-                    if (!trans.empty())
+                if (static_cast<bool>(m_review_styles & check_length))
+                    {
+                    // the length that a translation can be longer than the source
+                    const double lengthFactor{ (get_translation_length_threshold() + 100) /
+                                               static_cast<double>(100) };
+                    if (entry.m_source != L"translator-credits" &&
+                        entry.m_translation.length() > (entry.m_source.length() * lengthFactor))
                         {
-                        srcResults.clear();
-                        transResults.clear();
-                        std::wstring::const_iterator searchSrcStart{ src.cbegin() };
-                        std::wstring::const_iterator searchTransStart{ trans.cbegin() };
-                        while (std::regex_search(searchSrcStart, src.cend(), reMatches,
-                                                 m_keyboard_accelerator_regex))
-                            {
-                            srcResults.push_back(reMatches[0]);
-                            searchSrcStart = reMatches.suffix().first;
-                            }
-                        while (std::regex_search(searchTransStart, trans.cend(), reMatches,
-                                                 m_keyboard_accelerator_regex))
-                            {
-                            transResults.push_back(reMatches[0]);
-                            searchTransStart = reMatches.suffix().first;
-                            }
+                        addIssue(translation_issue::length_issue, translation_form::singular,
+                                 translation_issue_value::source_and_translation);
+                        }
+
+                    if (entry.m_source_plural != L"translator-credits" &&
+                        entry.m_translation_plural.length() >
+                            (entry.m_source_plural.length() * lengthFactor))
+                        {
+                        addIssue(translation_issue::length_issue, translation_form::plural,
+                                 translation_issue_value::source_and_translation);
+                        }
+                    }
 
-                        if ((srcResults.size() == 1 && transResults.size() != 1) ||
-                            (srcResults.size() != 1 && transResults.size() == 1))
+                if (static_cast<bool>(m_review_styles & check_numbers))
+                    {
+                    const auto reviewNumbers =
+                        [&addIssue, &printfStrings1, &printfStrings2,
+                         &unrollStrings](std::wstring_view source, std::wstring_view translation,
+                                         const translation_form form)
+                    {
+                        // only look at strings that have a translation
+                        if (!translation.empty())
                             {
-                            if (static_cast<bool>(m_review_styles & check_accelerators))
-                                {
-                                catEntry.second.m_issues.emplace_back(
-                                    translation_issue::accelerator_issue,
-                                    L"'" + src + _WXTRANS_WSTR(L"' vs. '") + trans + L"'");
-                                }
-                            // if source has an accelerator key but the translation does not
-                            // but it does have a %, then that probably was meant to be an &
-                            if (static_cast<bool>(m_review_styles & check_malformed_strings) &&
-                                srcResults.size() == 1 && src.find(L'%') == std::wstring::npos &&
-                                trans.find(L'%') != std::wstring::npos)
+                            std::wstring src{ source };
+                            std::wstring trans{ translation };
+                            std::for_each(src.begin(), src.end(),
+                                          [](wchar_t& chr) { chr = std::towlower(chr); });
+                            std::for_each(trans.begin(), trans.end(),
+                                          [](wchar_t& chr) { chr = std::towlower(chr); });
+                            printfStrings1 = load_numbers(src);
+                            printfStrings2 = load_numbers(trans);
+
+                            if (printfStrings1.size() || printfStrings2.size())
                                 {
-                                catEntry.second.m_issues.emplace_back(
-                                    translation_issue::malformed_translation,
-                                    L"'" + src + _WXTRANS_WSTR(L"' vs. '") + trans + L"'");
+                                if (printfStrings1 != printfStrings2)
+                                    {
+                                    if (src == L"translator-credits")
+                                        {
+                                        return;
+                                        }
+                                    // ignore where source is an imperial measurement and
+                                    // translation is metric
+                                    if ((src.ends_with(L" in") || src.ends_with(L" inch") ||
+                                         src.ends_with(L" inches")) &&
+                                        (trans.ends_with(L" cm") || trans.ends_with(L" mm")))
+                                        {
+                                        return;
+                                        }
+                                    // common word to number translations can be ignored
+                                    if (printfStrings2.size() == 1 && printfStrings2[0] == L"1" &&
+                                        (src.find(L"once") != std::wstring::npos ||
+                                         src.find(L"first") != std::wstring::npos ||
+                                         src.find(L"home") != std::wstring::npos ||
+                                         src.find(L"single") != std::wstring::npos))
+                                        {
+                                        return;
+                                        }
+                                    if (printfStrings2.size() == 1 && printfStrings2[0] == L"2" &&
+                                        (src.find(L"twice") != std::wstring::npos ||
+                                         src.find(L"second") != std::wstring::npos ||
+                                         src.find(L"half") != std::wstring::npos ||
+                                         src.find(L"double") != std::wstring::npos))
+                                        {
+                                        return;
+                                        }
+                                    if (printfStrings2.size() == 1 && printfStrings2[0] == L"3" &&
+                                        (src.find(L"thrice") != std::wstring::npos ||
+                                         src.find(L"third") != std::wstring::npos ||
+                                         src.find(L"triple") != std::wstring::npos))
+                                        {
+                                        return;
+                                        }
+                                    if (printfStrings2.size() == 2 && printfStrings2[0] == L"1" &&
+                                        printfStrings2[1] == L"3" &&
+                                        src.find(L"third") != std::wstring::npos)
+                                        {
+                                        return;
+                                        }
+                                    if (printfStrings2.size() == 1 && printfStrings2[0] == L"4" &&
+                                        (src.find(L"fourth") != std::wstring::npos ||
+                                         src.find(L"quarter") != std::wstring::npos))
+                                        {
+                                        return;
+                                        }
+                                    if (printfStrings2.size() == 2 && printfStrings2[0] == L"1" &&
+                                        printfStrings2[1] == L"4" &&
+                                        (src.find(L"fourth") != std::wstring::npos ||
+                                         src.find(L"quarter") != std::wstring::npos))
+                                        {
+                                        return;
+                                        }
+                                    if (printfStrings2.size() == 1 && printfStrings2[0] == L"5" &&
+                                        src.find(L"fifth") != std::wstring::npos)
+                                        {
+                                        return;
+                                        }
+                                    if (printfStrings2.size() == 1 && printfStrings2[0] == L"6" &&
+                                        src.find(L"sixth") != std::wstring::npos)
+                                        {
+                                        return;
+                                        }
+                                    if (printfStrings2.size() == 1 && printfStrings2[0] == L"7" &&
+                                        src.find(L"seventh") != std::wstring::npos)
+                                        {
+                                        return;
+                                        }
+                                    if (printfStrings2.size() == 1 && printfStrings2[0] == L"8" &&
+                                        src.find(L"eighth") != std::wstring::npos)
+                                        {
+                                        return;
+                                        }
+                                    if (printfStrings2.size() == 1 && printfStrings2[0] == L"9" &&
+                                        src.find(L"ninth") != std::wstring::npos)
+                                        {
+                                        return;
+                                        }
+                                    if (printfStrings2.size() == 1 && printfStrings2[0] == L"10" &&
+                                        src.find(L"tenth") != std::wstring::npos)
+                                        {
+                                        return;
+                                        }
+                                    if (printfStrings2.size() == 2 && printfStrings2[0] == L"1" &&
+                                        printfStrings2[1] == L"10" &&
+                                        src.find(L"tenths") != std::wstring::npos)
+                                        {
+                                        return;
+                                        }
+                                    if (printfStrings2.size() == 1 && printfStrings2[0] == L"11" &&
+                                        src.find(L"eleven") != std::wstring::npos)
+                                        {
+                                        return;
+                                        }
+                                    if (printfStrings2.size() == 1 && printfStrings2[0] == L"12" &&
+                                        (src.find(L"twelve") != std::wstring::npos ||
+                                         src.find(L"twelfth") != std::wstring::npos))
+                                        {
+                                        return;
+                                        }
+                                    if (printfStrings2.size() == 1 && printfStrings2[0] == L"13" &&
+                                        src.find(L"thirteen") != std::wstring::npos)
+                                        {
+                                        return;
+                                        }
+                                    if (printfStrings2.size() == 1 && printfStrings2[0] == L"14" &&
+                                        src.find(L"fourteen") != std::wstring::npos)
+                                        {
+                                        return;
+                                        }
+                                    if (printfStrings2.size() == 1 && printfStrings2[0] == L"15" &&
+                                        src.find(L"fifteen") != std::wstring::npos)
+                                        {
+                                        return;
+                                        }
+                                    if (printfStrings2.size() == 1 && printfStrings2[0] == L"16" &&
+                                        src.find(L"sixteen") != std::wstring::npos)
+                                        {
+                                        return;
+                                        }
+                                    if (printfStrings2.size() == 1 && printfStrings2[0] == L"17" &&
+                                        src.find(L"seventeen") != std::wstring::npos)
+                                        {
+                                        return;
+                                        }
+                                    if (printfStrings2.size() == 1 && printfStrings2[0] == L"18" &&
+                                        src.find(L"eighteen") != std::wstring::npos)
+                                        {
+                                        return;
+                                        }
+                                    if (printfStrings2.size() == 1 && printfStrings2[0] == L"19" &&
+                                        src.find(L"nineteen") != std::wstring::npos)
+                                        {
+                                        return;
+                                        }
+                                    if (printfStrings2.size() == 1 && printfStrings2[0] == L"20" &&
+                                        src.find(L"twent") != std::wstring::npos)
+                                        {
+                                        return;
+                                        }
+                                    addIssue(translation_issue::number_issue, form,
+                                             translation_issue_value::details,
+                                             _WXTRANS_WSTR(L"Number differences: '") +
+                                                 unrollStrings(printfStrings1) +
+                                                 _WXTRANS_WSTR(L"' vs. '") +
+                                                 unrollStrings(printfStrings2) + L"'");
+                                    }
                                 }
                             }
-                        }
-                };
-
-                reviewAccelerators(catEntry.second.m_source, catEntry.second.m_translation);
-                reviewAccelerators(catEntry.second.m_source_plural,
-                                   catEntry.second.m_translation_plural);
-                }
+                    };
 
-            if (static_cast<bool>(m_review_styles & check_length))
-                {
-                // the length that a translation can be longer than the source
-                const double lengthFactor{ (get_translation_length_threshold() + 100) /
-                                           static_cast<double>(100) };
-                if (catEntry.second.m_source != L"translator-credits" &&
-                    catEntry.second.m_translation.length() >
-                        (catEntry.second.m_source.length() * lengthFactor))
-                    {
-                    catEntry.second.m_issues.emplace_back(translation_issue::length_issue,
-                                                          L"'" + catEntry.second.m_source +
-                                                              _WXTRANS_WSTR(L"' vs. '") +
-                                                              catEntry.second.m_translation + L"'");
+                    reviewNumbers(entry.m_source, entry.m_translation, translation_form::singular);
+                    reviewNumbers(entry.m_source_plural, entry.m_translation_plural,
+                                  translation_form::plural);
                     }
 
-                if (catEntry.second.m_source_plural != L"translator-credits" &&
-                    catEntry.second.m_translation_plural.length() >
-                        (catEntry.second.m_source_plural.length() * lengthFactor))
+                if (static_cast<bool>(m_review_styles & check_consistency))
                     {
-                    catEntry.second.m_issues.emplace_back(
-                        translation_issue::length_issue,
-                        L"'" + catEntry.second.m_source_plural + _WXTRANS_WSTR(L"' vs. '") +
-                            catEntry.second.m_translation_plural + L"'");
-                    }
-                }
+                    const auto reviewConsistency =
+                        [&addIssue](std::wstring_view src, std::wstring_view trans,
+                                    const translation_form form)
+                    {
+                        if (!src.empty() && !trans.empty())
+                            {
+                            const wchar_t lastSrcChar{ src.back() };
+                            const wchar_t lastTransChar{ trans.back() };
 
-            if (static_cast<bool>(m_review_styles & check_numbers))
-                {
-                const auto reviewNumbers = [&catEntry, &printfStrings1, &printfStrings2,
-                                            &unrollStrings](auto src, auto trans)
-                {
-                    // only look at strings that have a translation
-                    if (!trans.empty())
-                        {
-                        std::for_each(src.begin(), src.end(),
-                                      [](wchar_t& chr) { chr = std::towlower(chr); });
-                        std::for_each(trans.begin(), trans.end(),
-                                      [](wchar_t& chr) { chr = std::towlower(chr); });
-                        printfStrings1 = load_numbers(src);
-                        printfStrings2 = load_numbers(trans);
+                            const bool srcIsStop{ i18n_string_util::is_period(lastSrcChar) ||
+                                                  i18n_string_util::is_exclamation(lastSrcChar) ||
+                                                  i18n_string_util::is_question(lastSrcChar) };
+                            const bool transIsStop{
+                                i18n_string_util::is_period(lastTransChar) ||
+                                i18n_string_util::is_exclamation(lastTransChar) ||
+                                i18n_string_util::is_question(lastTransChar)
+                            };
 
-                        if (printfStrings1.size() || printfStrings2.size())
-                            {
-                            if (printfStrings1 != printfStrings2)
+                            if ((std::iswspace(lastSrcChar) && !std::iswspace(lastTransChar)) ||
+                                (!std::iswspace(lastSrcChar) && std::iswspace(lastTransChar)) ||
+                                // note that it is allowable for source to not have full stop,
+                                // but for translation too
+                                (srcIsStop && !transIsStop) ||
+                                // mismatching colons
+                                (i18n_string_util::is_colon(lastSrcChar) &&
+                                 !i18n_string_util::is_colon(lastTransChar)) ||
+                                (i18n_string_util::is_colon(lastTransChar) &&
+                                 !i18n_string_util::is_colon(lastSrcChar)))
                                 {
-                                if (src == L"translator-credits")
-                                    {
-                                    return;
-                                    }
-                                // ignore where source is an imperial measurement and
-                                // translation is metric
-                                if ((src.ends_with(L" in") || src.ends_with(L" inch") ||
-                                     src.ends_with(L" inches")) &&
-                                    (trans.ends_with(L" cm") || trans.ends_with(L" mm")))
-                                    {
-                                    return;
-                                    }
-                                // common word to number translations can be ignored
-                                if (printfStrings2.size() == 1 && printfStrings2[0] == L"1" &&
-                                    (src.find(L"once") != std::wstring::npos ||
-                                     src.find(L"first") != std::wstring::npos ||
-                                     src.find(L"home") != std::wstring::npos ||
-                                     src.find(L"single") != std::wstring::npos))
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 1 && printfStrings2[0] == L"2" &&
-                                    (src.find(L"twice") != std::wstring::npos ||
-                                     src.find(L"second") != std::wstring::npos ||
-                                     src.find(L"half") != std::wstring::npos ||
-                                     src.find(L"double") != std::wstring::npos))
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 1 && printfStrings2[0] == L"3" &&
-                                    (src.find(L"thrice") != std::wstring::npos ||
-                                     src.find(L"third") != std::wstring::npos ||
-                                     src.find(L"triple") != std::wstring::npos))
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 2 && printfStrings2[0] == L"1" &&
-                                    printfStrings2[1] == L"3" &&
-                                    src.find(L"third") != std::wstring::npos)
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 1 && printfStrings2[0] == L"4" &&
-                                    (src.find(L"fourth") != std::wstring::npos ||
-                                     src.find(L"quarter") != std::wstring::npos))
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 2 && printfStrings2[0] == L"1" &&
-                                    printfStrings2[1] == L"4" &&
-                                    (src.find(L"fourth") != std::wstring::npos ||
-                                     src.find(L"quarter") != std::wstring::npos))
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 1 && printfStrings2[0] == L"5" &&
-                                    src.find(L"fifth") != std::wstring::npos)
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 1 && printfStrings2[0] == L"6" &&
-                                    src.find(L"sixth") != std::wstring::npos)
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 1 && printfStrings2[0] == L"7" &&
-                                    src.find(L"seventh") != std::wstring::npos)
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 1 && printfStrings2[0] == L"8" &&
-                                    src.find(L"eighth") != std::wstring::npos)
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 1 && printfStrings2[0] == L"9" &&
-                                    src.find(L"ninth") != std::wstring::npos)
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 1 && printfStrings2[0] == L"10" &&
-                                    src.find(L"tenth") != std::wstring::npos)
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 2 && printfStrings2[0] == L"1" &&
-                                    printfStrings2[1] == L"10" &&
-                                    src.find(L"tenths") != std::wstring::npos)
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 1 && printfStrings2[0] == L"11" &&
-                                    src.find(L"eleven") != std::wstring::npos)
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 1 && printfStrings2[0] == L"12" &&
-                                    (src.find(L"twelve") != std::wstring::npos ||
-                                     src.find(L"twelfth") != std::wstring::npos))
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 1 && printfStrings2[0] == L"13" &&
-                                    src.find(L"thirteen") != std::wstring::npos)
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 1 && printfStrings2[0] == L"14" &&
-                                    src.find(L"fourteen") != std::wstring::npos)
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 1 && printfStrings2[0] == L"15" &&
-                                    src.find(L"fifteen") != std::wstring::npos)
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 1 && printfStrings2[0] == L"16" &&
-                                    src.find(L"sixteen") != std::wstring::npos)
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 1 && printfStrings2[0] == L"17" &&
-                                    src.find(L"seventeen") != std::wstring::npos)
+                                // if source is an exclamation and the translation is not,
+                                // then that is OK
+                                if (!(i18n_string_util::is_exclamation(lastSrcChar) &&
+                                      !transIsStop) &&
+                                    // translation ending with ')' is OK also if
+                                    // source has a full stop
+                                    !(srcIsStop &&
+                                      i18n_string_util::is_close_parenthesis(lastTransChar)))
                                     {
-                                    return;
+                                    addIssue(translation_issue::consistency_issue, form,
+                                             translation_issue_value::source_and_translation);
                                     }
-                                if (printfStrings2.size() == 1 && printfStrings2[0] == L"18" &&
-                                    src.find(L"eighteen") != std::wstring::npos)
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 1 && printfStrings2[0] == L"19" &&
-                                    src.find(L"nineteen") != std::wstring::npos)
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 1 && printfStrings2[0] == L"20" &&
-                                    src.find(L"twent") != std::wstring::npos)
-                                    {
-                                    return;
-                                    }
-                                catEntry.second.m_issues.emplace_back(
-                                    translation_issue::number_issue,
-                                    _WXTRANS_WSTR(L"Number differences: '") +
-                                        unrollStrings(printfStrings1) + _WXTRANS_WSTR(L"' vs. '") +
-                                        unrollStrings(printfStrings2) + L"'");
+                                }
+                            else if (std::iswupper(src.front()) && std::iswlower(trans.front()))
+                                {
+                                addIssue(translation_issue::consistency_issue, form,
+                                         translation_issue_value::source_and_translation);
                                 }
                             }
-                        }
-                };
+                    };
 
-                reviewNumbers(catEntry.second.m_source, catEntry.second.m_translation);
-                reviewNumbers(catEntry.second.m_source_plural,
-                              catEntry.second.m_translation_plural);
+                    reviewConsistency(entry.m_source, entry.m_translation,
+                                      translation_form::singular);
+                    reviewConsistency(entry.m_source_plural, entry.m_translation_plural,
+                                      translation_form::plural);
+                    }
                 }
+            }
+        }
 
-            if (static_cast<bool>(m_review_styles & check_consistency))
-                {
-                const auto reviewConsistency = [&catEntry](auto src, auto trans)
-                {
-                    if (!src.empty() && !trans.empty())
-                        {
-                        const wchar_t lastSrcChar{ src.back() };
-                        const wchar_t lastTransChar{ trans.back() };
-
-                        const bool srcIsStop{ i18n_string_util::is_period(lastSrcChar) ||
-                                              i18n_string_util::is_exclamation(lastSrcChar) ||
-                                              i18n_string_util::is_question(lastSrcChar) };
-                        const bool transIsStop{ i18n_string_util::is_period(lastTransChar) ||
-                                                i18n_string_util::is_exclamation(lastTransChar) ||
-                                                i18n_string_util::is_question(lastTransChar) };
-
-                        if ((std::iswspace(lastSrcChar) && !std::iswspace(lastTransChar)) ||
-                            (!std::iswspace(lastSrcChar) && std::iswspace(lastTransChar)) ||
-                            // note that it is allowable for source to not have full stop, but for
-                            // translation too
-                            (srcIsStop && !transIsStop) ||
-                            // mismatching colons
-                            (i18n_string_util::is_colon(lastSrcChar) &&
-                             !i18n_string_util::is_colon(lastTransChar)) ||
-                            (i18n_string_util::is_colon(lastTransChar) &&
-                             !i18n_string_util::is_colon(lastSrcChar)))
-                            {
-                            // if source is an exclamation and the translation is not,
-                            // then that is OK
-                            if (!(i18n_string_util::is_exclamation(lastSrcChar) && !transIsStop) &&
-                                // translation ending with ')' is OK also if source has a full stop
-                                !(srcIsStop &&
-                                  i18n_string_util::is_close_parenthesis(lastTransChar)))
-                                {
-                                catEntry.second.m_issues.emplace_back(
-                                    translation_issue::consistency_issue,
-                                    L"'" + src + _WXTRANS_WSTR(L"' vs. '") + trans + L"'");
-                                }
-                            }
-                        else if (std::iswupper(src.front()) && std::iswlower(trans.front()))
-                            {
-                            catEntry.second.m_issues.emplace_back(
-                                translation_issue::consistency_issue,
-                                L"'" + src + _WXTRANS_WSTR(L"' vs. '") + trans + L"'");
-                            }
-                        }
-                };
+    //------------------------------------------------
+    std::wstring translation_catalog::get_issue_value(const translation_catalog_issue& issue) const
+        {
+        const translation_catalog_entry& entry{ get_entry(issue) };
+        const bool isPlural{ issue.m_form == translation_form::plural };
+        const std::wstring_view source{ isPlural ? entry.m_source_plural : entry.m_source };
+        const std::wstring_view translation{ isPlural ? entry.m_translation_plural :
+                                                        entry.m_translation };
+        if (issue.m_value == translation_issue_value::source)
+            {
+            return std::wstring{ source };
+            }
+        if (issue.m_value == translation_issue_value::details)
+            {
+            return std::wstring{ issue.m_details };
+            }
+        const std::wstring_view separator{ (issue.m_issue == translation_issue::printf_issue) ?
+                                               std::wstring_view{ L"' vs. '" } :
+                                               std::wstring_view{ _WXTRANS_WSTR(L"' vs. '") } };
+        std::wstring value;
+        value.reserve(source.length() + separator.length() + translation.length() +
+                      issue.m_details.length() + 2);
+        value.append(1, L'\'')
+            .append(source)
+            .append(separator)
+            .append(translation)
+            .append(1, L'\'')
+            .append(issue.m_details);
+        return value;
+        }
 
-                reviewConsistency(catEntry.second.m_source, catEntry.second.m_translation);
-                reviewConsistency(catEntry.second.m_source_plural,
-                                  catEntry.second.m_translation_plural);
+    //------------------------------------------------
+    size_t translation_catalog::get_entries_with_issues_count() const noexcept
+        {
+        // the issues are ordered by entry, so count where the entry changes
+        size_t entryCount{ 0 };
+        for (size_t i = 0; i < m_issues.size(); ++i)
+            {
+            if (i == 0 || m_issues[i].m_entry != m_issues[i - 1].m_entry)
+                {
+                ++entryCount;
                 }
             }
+        return entryCount;
         }
     } // namespace i18n_check
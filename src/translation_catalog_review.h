@@ -19,14 +19,94 @@
 #define __TRANS_CAT_FILE_REVIEW_H__
 
 #include "i18n_review.h"
+#include <algorithm>
 #include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 namespace i18n_check
     {
+    /// @brief Which of a catalog entry's strings an issue is about.
+    enum class translation_form : uint8_t
+        {
+        /// @brief The main source string (and its translation).
+        singular,
+        /// @brief The plural source string (and its translation).
+        plural
+        };
+
+    /// @brief How an issue's value (e.g., what is shown in a report) is built.
+    enum class translation_issue_value : uint8_t
+        {
+        /// @brief The source string.
+        source,
+        /// @brief The source string and its translation, followed by the issue's details.
+        source_and_translation,
+        /// @brief Only the issue's details.
+        details
+        };
+
+    /** @brief An issue found in a catalog entry.
+        @details The issue refers to its entry's strings (rather than copying them),
+            and only stores the text that isn't in the entry (e.g., the numbers that
+            differ between the source and translation).*/
+    struct translation_catalog_issue
+        {
+        /// @brief Text about the issue that isn't in its entry
+        ///     (see translation_issue_value).
+        std::wstring_view m_details;
+        /// @brief The index of the entry in its catalog.
+        uint32_t m_entry{ 0 };
+        /// @brief The type of issue.
+        translation_issue m_issue{ translation_issue::printf_issue };
+        /// @brief Which of the entry's strings the issue is about.
+        translation_form m_form{ translation_form::singular };
+        /// @brief How the issue's value is built.
+        translation_issue_value m_value{ translation_issue_value::source };
+        };
+
+    /// @brief The entries loaded from a catalog file, and the issues found in them.
+    struct translation_catalog
+        {
+        /// @brief The catalog file's ID (see i18n_review::get_file_path()).
+        file_id m_file_id{ file_table::npos };
+        /// @brief The entries, in the order that they appear in the file.
+        std::vector<translation_catalog_entry> m_entries;
+        /// @brief The issues found in the entries, ordered by entry.
+        std::vector<translation_catalog_issue> m_issues;
+
+        /// @returns The entry that an issue was found in.
+        /// @param issue The issue.
+        [[nodiscard]]
+        const translation_catalog_entry& get_entry(const translation_catalog_issue& issue) const
+            {
+            return m_entries[issue.m_entry];
+            }
+
+        /// @returns The value of an issue (e.g., the source string, or the source and
+        ///     translation strings being compared).
+        /// @param issue The issue.
+        [[nodiscard]]
+        std::wstring get_issue_value(const translation_catalog_issue& issue) const;
+
+        /// @returns The number of issues found in an entry.
+        /// @param entryIndex The index of the entry.
+        [[nodiscard]]
+        size_t get_issue_count(const size_t entryIndex) const noexcept
+            {
+            return static_cast<size_t>(
+                std::count_if(m_issues.cbegin(), m_issues.cend(), [entryIndex](const auto& issue)
+                              { return issue.m_entry == entryIndex; }));
+            }
+
+        /// @returns The number of entries that have at least one issue.
+        [[nodiscard]]
+        size_t get_entries_with_issues_count() const noexcept;
+        };
+
     /** @brief Class to extract and review translations from translation catalogs.*/
     class translation_catalog_review : public i18n_review
         {
@@ -35,22 +115,44 @@ namespace i18n_check
         /// @param verbose @c true to include verbose warnings.
         explicit translation_catalog_review(const bool verbose) : i18n_review(verbose) {}
 
-        /// @returns All loaded catalog entries (and any detected errors connected to them).\n
-        ///     The first key is the filepath, and the second is all catalog entries in that file.
+        /// @returns All loaded catalogs, with their entries
+        ///     (and any detected errors connected to them).
+        [[nodiscard]]
+        const std::vector<translation_catalog>& get_catalogs() const noexcept
+            {
+            return m_catalogs;
+            }
+
+        /// @returns All loaded catalogs, with their entries
+        ///     (and any detected errors connected to them).
         [[nodiscard]]
-        const std::vector<std::pair<std::filesystem::path, translation_catalog_entry>>&
-        get_catalog_entries() const noexcept
+        std::vector<translation_catalog>& get_catalogs() noexcept
             {
-            return m_catalog_entries;
+            return m_catalogs;
             }
 
-        /// @returns All loaded catalog entries (and any detected errors connected to them).\n
-        ///     The first key is the filepath, and the second is all catalog entries in that file.
+        /// @returns The number of entries in all loaded catalogs.
         [[nodiscard]]
-        std::vector<std::pair<std::filesystem::path, translation_catalog_entry>>&
-        get_catalog_entries() noexcept
+        size_t get_catalog_entry_count() const noexcept
             {
-            return m_catalog_entries;
+            size_t entryCount{ 0 };
+            for (const auto& catalog : m_catalogs)
+                {
+                entryCount += catalog.m_entries.size();
+                }
+            return entryCount;
+            }
+
+        /// @returns The number of entries (in all loaded catalogs) that have at least one issue.
+        [[nodiscard]]
+        size_t get_catalog_entries_with_issues_count() const noexcept
+            {
+            size_t entryCount{ 0 };
+            for (const auto& catalog : m_catalogs)
+                {
+                entryCount += catalog.get_entries_with_issues_count();
+                }
+            return entryCount;
             }
 
         /** @brief Reviews the loaded translation catalog entries for issues.
@@ -62,13 +164,55 @@ namespace i18n_check
         void review_strings(analyze_callback_reset resetCallback,
                             analyze_callback callback) override;
 
+        /// @brief Clears all results (including the loaded catalog entries)
+        ///     from the previous parsing.
+        void clear_results() noexcept override
+            {
+            // the entries refer to strings stored by the base class, so clear them first
+            m_catalogs.clear();
+            i18n_review::clear_results();
+            }
+
+        /// @returns An estimate of the memory (in bytes) used by the current results
+        ///     (including the loaded catalog entries).
+        [[nodiscard]]
+        size_t get_results_memory_usage() const noexcept override
+            {
+            size_t catalogSize{ m_catalogs.size() * sizeof(translation_catalog) };
+            for (const auto& catalog : m_catalogs)
+                {
+                catalogSize += (catalog.m_entries.size() * sizeof(translation_catalog_entry)) +
+                               (catalog.m_issues.size() * sizeof(translation_catalog_issue));
+                }
+            return catalogSize + i18n_review::get_results_memory_usage();
+            }
+
+      protected:
+        /** @brief Adds an issue to a catalog.
+            @param catalog The catalog.
+            @param entryIndex The index of the entry that the issue is in.
+            @param issue The type of issue.
+            @param form Which of the entry's strings the issue is about.
+            @param value How the issue's value is built.
+            @param details Text about the issue that isn't in the entry (this is copied).*/
+        void add_catalog_issue(translation_catalog& catalog, const size_t entryIndex,
+                               const translation_issue issue, const translation_form form,
+                               const translation_issue_value value,
+                               std::wstring_view details = std::wstring_view{})
+            {
+            catalog.m_issues.push_back(translation_catalog_issue{
+                m_string_arena.store(details), static_cast<uint32_t>(entryIndex), issue, form,
+                value });
+            }
+
+        /// @brief The loaded catalogs.
+        std::vector<translation_catalog> m_catalogs;
+
       private:
         void operator()([[maybe_unused]] std::wstring_view,
                         [[maybe_unused]] const std::filesystem::path&) override
             {
             }
-
-        std::vector<std::pair<std::filesystem::path, translation_catalog_entry>> m_catalog_entries;
         };
     } // namespace i18n_check
 
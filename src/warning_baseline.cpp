@@ -0,0 +1,225 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+#include "warning_baseline.h"
+#include <algorithm>
+#include <cwctype>
+#include <exception>
+
+namespace i18n_check
+    {
+    //------------------------------------------------------
+    uint64_t warning_baseline::get_fingerprint(const std::filesystem::path& file,
+                                               std::wstring_view warningId,
+                                               std::wstring_view value)
+        {
+        constexpr uint64_t FNV_OFFSET_BASIS{ 14'695'981'039'346'656'037ULL };
+        constexpr uint64_t FNV_PRIME{ 1'099'511'628'211ULL };
+
+        uint64_t hash{ FNV_OFFSET_BASIS };
+        const auto hashCodePoint = [&hash](const uint32_t codePoint)
+        {
+            for (size_t i = 0; i < sizeof(codePoint); ++i)
+                {
+                hash ^= (codePoint >> (i * 8)) & 0xFF;
+                hash *= FNV_PRIME;
+                }
+        };
+        // hashes code points (rather than wchar_ts) so that UTF-16 and UTF-32
+        // platforms get the same fingerprint
+        const auto hashText = [&hashCodePoint](const std::wstring_view text)
+        {
+            for (size_t i = 0; i < text.length(); ++i)
+                {
+                auto codePoint = static_cast<uint32_t>(text[i]);
+                if (codePoint >= 0xD800 && codePoint <= 0xDBFF && i + 1 < text.length() &&
+                    static_cast<uint32_t>(text[i + 1]) >= 0xDC00 &&
+                    static_cast<uint32_t>(text[i + 1]) <= 0xDFFF)
+                    {
+                    codePoint = 0x10000 + ((codePoint - 0xD800) << 10) +
+                                (static_cast<uint32_t>(text[i + 1]) - 0xDC00);
+                    ++i;
+                    }
+                hashCodePoint(codePoint);
+                }
+            // field separator
+            hashCodePoint(0);
+        };
+
+        hashText(file.generic_wstring());
+        hashText(warningId);
+        hashText(normalize_value(value));
+        return hash;
+        }
+
+    //------------------------------------------------------
+    std::wstring warning_baseline::normalize_value(std::wstring_view value)
+        {
+        std::wstring normalized;
+        normalized.reserve(value.length());
+        bool pendingSpace{ false };
+        for (const auto ch : value)
+            {
+            if (std::iswspace(ch))
+                {
+                pendingSpace = !normalized.empty();
+                }
+            else
+                {
+                if (pendingSpace)
+                    {
+                    normalized += L' ';
+                    pendingSpace = false;
+                    }
+                normalized += ch;
+                }
+            }
+        return normalized;
+        }
+
+    //------------------------------------------------------
+    std::filesystem::path
+    warning_baseline::get_relative_path(const std::filesystem::path& file) const
+        {
+        if (m_baseFolder.empty())
+            {
+            return file.lexically_normal();
+            }
+        // normalized first, so that "./" and "../" segments in either path are resolved
+        const auto normalizedFile{ file.lexically_normal() };
+        const auto relativePath =
+            normalizedFile.lexically_relative(m_baseFolder.lexically_normal());
+        return relativePath.empty() ? normalizedFile : relativePath;
+        }
+
+    //------------------------------------------------------
+    void warning_baseline::add(const uint64_t fingerprint, std::wstring description)
+        {
+        auto& entry = m_entries[fingerprint];
+        ++entry.m_count;
+        if (entry.m_description.empty())
+            {
+            entry.m_description = std::move(description);
+            }
+        ++m_warningCount;
+        }
+
+    //------------------------------------------------------
+    void warning_baseline::add(const report_row& warning)
+        {
+        const auto relativePath{ get_relative_path(warning.m_file) };
+        add(get_fingerprint(relativePath, warning.m_warningId, warning.m_value),
+            relativePath.generic_wstring() + L"\t" + warning.m_warningId + L"\t" +
+                normalize_value(warning.m_value));
+        }
+
+    //------------------------------------------------------
+    bool warning_baseline::load(const std::filesystem::path& baselinePath)
+        {
+        bool startsWithBom{ false };
+        const auto [readOk, fileText] = read_utf8_file(baselinePath, startsWithBom);
+        if (!readOk)
+            {
+            return false;
+            }
+
+        // each line is the fingerprint (in hex), followed by the warning's description
+        std::wistringstream baselineStream{ fileText };
+        std::wstring line;
+        while (std::getline(baselineStream, line))
+            {
+            if (!line.empty() && line.back() == L'\r')
+                {
+                line.pop_back();
+                }
+            if (line.empty() || line.front() == L'#')
+                {
+                continue;
+                }
+            const auto tabPos = line.find(L'\t');
+            try
+                {
+                add(std::stoull(line.substr(0, tabPos), nullptr, 16),
+                    (tabPos != std::wstring::npos) ? line.substr(tabPos + 1) : std::wstring{});
+                }
+            catch (const std::exception&)
+                {
+                // skip malformed lines
+                }
+            }
+        return true;
+        }
+
+    //------------------------------------------------------
+    bool warning_baseline::save(const std::filesystem::path& baselinePath) const
+        {
+        // sorted, so that the file only changes when the warnings do
+        // (it will usually be under version control)
+        std::vector<std::pair<std::wstring_view, uint64_t>> sortedEntries;
+        sortedEntries.reserve(m_entries.size());
+        for (const auto& [fingerprint, entry] : m_entries)
+            {
+            sortedEntries.emplace_back(entry.m_description, fingerprint);
+            }
+        std::sort(sortedEntries.begin(), sortedEntries.end());
+
+        std::wstringstream baselineText;
+        baselineText << L"# Quneiform warning baseline (fingerprint, file, warning ID, value)\n";
+        for (const auto& [description, fingerprint] : sortedEntries)
+            {
+            for (size_t i = 0; i < m_entries.find(fingerprint)->second.m_count; ++i)
+                {
+                baselineText << std::hex << fingerprint << std::dec << L"\t" << description
+                             << L"\n";
+                }
+            }
+
+        try
+            {
+            std::ofstream ofs(baselinePath, std::ios::binary);
+            ofs << i18n_string_util::to_utf8(baselineText.str());
+            return static_cast<bool>(ofs);
+            }
+        catch (const std::exception&)
+            {
+            return false;
+            }
+        }
+
+    //------------------------------------------------------
+    bool warning_baseline::check(const report_row& warning)
+        {
+        const auto fingerprint = get_fingerprint(get_relative_path(warning.m_file),
+                                                 warning.m_warningId, warning.m_value);
+        const auto entryPos = m_entries.find(fingerprint);
+        return (entryPos == m_entries.cend() ||
+                ++m_seenCounts[fingerprint] > entryPos->second.m_count);
+        }
+
+    //------------------------------------------------------
+    std::vector<std::wstring> warning_baseline::get_removed_warnings() const
+        {
+        std::vector<std::wstring> removedWarnings;
+        for (const auto& [fingerprint, entry] : m_entries)
+            {
+            const auto seenPos = m_seenCounts.find(fingerprint);
+            const size_t seenCount = (seenPos != m_seenCounts.cend()) ? seenPos->second : 0;
+            for (size_t i = seenCount; i < entry.m_count; ++i)
+                {
+                removedWarnings.push_back(entry.m_description);
+                }
+            }
+        std::sort(removedWarnings.begin(), removedWarnings.end());
+        return removedWarnings;
+        }
+    } // namespace i18n_check
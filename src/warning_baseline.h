@@ -0,0 +1,121 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+/** @addtogroup Internationalization
+    @brief i18n classes.
+@{*/
+
+#ifndef __I18N_WARNING_BASELINE_H__
+#define __I18N_WARNING_BASELINE_H__
+
+#include "analyze.h"
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace i18n_check
+    {
+    /** @brief A set of previously accepted warnings, used to only report new ones.
+        @details Warnings are identified by a fingerprint of their file path
+            (relative to the folder being analyzed), warning ID, and value (with its
+            whitespace normalized). Line numbers are not included, so that editing a file
+            won't cause its existing warnings to be reported again.*/
+    class warning_baseline
+        {
+      public:
+        /** @brief Constructor.
+            @param baseFolder The folder being analyzed. File paths in the baseline
+                are stored relative to this.*/
+        explicit warning_baseline(std::filesystem::path baseFolder)
+            : m_baseFolder(std::move(baseFolder))
+            {
+            }
+
+        /** @brief Adds a warning to the baseline.
+            @param warning The warning to add.*/
+        void add(const report_row& warning);
+
+        /** @brief Loads a baseline file.
+            @param baselinePath The file to load.
+            @returns @c true if the file was loaded.*/
+        bool load(const std::filesystem::path& baselinePath);
+
+        /** @brief Saves the baseline to a file.
+            @param baselinePath The file to save to.
+            @returns @c true if the file was saved.*/
+        [[nodiscard]]
+        bool save(const std::filesystem::path& baselinePath) const;
+
+        /** @brief Checks a warning against the baseline, so that a report can be
+                compared one row at a time.
+            @details If a warning occurs more times than it does in the baseline,
+                then the extra occurrences are reported as new.
+            @param warning The warning from the current analysis.
+            @returns @c true if the warning is not in the baseline.*/
+        [[nodiscard]]
+        bool check(const report_row& warning);
+
+        /// @returns The baseline's warnings that haven't been seen by check()
+        ///     (formatted as "File\tWarningID\tValue").
+        [[nodiscard]]
+        std::vector<std::wstring> get_removed_warnings() const;
+
+        /// @returns The number of warnings in the baseline.
+        [[nodiscard]]
+        size_t size() const noexcept
+            {
+            return m_warningCount;
+            }
+
+        /** @brief Calculates a warning's fingerprint.
+            @details This is an FNV-1a hash of the warning's code points,
+                so it is the same across runs and platforms.
+            @param file The file path (relative to the folder being analyzed).
+            @param warningId The warning ID.
+            @param value The string that the warning is about.
+            @returns The fingerprint.*/
+        [[nodiscard]]
+        static uint64_t get_fingerprint(const std::filesystem::path& file,
+                                        std::wstring_view warningId, std::wstring_view value);
+
+        /// @returns @c value with its whitespace trimmed and collapsed into single spaces.
+        [[nodiscard]]
+        static std::wstring normalize_value(std::wstring_view value);
+
+      private:
+        struct baseline_entry
+            {
+            size_t m_count{ 0 };
+            /// @brief The warning's description (File\tWarningID\tValue).
+            std::wstring m_description;
+            };
+
+        /// @returns The warning's file path, relative to the base folder.
+        [[nodiscard]]
+        std::filesystem::path get_relative_path(const std::filesystem::path& file) const;
+
+        void add(const uint64_t fingerprint, std::wstring description);
+
+        std::filesystem::path m_baseFolder;
+        std::unordered_map<uint64_t, baseline_entry> m_entries;
+        // how many times each of the baseline's warnings has been seen by check()
+        std::unordered_map<uint64_t, size_t> m_seenCounts;
+        size_t m_warningCount{ 0 };
+        };
+    } // namespace i18n_check
+
+/** @}*/
+
+#endif //__I18N_WARNING_BASELINE_H__
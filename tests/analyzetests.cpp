@@ -0,0 +1,279 @@
+#include "../src/analyze.h"
+#include "../src/warning_baseline.h"
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
+#include <fstream>
+#include <sstream>
+
+// NOLINTBEGIN
+using namespace i18n_check;
+using namespace Catch::Matchers;
+
+namespace
+	{
+	report_row make_row(const std::filesystem::path& file, const size_t line,
+						const std::wstring& value, const std::wstring& warningId)
+		{
+		report_row row;
+		row.m_file = file;
+		row.m_line = line;
+		row.m_column = 1;
+		row.m_value = value;
+		row.m_explanation = L"Explanation";
+		row.m_warningId = warningId;
+		return row;
+		}
+	}
+
+// clang-format off
+TEST_CASE("Report parsing", "[analyze][i18n]")
+	{
+	SECTION("Simple rows")
+		{
+		const auto rows = parse_report(
+			L"File\tLine\tColumn\tValue\tExplanation\tWarningID\n"
+			L"\"src/a.cpp\"\t12\t5\t\"Hello\"\t\"String not available for translation.\"\t[notL10NAvailable]\n"
+			L"\"src/b.rc\"\t3\t\t\"image.bmp\"\t\"Suspect string.\"\t[suspectL10NString]\n");
+		REQUIRE(rows.size() == 2);
+		CHECK(rows[0].m_file == std::filesystem::path{ L"src/a.cpp" });
+		CHECK(rows[0].m_line == 12);
+		CHECK(rows[0].m_column == 5);
+		CHECK(rows[0].m_value == L"Hello");
+		CHECK(rows[0].m_explanation == L"String not available for translation.");
+		CHECK(rows[0].m_warningId == L"notL10NAvailable");
+		CHECK(rows[1].m_file == std::filesystem::path{ L"src/b.rc" });
+		CHECK(rows[1].m_line == 3);
+		CHECK(rows[1].m_column == std::wstring::npos);
+		CHECK(rows[1].m_value == L"image.bmp");
+		CHECK(rows[1].m_warningId == L"suspectL10NString");
+		}
+
+	SECTION("Multiline value")
+		{
+		const auto rows = parse_report(
+			L"File\tLine\tColumn\tValue\tExplanation\tWarningID\n"
+			L"\"a.cpp\"\t1\t1\t\"First line\nSecond line\n\tThird line\"\t\"Explanation.\"\t[notL10NAvailable]\n"
+			L"\"a.cpp\"\t4\t1\t\"Next\"\t\"Explanation.\"\t[notL10NAvailable]\n");
+		REQUIRE(rows.size() == 2);
+		CHECK(rows[0].m_line == 1);
+		CHECK(rows[0].m_value == L"First line\nSecond line\n\tThird line");
+		CHECK(rows[0].m_explanation == L"Explanation.");
+		CHECK(rows[0].m_warningId == L"notL10NAvailable");
+		CHECK(rows[1].m_line == 4);
+		CHECK(rows[1].m_value == L"Next");
+		}
+
+	SECTION("Row at a time")
+		{
+		const std::wstring report{
+			L"File\tLine\tColumn\tValue\tExplanation\tWarningID\n"
+			L"\"a.cpp\"\t1\t1\t\"First line\nSecond line\"\t\"Explanation.\"\t[notL10NAvailable]\n"
+			L"\"a.cpp\"\t4\t1\t\"Next\"\t\"Explanation.\"\t[notL10NAvailable]" };
+		std::wstring header;
+		std::vector<report_row> rows;
+		report_reader reader{ [&rows](report_row&& row) { rows.push_back(std::move(row)); },
+							  [&header](const std::wstring& text) { header = text; } };
+		std::wostream rowStream{ &reader };
+		// rows (and their lines) are split across writes
+		for (size_t i = 0; i < report.length(); i += 5)
+			{
+			rowStream << report.substr(i, 5);
+			}
+		// the last row doesn't end with a newline
+		CHECK(rows.size() == 1);
+		reader.finish();
+
+		CHECK(header == L"File\tLine\tColumn\tValue\tExplanation\tWarningID");
+		REQUIRE(rows.size() == 2);
+		CHECK(rows[0].m_value == L"First line\nSecond line");
+		CHECK(rows[0].m_text == L"\"a.cpp\"\t1\t1\t\"First line\nSecond line\"\t\"Explanation.\"\t[notL10NAvailable]");
+		CHECK(rows[1].m_line == 4);
+		CHECK(rows[1].m_value == L"Next");
+
+		std::wistringstream reportStream{ report };
+		size_t rowCount{ 0 };
+		parse_report(reportStream, [&rowCount](report_row&&) { ++rowCount; });
+		CHECK(rowCount == 2);
+		}
+
+	SECTION("Quoted path")
+		{
+		const auto rows = parse_report(
+			L"File\tLine\tColumn\tValue\tExplanation\tWarningID\n"
+			L"\"my \\\"docs\\\"/a.cpp\"\t1\t1\t\"Hello\"\t\"Explanation.\"\t[notL10NAvailable]\n");
+		REQUIRE(rows.size() == 1);
+		CHECK(rows[0].m_file == std::filesystem::path{ L"my \"docs\"/a.cpp" });
+		}
+	}
+
+TEST_CASE("Analyze buffer", "[analyze][i18n]")
+	{
+	SECTION("Results outlive the buffer")
+		{
+		cpp_i18n_review cpp(false);
+		rc_file_review rc(false);
+		po_file_review po(false);
+		csharp_i18n_review csharp(false);
+		batch_analyze analyzer(&cpp, &rc, &po, &csharp);
+		// the buffer's strings are copied, even if file text is being retained
+		analyzer.retain_file_text(true);
+
+		std::wstring text{ LR"(MessageBox("Hello there, world");)" };
+		analyzer.analyze_buffer(text, L"src/a.cpp");
+		text.assign(text.length(), L'x');
+
+		REQUIRE(cpp.get_not_available_for_localization_strings().size() == 1);
+		CHECK(cpp.get_not_available_for_localization_strings()[0].m_string ==
+			  L"Hello there, world");
+		CHECK(analyzer.is_retaining_file_text());
+		CHECK(cpp.is_file_text_retained());
+
+		size_t resultCount{ 0 };
+		analyzer.for_each_result(
+			[&resultCount](const analysis_result& result)
+				{
+				CHECK(result.m_value == L"Hello there, world");
+				CHECK(result.m_warningId == L"notL10NAvailable");
+				++resultCount;
+				});
+		CHECK(resultCount == 1);
+		}
+	}
+
+TEST_CASE("Memory limit", "[analyze][i18n]")
+	{
+	SECTION("Spilled results match in-memory results")
+		{
+		const auto folder{ std::filesystem::temp_directory_path() / L"quneiform-memory-limit-test" };
+		std::filesystem::create_directories(folder);
+		std::vector<std::filesystem::path> files;
+		for (size_t i = 0; i < 5; ++i)
+			{
+			files.push_back(folder / (L"file" + std::to_wstring(i) + L".cpp"));
+			std::ofstream(files.back()) <<
+				"auto a = _(\"http://www.example.com\");\n"
+				"MessageBox(\"Hello there, world " << i << "\");\n"
+				"auto b = _(\"Open the file \\u00E9 " << i << ".\");\n";
+			}
+		files.push_back(folder / L"messages.po");
+		std::ofstream(files.back()) <<
+			"msgid \"\"\nmsgstr \"\"\n\"Content-Type: text/plain; charset=UTF-8\\n\"\n\n"
+			"#, c-format\nmsgid \"%d files\"\nmsgstr \"%s fichiers\"\n";
+
+		const auto analyze = [&files](const size_t memoryLimit, size_t& spillCount)
+			{
+			cpp_i18n_review cpp(false);
+			rc_file_review rc(false);
+			po_file_review po(false);
+			csharp_i18n_review csharp(false);
+			batch_analyze analyzer(&cpp, &rc, &po, &csharp);
+			analyzer.set_memory_limit(memoryLimit);
+			analyzer.analyze(files, [](const size_t) {},
+							 [](const size_t, const std::filesystem::path&) { return true; });
+			spillCount = analyzer.get_spill_count();
+
+			// the report is streamed from the spill file (and the analyzers) one row at a time
+			std::vector<std::wstring> rows;
+			report_reader reader{ [&rows](report_row&& row) { rows.push_back(std::move(row.m_text)); } };
+			std::wostream rowStream{ &reader };
+			analyzer.format_results(rowStream);
+			reader.finish();
+			CHECK(rows.size() == parse_report(analyzer.format_results().str()).size());
+			// the spilled rows are grouped by batch, so the order can differ
+			std::sort(rows.begin(), rows.end());
+			return std::make_pair(rows, analyzer.format_summary().str());
+			};
+
+		size_t spillCount{ 0 };
+		const auto [rows, summary] = analyze(0, spillCount);
+		CHECK(spillCount == 0);
+		// every file goes over a one-byte limit
+		const auto [spilledRows, spilledSummary] = analyze(1, spillCount);
+		CHECK(spillCount == files.size());
+
+		CHECK(rows.size() > files.size());
+		CHECK(rows == spilledRows);
+		CHECK(summary == spilledSummary);
+		std::filesystem::remove_all(folder);
+		}
+	}
+
+TEST_CASE("Warning baseline", "[analyze][baseline][i18n]")
+	{
+	SECTION("Fingerprint ignores line numbers")
+		{
+		warning_baseline baseline{ std::filesystem::path{ L"/repo" } };
+		baseline.add(make_row(L"/repo/src/a.cpp", 10, L"Hello", L"notL10NAvailable"));
+		CHECK(baseline.size() == 1);
+
+		// same warning, but moved to another line
+		CHECK_FALSE(baseline.check(make_row(L"/repo/src/a.cpp", 42, L"Hello", L"notL10NAvailable")));
+		CHECK(baseline.get_removed_warnings().empty());
+		}
+
+	SECTION("Fingerprint normalizes whitespace")
+		{
+		CHECK(warning_baseline::normalize_value(L"  Hello\n\t  there ") == L"Hello there");
+		CHECK(warning_baseline::get_fingerprint(L"a.cpp", L"notL10NAvailable", L"Hello  there") ==
+			  warning_baseline::get_fingerprint(L"a.cpp", L"notL10NAvailable", L"Hello\nthere"));
+		CHECK(warning_baseline::get_fingerprint(L"a.cpp", L"notL10NAvailable", L"Hello") !=
+			  warning_baseline::get_fingerprint(L"b.cpp", L"notL10NAvailable", L"Hello"));
+		CHECK(warning_baseline::get_fingerprint(L"a.cpp", L"notL10NAvailable", L"Hello") !=
+			  warning_baseline::get_fingerprint(L"a.cpp", L"suspectL10NString", L"Hello"));
+		}
+
+	SECTION("Paths relative to the base folder")
+		{
+		// the baseline is created from one checkout...
+		warning_baseline baseline{ std::filesystem::path{ L"/home/user/repo" } };
+		baseline.add(make_row(L"/home/user/repo/src/a.cpp", 1, L"Hello", L"notL10NAvailable"));
+
+		// ...and then loaded for another checkout at a different location
+		const auto tempFile{ std::filesystem::temp_directory_path() / L"quneiform-baseline-test.txt" };
+		REQUIRE(baseline.save(tempFile));
+		warning_baseline otherBaseline{ std::filesystem::path{ L"/builds/repo" } };
+		REQUIRE(otherBaseline.load(tempFile));
+		std::filesystem::remove(tempFile);
+		CHECK(otherBaseline.size() == 1);
+
+		CHECK_FALSE(otherBaseline.check(make_row(L"/builds/repo/src/a.cpp", 5, L"Hello", L"notL10NAvailable")));
+		CHECK(otherBaseline.get_removed_warnings().empty());
+
+		// same relative file name, but in a different folder
+		CHECK(otherBaseline.check(make_row(L"/builds/repo/a.cpp", 5, L"Hello", L"notL10NAvailable")));
+		}
+
+	SECTION("Redundant path segments are normalized")
+		{
+		warning_baseline baseline{ std::filesystem::path{ L"/builds/./repo/" } };
+		baseline.add(make_row(L"/builds/repo/src/a.cpp", 1, L"Hello", L"notL10NAvailable"));
+		CHECK_FALSE(baseline.check(make_row(L"/builds/repo/src/../src/./a.cpp", 5, L"Hello", L"notL10NAvailable")));
+		CHECK(baseline.get_removed_warnings().empty());
+		}
+
+	SECTION("New and removed warnings")
+		{
+		warning_baseline baseline{ std::filesystem::path{ L"/repo" } };
+		baseline.add(make_row(L"/repo/a.cpp", 1, L"Hello", L"notL10NAvailable"));
+		baseline.add(make_row(L"/repo/a.cpp", 2, L"Goodbye", L"notL10NAvailable"));
+		baseline.add(make_row(L"/repo/a.cpp", 3, L"Again", L"notL10NAvailable"));
+		CHECK(baseline.size() == 3);
+
+		CHECK_FALSE(baseline.check(make_row(L"/repo/a.cpp", 1, L"Hello", L"notL10NAvailable")));
+		CHECK(baseline.check(make_row(L"/repo/a.cpp", 2, L"Welcome", L"notL10NAvailable")));
+		// a second occurrence of a warning that is only in the baseline once
+		CHECK(baseline.check(make_row(L"/repo/a.cpp", 8, L"Hello", L"notL10NAvailable")));
+		const auto removedWarnings = baseline.get_removed_warnings();
+		REQUIRE(removedWarnings.size() == 2);
+		CHECK(removedWarnings[0] == L"a.cpp\tnotL10NAvailable\tAgain");
+		CHECK(removedWarnings[1] == L"a.cpp\tnotL10NAvailable\tGoodbye");
+
+		// warnings that are found later are no longer reported as removed
+		CHECK_FALSE(baseline.check(make_row(L"/repo/a.cpp", 9, L"Goodbye", L"notL10NAvailable")));
+		REQUIRE(baseline.get_removed_warnings().size() == 1);
+		CHECK(baseline.get_removed_warnings()[0] == L"a.cpp\tnotL10NAvailable\tAgain");
+		}
+	}
+// NOLINTEND
+// clang-format on
@@ -502,6 +502,22 @@ UINT ID_EXPORT{ (({1000})) };)";
         CHECK(cpp.get_duplicates_value_assigned_to_ids()[0].m_string == L"1000 has been assigned to multiple ID variables.");
         }
 
+    SECTION("ID declarations without values")
+        {
+        cpp_i18n_review cpp(false);
+        cpp.set_style(review_style::all_i18n_checks);
+        const wchar_t* code = LR"(int ID_AX;
+int ID_BX;
+printID = 1001;
+UINT MENU_ID_OPEN = 0x10;)";
+        cpp(code, L"");
+        cpp.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+        // "int" in "printID" is not a declaration, and the declarations without values
+        // shouldn't be read as "X" being assigned to "ID_A" and "ID_B"
+        CHECK(cpp.get_ids_assigned_number().empty());
+        CHECK(cpp.get_duplicates_value_assigned_to_ids().empty());
+        }
+
     SECTION("ID value assignments from function")
         {
         cpp_i18n_review cpp(false);
@@ -2757,7 +2773,54 @@ TEST_CASE("Spaces", "[cpp]")
         cpp(code, L"");
         cpp.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
         REQUIRE(cpp.get_error_log().size() == 1);
-        CHECK(cpp.get_error_log()[0].m_message == L"Space or newline should be inserted between ';' and '}'.");
+        CHECK(cpp.get_error_log()[0].get_message() == L"Space or newline should be inserted between ';' and '}'.");
+        CHECK(cpp.get_error_log()[0].m_resourceString == L"MISSING SPACE");
+        CHECK(cpp.get_error_log()[0].m_line == 1);
+        }
+
+    SECTION("Log level")
+        {
+        cpp_i18n_review cpp(false);
+        const wchar_t* code = LR"({ return 2;}
+{ return 3;}
+auto val = Foo("unknown usage of this string");)";
+        cpp.set_log_level(i18n_review::log_level::none);
+        cpp(code, L"");
+        cpp.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+        CHECK(cpp.get_error_log().empty());
+        CHECK(cpp.get_dropped_error_log_count() == 0);
+
+        // parsing errors only
+        cpp.clear_results();
+        cpp.set_log_level(i18n_review::log_level::errors);
+        cpp(code, L"");
+        cpp.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+        CHECK(cpp.get_error_log().size() == 2);
+        CHECK(std::all_of(cpp.get_error_log().cbegin(), cpp.get_error_log().cend(),
+            [](const auto& message)
+            { return message.m_code == i18n_review::parse_message_code::missing_space_before_closing_brace; }));
+        }
+
+    SECTION("Log limit")
+        {
+        cpp_i18n_review cpp(false);
+        const wchar_t* code = LR"({ return 2;}
+{ return 3;}
+{ return 4;})";
+        cpp.set_error_log_limit(2);
+        cpp(code, L"file.cpp");
+        cpp.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+        REQUIRE(cpp.get_error_log().size() == 2);
+        CHECK(cpp.get_error_log()[1].m_line == 2);
+        CHECK(cpp.get_file_path(cpp.get_error_log()[1].m_file_id) == L"file.cpp");
+        CHECK(cpp.get_dropped_error_log_count() == 1);
+
+        // the log is kept between reviews until it is cleared
+        cpp.clear_results();
+        CHECK(cpp.get_error_log().size() == 2);
+        cpp.clear_error_log();
+        CHECK(cpp.get_error_log().empty());
+        CHECK(cpp.get_dropped_error_log_count() == 0);
         }
     }
 
@@ -0,0 +1,343 @@
+#include "../src/language_server.h"
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+#include <sstream>
+#include <streambuf>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// NOLINTBEGIN
+using namespace i18n_check;
+using namespace Catch::Matchers;
+using namespace std::chrono_literals;
+
+namespace
+	{
+	/// @brief Stream buffer that supplies a client's messages, optionally pausing
+	///     before each part of them (to simulate the client going idle).
+	class scripted_input : public std::streambuf
+		{
+	  public:
+		void add(std::string text, const std::chrono::milliseconds delay = 0ms)
+			{
+			m_parts.emplace_back(std::move(text), delay);
+			}
+
+	  protected:
+		int_type underflow() override
+			{
+			if (m_nextPart >= m_parts.size())
+				{
+				return traits_type::eof();
+				}
+			std::this_thread::sleep_for(m_parts[m_nextPart].second);
+			auto& text = m_parts[m_nextPart++].first;
+			setg(text.data(), text.data(), text.data() + text.length());
+			return traits_type::to_int_type(*gptr());
+			}
+
+	  private:
+		std::vector<std::pair<std::string, std::chrono::milliseconds>> m_parts;
+		size_t m_nextPart{ 0 };
+		};
+
+	/// @returns A message with its header.
+	std::string frame(const std::string& message)
+		{
+		return "Content-Length: " + std::to_string(message.length()) + "\r\n\r\n" + message;
+		}
+
+	/// @returns A didOpen notification for a document.
+	std::string did_open(const std::string& uri, const std::string& text)
+		{
+		return frame(R"({"jsonrpc":"2.0","method":"textDocument/didOpen","params":)"
+					 R"({"textDocument":{"uri":")" + uri +
+					 R"(","languageId":"cpp","version":1,"text":")" + text + R"("}}})");
+		}
+
+	/// @returns A didChange notification for a document.
+	std::string did_change(const std::string& uri, const std::string& text)
+		{
+		return frame(R"({"jsonrpc":"2.0","method":"textDocument/didChange","params":)"
+					 R"({"textDocument":{"uri":")" + uri +
+					 R"(","version":2},"contentChanges":[{"text":")" + text + R"("}]}})");
+		}
+
+	const std::string shutdown_request{ frame(R"({"jsonrpc":"2.0","id":99,"method":"shutdown"})") };
+
+	/// @brief The results of running the server.
+	struct session_results
+		{
+		int m_exitCode{ 0 };
+		std::vector<std::string> m_messages;
+		};
+
+	/// @brief Runs the server until the scripted input runs out.
+	/// @note Scripts shouldn't send "exit", so that the reader thread is done with
+	///     the input when the server returns.
+	session_results run_session(scripted_input& script,
+								const std::chrono::milliseconds debounceDelay = 0ms,
+								const size_t maxMessageLength = 64 * 1024 * 1024)
+		{
+		cpp_i18n_review cpp(false);
+		rc_file_review rc(false);
+		po_file_review po(false);
+		csharp_i18n_review csharp(false);
+		batch_analyze analyzer(&cpp, &rc, &po, &csharp);
+		language_server server(analyzer);
+		server.set_debounce_delay(debounceDelay);
+		server.set_max_message_length(maxMessageLength);
+
+		std::istream input{ &script };
+		std::ostringstream output;
+		session_results results;
+		results.m_exitCode = server.run(input, output);
+
+		// split the output back into its messages
+		const std::string outputText{ output.str() };
+		size_t position{ 0 };
+		while (position < outputText.length())
+			{
+			constexpr std::string_view header{ "Content-Length: " };
+			REQUIRE(outputText.compare(position, header.length(), header) == 0);
+			const auto headerEnd = outputText.find("\r\n\r\n", position);
+			REQUIRE(headerEnd != std::string::npos);
+			const auto lengthStart = position + header.length();
+			const size_t length =
+				std::stoul(outputText.substr(lengthStart, headerEnd - lengthStart));
+			REQUIRE(headerEnd + 4 + length <= outputText.length());
+			results.m_messages.push_back(outputText.substr(headerEnd + 4, length));
+			position = headerEnd + 4 + length;
+			}
+		return results;
+		}
+
+	/// @returns The diagnostics messages from a session.
+	std::vector<std::string> get_diagnostics(const session_results& results)
+		{
+		std::vector<std::string> diagnostics;
+		std::copy_if(results.m_messages.cbegin(), results.m_messages.cend(),
+					 std::back_inserter(diagnostics),
+					 [](const auto& message)
+						 {
+						 return message.find("textDocument/publishDiagnostics") !=
+							 std::string::npos;
+						 });
+		return diagnostics;
+		}
+
+	/// @returns The "character" of the first diagnostic's start position.
+	size_t get_first_character(const std::string& diagnostics)
+		{
+		constexpr std::string_view characterKey{ R"("character":)" };
+		const auto position = diagnostics.find(characterKey);
+		REQUIRE(position != std::string::npos);
+		return std::stoul(diagnostics.substr(position + characterKey.length()));
+		}
+
+	/// @returns The number of times that @c text appears in @c str.
+	size_t count_of(const std::string& str, const std::string& text)
+		{
+		size_t count{ 0 };
+		for (auto position = str.find(text); position != std::string::npos;
+			 position = str.find(text, position + text.length()))
+			{
+			++count;
+			}
+		return count;
+		}
+	}
+
+// clang-format off
+TEST_CASE("Language server", "[lsp][i18n]")
+	{
+	SECTION("Requests and framing")
+		{
+		scripted_input script;
+		script.add(frame(R"({"jsonrpc":"2.0","id":1,"method":"initialize","params":{}})"));
+		// a message split across reads (in the middle of its header and its content)
+		const std::string splitMessage{ frame(R"({"jsonrpc":"2.0","id":"abc","method":"unknown"})") };
+		script.add(splitMessage.substr(0, 10));
+		script.add(splitMessage.substr(10, 20));
+		script.add(splitMessage.substr(30));
+		// headers other than the length are ignored
+		script.add("Content-Type: application/vscode-jsonrpc; charset=utf-8\r\n" +
+				   frame(R"({"jsonrpc":"2.0","id":2,"method":"unknown"})"));
+		script.add(frame(R"({"jsonrpc":"2.0","id":3,)"));
+		script.add(shutdown_request);
+		const auto results = run_session(script);
+
+		CHECK(results.m_exitCode == 0);
+		REQUIRE(results.m_messages.size() == 5);
+		CHECK_THAT(results.m_messages[0], ContainsSubstring(R"("id":1,"result":{"capabilities":{"textDocumentSync":1})"));
+		CHECK_THAT(results.m_messages[1], ContainsSubstring(R"("id":"abc","error":{"code":-32601)"));
+		CHECK_THAT(results.m_messages[2], ContainsSubstring(R"("id":2,"error":{"code":-32601)"));
+		CHECK_THAT(results.m_messages[3], ContainsSubstring(R"("id":null,"error":{"code":-32700)"));
+		CHECK(results.m_messages[4] == R"({"jsonrpc":"2.0","id":99,"result":null})");
+		}
+
+	SECTION("No shutdown request")
+		{
+		scripted_input script;
+		script.add(frame(R"({"jsonrpc":"2.0","id":1,"method":"initialize","params":{}})"));
+		const auto results = run_session(script);
+		CHECK(results.m_exitCode == 1);
+		CHECK(results.m_messages.size() == 1);
+		}
+
+	SECTION("Exit")
+		{
+		// the reader thread may still be using the input after the server exits
+		static scripted_input script;
+		script.add(shutdown_request + frame(R"({"jsonrpc":"2.0","method":"exit"})") +
+				   frame(R"({"jsonrpc":"2.0","id":1,"method":"initialize","params":{}})"));
+		static std::istream input{ &script };
+		cpp_i18n_review cpp(false);
+		rc_file_review rc(false);
+		po_file_review po(false);
+		csharp_i18n_review csharp(false);
+		batch_analyze analyzer(&cpp, &rc, &po, &csharp);
+		std::ostringstream output;
+		CHECK(language_server(analyzer).run(input, output) == 0);
+		// nothing after the exit is processed
+		CHECK_THAT(output.str(), !ContainsSubstring("capabilities"));
+		}
+
+	SECTION("JSON parsing")
+		{
+		scripted_input script;
+		// escapes (including a surrogate pair) are decoded, numeric IDs are echoed verbatim
+		script.add(frame(R"({"jsonrpc":"2.0","id":-12.5e3,"method":"unknown",)"
+						 R"("params":{"a":[true,false,null,"\"\\\/\b\f\n\r\t😀"]}})"));
+		script.add(frame(R"({"jsonrpc":"2.0","id":1,"method":"initialize","params":)" +
+						 std::string(10, '[') + std::string(10, ']') + "}"));
+		script.add(frame(R"({"jsonrpc":"2.0","id":2,"method":"initialize","params":)" +
+						 std::string(10'000, '[') + std::string(10'000, ']') + "}"));
+		script.add(frame(R"({"jsonrpc":"2.0","id":3,"method":"unknown"} trailing)"));
+		script.add(frame(R"({"jsonrpc":"2.0","id":4,"method":"unknown\u12"})"));
+		script.add(shutdown_request);
+		const auto results = run_session(script);
+
+		REQUIRE(results.m_messages.size() == 6);
+		CHECK_THAT(results.m_messages[0], ContainsSubstring(R"("id":-12.5e3,"error":{"code":-32601)"));
+		CHECK_THAT(results.m_messages[1], ContainsSubstring(R"("id":1,"result":)"));
+		// nested too deeply
+		CHECK_THAT(results.m_messages[2], ContainsSubstring(R"("id":null,"error":{"code":-32700)"));
+		CHECK_THAT(results.m_messages[3], ContainsSubstring(R"("id":null,"error":{"code":-32700)"));
+		CHECK_THAT(results.m_messages[4], ContainsSubstring(R"("id":null,"error":{"code":-32700)"));
+		}
+
+	SECTION("Oversized messages are skipped")
+		{
+		scripted_input script;
+		script.add(did_open("file:///src/a.cpp", R"(MessageBox(\"Hello there, world\");)"));
+		script.add(frame(R"({"jsonrpc":"2.0","id":1,"method":"initialize","params":{}})"));
+		script.add(shutdown_request);
+		const auto results = run_session(script, 0ms, 100);
+
+		REQUIRE(results.m_messages.size() == 2);
+		CHECK_THAT(results.m_messages[0], ContainsSubstring(R"("id":1,"result":)"));
+		CHECK(get_diagnostics(results).empty());
+		}
+
+	SECTION("Diagnostics for opened and changed documents")
+		{
+		scripted_input script;
+		script.add(did_open("file:///src/a.cpp", R"(MessageBox(\"Hello there, world\");)"));
+		script.add(did_change("file:///src/a.cpp",
+							  R"(int i;\r\nMessageBox(\"Hello there, world\");\nMessageBox(\"Goodbye cruel world\");)"));
+		script.add(frame(R"({"jsonrpc":"2.0","method":"textDocument/didClose","params":)"
+						 R"({"textDocument":{"uri":"file:///src/a.cpp"}}})"));
+		// changes to a document that isn't open are ignored
+		script.add(did_change("file:///src/b.cpp", R"(MessageBox(\"Hello there, world\");)"));
+		script.add(shutdown_request);
+		const auto results = run_session(script);
+
+		const auto diagnostics = get_diagnostics(results);
+		REQUIRE(diagnostics.size() == 3);
+		CHECK_THAT(diagnostics[0], ContainsSubstring(R"("uri":"file:///src/a.cpp")"));
+		CHECK(count_of(diagnostics[0], R"("code":"notL10NAvailable")") == 1);
+		CHECK_THAT(diagnostics[0], ContainsSubstring(R"("range":{"start":{"line":0,)"));
+		CHECK_THAT(diagnostics[0], ContainsSubstring(R"(\"Hello there, world\")"));
+
+		CHECK(count_of(diagnostics[1], R"("code":"notL10NAvailable")") == 2);
+		CHECK_THAT(diagnostics[1], ContainsSubstring(R"("range":{"start":{"line":1,)"));
+		CHECK_THAT(diagnostics[1], ContainsSubstring(R"("range":{"start":{"line":2,)"));
+		// closing a document clears its diagnostics
+		CHECK(diagnostics[2] == R"({"jsonrpc":"2.0","method":"textDocument/publishDiagnostics",)"
+								R"("params":{"uri":"file:///src/a.cpp","diagnostics":[]}})");
+		}
+
+	SECTION("Columns are in UTF-16 code units")
+		{
+		scripted_input script;
+		script.add(did_open("file:///src/ascii.cpp", R"(/*ab*/ MessageBox(\"Hello there, world\");)"));
+		// U+1F600 (a surrogate pair in UTF-16) in place of "ab"
+		script.add(did_open("file:///src/emoji.cpp", "/*\xF0\x9F\x98\x80*/ MessageBox(\\\"Hello there, world\\\");"));
+		// U+00E9 (one UTF-16 code unit) in place of "a"
+		script.add(did_open("file:///src/accent.cpp", "/*\xC3\xA9*/ MessageBox(\\\"Hello there, world\\\");"));
+		script.add(shutdown_request);
+		const auto results = run_session(script);
+
+		const auto diagnostics = get_diagnostics(results);
+		REQUIRE(diagnostics.size() == 3);
+		const size_t asciiColumn{ get_first_character(diagnostics[0]) };
+		CHECK(asciiColumn > 0);
+		CHECK(get_first_character(diagnostics[1]) == asciiColumn);
+		CHECK(get_first_character(diagnostics[2]) == asciiColumn - 1);
+		}
+
+	SECTION("URIs")
+		{
+		scripted_input script;
+		// percent encoded (the extension is only seen once it is decoded)
+		script.add(did_open("file:///src/my%20file%2Ecpp", R"(MessageBox(\"Hello there, world\");)"));
+		// not valid UTF-8 once decoded, so it can't be analyzed
+		script.add(did_open("file:///src/%FF.cpp", R"(MessageBox(\"Hello there, world\");)"));
+		script.add(frame(R"({"jsonrpc":"2.0","id":1,"method":"initialize","params":{}})"));
+		script.add(shutdown_request);
+		const auto results = run_session(script);
+
+		const auto diagnostics = get_diagnostics(results);
+		REQUIRE(diagnostics.size() == 1);
+		CHECK_THAT(diagnostics[0], ContainsSubstring(R"("uri":"file:///src/my%20file%2Ecpp")"));
+		CHECK(count_of(diagnostics[0], R"("code":"notL10NAvailable")") == 1);
+		// the server is still running
+		REQUIRE(results.m_messages.size() == 3);
+		CHECK_THAT(results.m_messages[1], ContainsSubstring(R"("id":1,"result":)"));
+		}
+
+	SECTION("Debounced changes")
+		{
+		scripted_input script;
+		script.add(did_open("file:///src/a.cpp", R"(MessageBox(\"Hello there, world\");)"));
+		// a burst of changes is only analyzed once, after the document goes idle
+		script.add(did_change("file:///src/a.cpp", R"(int i;)") +
+				   did_change("file:///src/a.cpp", R"(int j;)") +
+				   did_change("file:///src/a.cpp",
+							  R"(MessageBox(\"Hello there, world\");\nMessageBox(\"Goodbye cruel world\");)"));
+		script.add(shutdown_request, 1s);
+		const auto results = run_session(script, 100ms);
+
+		const auto diagnostics = get_diagnostics(results);
+		REQUIRE(diagnostics.size() == 2);
+		CHECK(count_of(diagnostics[0], R"("code":"notL10NAvailable")") == 1);
+		CHECK(count_of(diagnostics[1], R"("code":"notL10NAvailable")") == 2);
+		}
+
+	SECTION("Pending changes")
+		{
+		scripted_input script;
+		script.add(did_open("file:///src/a.cpp", R"(MessageBox(\"Hello there, world\");)"));
+		script.add(did_change("file:///src/a.cpp", R"(int i;)"));
+		script.add(shutdown_request);
+		// the input closes long before the change is due to be analyzed
+		const auto results = run_session(script, 1h);
+		CHECK(get_diagnostics(results).size() == 1);
+		}
+	}
+// NOLINTEND
+// clang-format on
@@ -0,0 +1,671 @@
+#include "../src/i18n_matchers.h"
+#include "../src/regex_pattern.h"
+#include "../src/regex_profiler.h"
+#include "../src/regex_set.h"
+#include <algorithm>
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <random>
+#include <regex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+// NOLINTBEGIN
+using namespace i18n_check;
+using namespace i18n_matchers;
+
+namespace
+    {
+    // building blocks for the random strings (single characters and fragments of what the
+    // patterns are looking for, so that near misses are generated as well)
+    const std::vector<std::wstring> fuzzTokens =
+        {
+        L"a", L"Z", L"s", L"u", L"d", L"i", L"l", L"x", L"0", L"9", L"_", L"-", L":", L"'", L"\"",
+        L".", L"[", L"]", L"/", L"{", L"}", L"\\", L"=", L" ", L"\t", L"\n", L"\r", L"(", L")",
+        L",", L"#", L"+", L"&", L";", L"%", L"<", L">", L"!", L"?", L"*", L"\u00E9", L"\u0416",
+        L"\u2028", L"\u00A0", L"CTRL", L"ctrl", L"Shift", L"CMD", L"alt", L"span", L"P", L"html",
+        L"?xml", L"!--", L"!DOCTYPE", L"h1", L"br", L"a ", L"select *", L"SELECT *",
+        L"create table", L"COLLATE DATABASE_DEFAULT", L"Drop Table", L"Lorem ipsum",
+        L"the quick brown fox", L"amp", L"nbsp", L"&amp;", L"&#160;", L"</", L"/>", L"{1}",
+        L"%d", L"%lu", L"100", L"(s)", L"Item", L"doc-val"
+        };
+
+    // half of the tokens are from the pattern-specific ones, so that it gets matches
+    std::wstring make_random_string(std::mt19937& generator,
+                                    const std::vector<std::wstring>& patternTokens)
+        {
+        std::uniform_int_distribution<size_t> lengthDistribution(0, 8);
+        std::uniform_int_distribution<size_t> tokenDistribution(0, fuzzTokens.size() - 1);
+        std::uniform_int_distribution<size_t> patternTokenDistribution(0, patternTokens.size() - 1);
+        std::bernoulli_distribution usePatternToken(0.5);
+        std::wstring str;
+        const auto tokenCount = lengthDistribution(generator);
+        for (size_t i = 0; i < tokenCount; ++i)
+            {
+            str += usePatternToken(generator) ? patternTokens[patternTokenDistribution(generator)] :
+                                                fuzzTokens[tokenDistribution(generator)];
+            }
+        return str;
+        }
+
+    std::string to_printable(const std::wstring& str)
+        {
+        std::string printable;
+        for (const auto ch : str)
+            {
+            if (ch >= 32 && ch < 127)
+                {
+                printable += static_cast<char>(ch);
+                }
+            else
+                {
+                printable += "\\u" + std::to_string(static_cast<uint32_t>(ch));
+                }
+            }
+        return printable;
+        }
+
+    /// Verifies that a matcher agrees with the regex that it replaces, for the provided
+    /// strings and a large number of random ones.
+    void check_against_regex(const std::wregex& expression,
+                             const std::function<bool(std::wstring_view)>& matcher,
+                             const std::vector<std::wstring>& knownCases,
+                             const std::vector<std::wstring>& patternTokens)
+        {
+        for (const auto& str : knownCases)
+            {
+            INFO(to_printable(str));
+            CHECK(matcher(str) == std::regex_match(str, expression));
+            }
+
+        std::mt19937 generator(8675309);
+        size_t mismatches{ 0 };
+        for (size_t i = 0; i < 20'000; ++i)
+            {
+            const auto str = make_random_string(generator, patternTokens);
+            if (matcher(str) != std::regex_match(str, expression))
+                {
+                ++mismatches;
+                UNSCOPED_INFO(to_printable(str));
+                }
+            }
+        CHECK(mismatches == 0);
+        }
+    }
+
+// clang-format off
+TEST_CASE("Matchers", "[matchers]")
+    {
+    SECTION("Function signature")
+        {
+        check_against_regex(std::wregex{ LR"([[:alnum:]]{2,}[(][[:alnum:]]+(,[[:space:]]*[[:alnum:]]+)*[)])" },
+            is_function_signature,
+            { L"", L"fn(a)", L"fn(a, b,c)", L"f(a)", L"fn()", L"fn(a,)", L"fn(a, b) ", L"fn(a,\tb)" },
+            { L"fn", L"(", L")", L",", L", ", L"x", L"ab" });
+        CHECK(is_function_signature(L"GetValue(x, y)"));
+        CHECK_FALSE(is_function_signature(L"GetValue(x, y"));
+        }
+
+    SECTION("Open function signature")
+        {
+        check_against_regex(std::wregex{ LR"([[:alnum:]]{2,}[(])" }, is_open_function_signature,
+            { L"", L"fn(", L"f(", L"fn(a", L"(" },
+            { L"fn", L"(", L"x" });
+        }
+
+    SECTION("Plural")
+        {
+        check_against_regex(std::wregex{ LR"([[:alnum:]]{2,}[(]s[)])" }, is_plural_suffix,
+            { L"Item(s)", L"I(s)", L"Item(s) ", L"Item(S)" },
+            { L"Item", L"(s)", L"(", L"s", L")" });
+        CHECK(is_plural_suffix(L"File(s)"));
+        }
+
+    SECTION("Percentage")
+        {
+        check_against_regex(std::wregex{ LR"(([0-9]+|\{[a-z0-9]\}|%[udil]{1,2})%)" }, is_percentage,
+            { L"%", L"100%", L"{1}%", L"{a}%", L"{A}%", L"%d%", L"%lu%", L"%lld%", L"%%" },
+            { L"%", L"1", L"{", L"}", L"u", L"l", L"d" });
+        }
+
+    SECTION("Hashtag")
+        {
+        check_against_regex(std::wregex{ LR"(#[[:alnum:]]{2,})" }, is_hashtag,
+            { L"#", L"#a", L"#ab", L"#ab ", L"##ab" },
+            { L"#", L"a", L"b2" });
+        }
+
+    SECTION("Key shortcut")
+        {
+        check_against_regex(std::wregex{ LR"((CTRL|SHIFT|CMD|ALT)([+](CTRL|SHIFT|CMD|ALT))*([+][[:alnum:]])+)",
+                                         std::regex_constants::icase },
+            is_key_shortcut,
+            { L"CTRL+C", L"Ctrl+Shift+S", L"CTRL+CMD", L"CTRL+A+ALT", L"CTRL+", L"CTRL++A",
+              L"+A", L"ALT+F4", L"alt+f+4", L"CTRL+AB" },
+            { L"CTRL", L"Alt", L"+", L"A", L"4", L"shift", L"cmd" });
+        }
+
+    SECTION("SQL")
+        {
+        check_against_regex(std::wregex{ LR"(.*(SELECT \*|CREATE TABLE|CREATE INDEX|COLLATE NOCASE|ALTER TABLE|DROP TABLE|COLLATE DATABASE_DEFAULT).*)",
+                                         std::regex_constants::icase },
+            is_sql_code,
+            { L"SELECT * FROM t", L"x select * y", L"SELECT *\nFROM", L"drop  table" },
+            { L"Select *", L"alter table", L"CREATE INDEX", L"collate nocase", L"x" });
+        }
+
+    SECTION("Placeholder text")
+        {
+        check_against_regex(std::wregex{ LR"(Lorem ipsum.*)", std::regex_constants::icase },
+            [](std::wstring_view text) { return starts_with_line_icase(text, L"Lorem ipsum"); },
+            { L"Lorem ipsum dolor", L"lorem IPSUM", L"Lorem ipsum\ndolor", L"Lorem" },
+            { L"LOREM IPSUM", L"Lorem ipsu", L" dolor" });
+        }
+
+    SECTION("HTML entities")
+        {
+        check_against_regex(std::wregex{ LR"(&[a-zA-Z]{2,5};.*)" }, starts_with_html_entity,
+            { L"&amp; more", L"&a;", L"&abcdef;", L"&nbsp;\n", L"&\u00E9\u00E9;" },
+            { L"&", L"ab", L"c", L";" });
+        check_against_regex(std::wregex{ LR"(&#[[:digit:]]{2,4};.*)" }, starts_with_html_numeric_entity,
+            { L"&#160; more", L"&#1;", L"&#12345;", L"&#12;" },
+            { L"&#", L"1", L"23", L";" });
+        }
+
+    SECTION("XML element")
+        {
+        check_against_regex(std::wregex{ LR"(<\/?[a-zA-Z0-9_:'"\.\[\]\/\{\}\-\\=][a-zA-Z0-9_:'"\.\[\]\/\{\}\- \\=]+\/?>)",
+                                         std::regex_constants::icase },
+            is_xml_element,
+            { L"<a>", L"<ab>", L"</ab>", L"<ab/>", L"<//>", L"<s:complex name=\"{{GetFunctionName}}_Array\">",
+              L"< ab>", L"<a b>", L"<\u00E9b>" },
+            { L"<", L">", L"ab", L"/", L" ", L"_", L"{{x}}", L"=" });
+        }
+
+    SECTION("HTML")
+        {
+        check_against_regex(std::wregex{ LR"([^[:alnum:]<]*<(span|object|property|div|p|ul|ol|li|img|html|[?]xml|meta|body|table|tbody|tr|td|thead|head|title|a[[:space:]]|!--|/|!DOCTYPE|br|center|dd|em|dl|dt|tt|font|form|h[[:digit:]]|hr|main|map|pre|script).*)",
+                                         std::regex_constants::icase },
+            is_html_markup,
+            { L"<span>text</span>", L"(<P>", L"a<p>", L"<a\nhref>", L"<pre\nx", L"<p\nx", L"<H1>",
+              L"<!DOCTYPE html>", L"<?xml version>", L"<x>" },
+            { L"<", L"(", L"pre", L"td", L"a", L"h", L"2", L" " });
+        }
+
+    SECTION("HTML element with content")
+        {
+        check_against_regex(std::wregex{ LR"(<[a-zA-Z0-9_\-]+>[[:print:][:cntrl:]]*</[a-zA-Z0-9_\-]+>)",
+                                         std::regex_constants::icase },
+            is_html_element_with_content,
+            { L"<doc-val>Some text</doc-val>", L"<a></a>", L"<a></>", L"<a>b</a>c>", L"<a>\n</b>",
+              L"<a>\u00E9</a>", L"<a></a></a>", L"<a>/a>" },
+            { L"<a>", L"</a>", L"<doc-val>", L"</doc-val>", L"<", L">", L"</", L"a", L"text", L"\t" });
+        }
+    }
+
+TEST_CASE("Regex set", "[matchers]")
+    {
+    // the same kinds of patterns as in the untranslatable string rules
+    const std::vector<std::pair<std::wstring, std::regex_constants::syntax_option_type>> patterns =
+        {
+        { LR"(([[:digit:][:space:][:punct:][:cntrl:]]|\\[rnt])+)", std::regex_constants::ECMAScript },
+        { LR"(Lorem ipsum.*)", std::regex_constants::icase },
+        { LR"(^(INSERT INTO|DELETE ([*] )?FROM).*)", std::regex_constants::icase },
+        { LR"([(]*SELECT[[:space:]]+[A-Z_0-9\.]+,.*)", std::regex_constants::ECMAScript },
+        { LR"([[:space:]]*(ABCDEFG|abcdefg|AEIOU|aeiou).*)", std::regex_constants::ECMAScript },
+        { LR"(&[#]?[xX]?[A-Za-z0-9]+;)", std::regex_constants::ECMAScript },
+        { LR"(#[a-zA-Z0-9\-]{3,})", std::regex_constants::ECMAScript },
+        { LR"([\s\S]*(\{[[:space:]]*[a-zA-Z\-]+[[:space:]]*[:][[:space:]]*[0-9a-zA-Z\- ;%#'",]+[[:space:]]*\})+[\s\S]*)", std::regex_constants::ECMAScript },
+        { LR"(^[[:space:]]*<port\b.*)", std::regex_constants::ECMAScript },
+        { LR"(^[a-zA-Z0-9.!#$%&'*+/=?^_`{|}~-]+@[a-zA-Z0-9](?:[a-zA-Z0-9-]{0,61}[a-zA-Z0-9])?$)", std::regex_constants::ECMAScript },
+        { LR"([[:punct:]]*[a-z]+[[:digit:]]*([A-Z]+[a-z0-9]*)+[[:punct:]]*)", std::regex_constants::ECMAScript },
+        { LR"((=)?[A-Za-z0-9_]{3,}[(]([RC0-9\-\.,;:\[\] ])*[)])", std::regex_constants::ECMAScript },
+        { LR"((so|dll|exe|txt))", std::regex_constants::icase },
+        { LR"([^a-z]{2})", std::regex_constants::ECMAScript },
+        { LR"(\w+ [\-][a-zA-Z]+)", std::regex_constants::ECMAScript },
+        { LR"(\x41BC)", std::regex_constants::ECMAScript },
+        { LR"([\u00E9-\u00FF]+x?)", std::regex_constants::ECMAScript },
+        { LR"(\u00C9T\u00C9)", std::regex_constants::icase },
+        { LR"((a*|b?)c{0,2})", std::regex_constants::ECMAScript }
+        };
+
+    regex_set expressions;
+    std::vector<std::wregex> compiledExpressions;
+    for (const auto& [pattern, flags] : patterns)
+        {
+        expressions.add(pattern, flags);
+        compiledExpressions.emplace_back(pattern, flags);
+        }
+    // compiled expressions (which aren't analyzed) are supported also
+    expressions.add(std::wregex{ LR"(XYZ[0-9]+)" });
+    compiledExpressions.emplace_back(LR"(XYZ[0-9]+)");
+    CHECK(expressions.size() == compiledExpressions.size());
+
+    const auto findFirstMatch = [&compiledExpressions](const std::wstring& str)
+        {
+        for (size_t i = 0; i < compiledExpressions.size(); ++i)
+            {
+            if (std::regex_match(str, compiledExpressions[i]))
+                {
+                return i;
+                }
+            }
+        return regex_set::npos;
+        };
+
+    SECTION("Known cases")
+        {
+        CHECK(expressions.find_match(L"lorem ipsum dolor") == 1);
+        CHECK(expressions.find_match(L"12, 3") == 0);
+        CHECK(expressions.find_match(L"delete * from t") == 2);
+        CHECK(expressions.find_match(L"  <port name") == 8);
+        CHECK(expressions.find_match(L"DLL") == 12);
+        CHECK(expressions.find_match(L"ABC") == 15);
+        CHECK(expressions.find_match(L"\u00C9t\u00C9") == 17);
+        CHECK(expressions.find_match(L"") == 18);
+        CHECK(expressions.find_match(L"XYZ12") == 19);
+        CHECK(expressions.find_match(L"Open the file.") == regex_set::npos);
+        CHECK(expressions.is_match(L"getValue"));
+        CHECK_FALSE(expressions.is_match(L"Hello there"));
+        }
+
+    SECTION("Required text")
+        {
+        regex_set sqlExpressions{ { LR"(.*(SELECT \*|DROP TABLE).*)", std::regex_constants::icase },
+                                  { LR"(.*\bORDER BY[[:space:]]+[a-z]+)" },
+                                  { LR"([(]*select[[:space:]]+[a-z]+)", std::regex_constants::icase } };
+        // no text required from the alternation, so the first one is always run
+        CHECK(sqlExpressions.find_match(L"Sort the items") == regex_set::npos);
+        CHECK(sqlExpressions.get_statistics().m_literal_skips == 2);
+        CHECK(sqlExpressions.get_statistics().m_regex_evaluations == 1);
+
+        sqlExpressions.reset_statistics();
+        CHECK(sqlExpressions.find_match(L"x order by name") == regex_set::npos);
+        CHECK(sqlExpressions.find_match(L"x ORDER BY name") == 1);
+        CHECK(sqlExpressions.find_match(L"((SeLeCt name") == 2);
+        CHECK(sqlExpressions.get_statistics().m_literal_skips == 2);
+        CHECK(sqlExpressions.get_statistics().m_regex_evaluations == 5);
+        // the third one can't start with 'x' (and the first two were candidates)
+        CHECK(sqlExpressions.get_statistics().m_first_character_skips == 1);
+        }
+
+    SECTION("Same as trying every expression")
+        {
+        const std::vector<std::wstring> patternTokens =
+            {
+            L"Lorem ipsum", L"INSERT INTO", L"delete from", L"SELECT ", L"AEIOU", L"&amp;",
+            L"#abc", L"{ color: red; }", L"<port", L"me@example.com", L"getValue", L"SUM(1; 2)",
+            L"DLL", L"ABC", L"XYZ1", L"lpstat -p", L"\u00E9", L"\u00C9T\u00C9", L"aac"
+            };
+        std::mt19937 generator(8675309);
+        size_t mismatches{ 0 };
+        for (size_t i = 0; i < 20'000; ++i)
+            {
+            const auto str = make_random_string(generator, patternTokens);
+            if (expressions.find_match(str) != findFirstMatch(str))
+                {
+                ++mismatches;
+                UNSCOPED_INFO(to_printable(str));
+                }
+            }
+        CHECK(mismatches == 0);
+        }
+    }
+
+TEST_CASE("Printf specifiers", "[matchers]")
+    {
+    const std::array<std::wregex, 4> printfExpressions =
+        {
+        std::wregex{ LR"((^|\b|[%]{2}|[^%])([%]([[:digit:]]+[$])?([+]|[-] #0)?(([*]|[[:digit:]]+)*[.]?[[:digit:]]*)?(l)?(d|i|o|u|zu|c|C|e|E|x|X|l|I|I32|I64|<PRI(d|i|u|x)(32|64)>)))" },
+        std::wregex{ LR"((^|\b|[%]{2}|[^%])([%]([[:digit:]]+[$])?([+]|[-] #0)?(([*]|[[:digit:]]+)*[.]?[[:digit:]]*)?(l|L)?(f|F)))" },
+        std::wregex{ LR"((^|\b|[%]{2}|[^%])([%]([[:digit:]]+[$])?[-]?(([*]|[[:digit:]]+)*[.][[:digit:]]*)?s))" },
+        std::wregex{ LR"((^|\b|[%]{2}|[^%])[%]([%]([[:digit:]]+[$])?p))" }
+        };
+
+    // (lead position, specifier position, specifier length), sorted by the lead position
+    using specifier_positions = std::vector<std::tuple<size_t, size_t, size_t>>;
+
+    // searches for each type of specifier, one after the other
+    const auto searchWithRegexes = [&printfExpressions](const std::wstring& str)
+        {
+        specifier_positions results;
+        for (const auto& expression : printfExpressions)
+            {
+            auto searchStart{ str.cbegin() };
+            std::wsmatch res;
+            while (std::regex_search(searchStart, str.cend(), res, expression))
+                {
+                const auto leadPosition =
+                    static_cast<size_t>(std::distance(str.cbegin(), searchStart) + res.position());
+                results.emplace_back(leadPosition,
+                                     static_cast<size_t>(std::distance(str.cbegin(), searchStart) +
+                                                         res.position(2)),
+                                     static_cast<size_t>(res.length(2)));
+                searchStart += res.position() + res.length();
+                }
+            }
+        std::stable_sort(results.begin(), results.end(), [](const auto& lhv, const auto& rhv)
+            { return std::get<0>(lhv) < std::get<0>(rhv); });
+        return results;
+        };
+
+    const auto searchWithLexer = [](const std::wstring& str)
+        {
+        specifier_positions results;
+        for (const auto& specifier : find_cpp_printf_specifiers(str))
+            {
+            results.emplace_back(specifier.m_lead_position, specifier.m_position,
+                                 specifier.m_length);
+            }
+        std::stable_sort(results.begin(), results.end(), [](const auto& lhv, const auto& rhv)
+            { return std::get<0>(lhv) < std::get<0>(rhv); });
+        return results;
+        };
+
+    SECTION("Known cases")
+        {
+        for (const std::wstring str :
+             { L"", L"%d", L"%%d", L"%%%d", L"100%d", L"a%d", L" %d", L"%5.2f items %s",
+               L"%1$s %2$d", L"%-10s", L"%.3s", L"%lu", L"%ld %lf %Lf", L"%l", L"%zu", L"%z",
+               L"%I64d", L"%<PRId64>", L"%<PRIu32>", L"%<PRIx16>", L"%%p", L"%%1$p", L"x%%p",
+               L"%+d", L"%- #0d", L"%- #0s", L"%*.*f", L"%1$-*s", L"%f%f%f", L"%s%%s", L"%%%%s",
+               L"\n%d", L"\u00E9%d" })
+            {
+            INFO(to_printable(str));
+            CHECK(searchWithLexer(str) == searchWithRegexes(str));
+            }
+
+        const auto specifiers = find_cpp_printf_specifiers(L"%s and %d");
+        REQUIRE(specifiers.size() == 2);
+        // grouped by type, integers first
+        CHECK(specifiers[0].m_position == 7);
+        CHECK(specifiers[0].m_length == 2);
+        CHECK(specifiers[1].m_position == 0);
+        CHECK(specifiers[1].m_length == 2);
+        }
+
+    SECTION("Positional")
+        {
+        const std::wregex positionalRegex{ L"^%([[:digit:]]+)[$](.*)" };
+        for (const std::wstring str :
+             { L"", L"%s", L"%1$s", L"%12$-5d", L"%$s", L"%1s", L"1$s", L"%1$", L"%1$s\nx" })
+            {
+            INFO(to_printable(str));
+            const auto [digits, specifier] = split_positional_printf_specifier(str);
+            std::wsmatch matches;
+            if (std::regex_search(str, matches, positionalRegex))
+                {
+                CHECK(digits == matches.str(1));
+                CHECK(specifier == matches.str(2));
+                }
+            else
+                {
+                CHECK(digits.empty());
+                }
+            }
+        }
+
+    SECTION("Same as the regular expressions")
+        {
+        const std::vector<std::wstring> patternTokens =
+            {
+            L"%", L"%%", L"%", L"d", L"l", L"lf", L"Lf", L"f", L"s", L"p", L"1$", L"12$", L".2",
+            L".", L"*", L"+", L"- #0", L"-", L"<PRId64>", L"<PRIu3", L"I64", L"zu", L"z", L"x",
+            L"5", L"a", L" "
+            };
+        std::mt19937 generator(8675309);
+        size_t mismatches{ 0 };
+        for (size_t i = 0; i < 20'000; ++i)
+            {
+            const auto str = make_random_string(generator, patternTokens);
+            if (searchWithLexer(str) != searchWithRegexes(str))
+                {
+                ++mismatches;
+                UNSCOPED_INFO(to_printable(str));
+                }
+            }
+        CHECK(mismatches == 0);
+        }
+    }
+
+TEST_CASE("ID assignments", "[matchers]")
+    {
+    SECTION("Declarations")
+        {
+        const auto assignments = find_id_assignments(
+            L"static int const MENU_ID_NEW = (({ 1000}));\n"
+            L"#define IDD_ABOUTBOX    100\n"
+            L"UINT ID_PRINT_ALL(wxID_HIGHEST  +1);\n"
+            L"int baseYearID = Model_Budgetyear::instance().Get(baseYear);\n"
+            L"int val = 5; int ID_X; uint32_t listID;\n"
+            L"pointID = 7; #defineID 8");
+        REQUIRE(assignments.size() == 4);
+        CHECK(assignments[0].m_position == 7);
+        CHECK(assignments[0].m_name == L"MENU_ID_NEW");
+        CHECK(assignments[0].m_value == L"1000");
+        CHECK(assignments[0].m_following_char == L'}');
+        CHECK(assignments[1].m_name == L"IDD_ABOUTBOX");
+        CHECK(assignments[1].m_value == L"100");
+        CHECK(assignments[1].m_following_char == 0);
+        CHECK(assignments[2].m_name == L"ID_PRINT_ALL");
+        CHECK(assignments[2].m_value == L"wxID_HIGHEST  +1");
+        CHECK(assignments[3].m_name == L"baseYearID");
+        CHECK(assignments[3].m_value == L"Model_Budgetyear::instance");
+        CHECK(assignments[3].m_following_char == L'(');
+        }
+
+    SECTION("Integers")
+        {
+        CHECK(read_integer(L"1000") == 1000);
+        CHECK(read_integer(L"-1001") == -1001);
+        CHECK(read_integer(L"12L") == 12);
+        CHECK(read_integer(L"0x6FFF", 16) == 0x6FFF);
+        CHECK(read_integer(L"6fff", 16) == 0x6FFF);
+        CHECK(read_integer(L"0x10") == 0);
+        CHECK_FALSE(read_integer(L"wxID_HIGHEST").has_value());
+        CHECK_FALSE(read_integer(L"-").has_value());
+        CHECK_FALSE(read_integer(L"").has_value());
+        CHECK_FALSE(read_integer(L"99999999999").has_value());
+        }
+    }
+
+TEST_CASE("Regex profiling", "[matchers]")
+    {
+    const std::wregex digits{ L"[0-9]+" };
+    const std::wstring text{ L"abc 123" };
+    size_t evaluations{ 0 };
+    const auto search = [&](const std::wstring& str)
+    {
+        ++evaluations;
+        return std::regex_search(str, digits);
+    };
+
+#ifdef QUNEIFORM_REGEX_PROFILING
+    regex_profiler::reset();
+#endif
+    // the call is evaluated once (and its result returned), whether profiling or not
+    CHECK(I18N_PROFILE_REGEX(L"digits", search(text)));
+    CHECK_FALSE(I18N_PROFILE_REGEX(L"digits", search(L"abc")));
+    CHECK(I18N_PROFILE_REGEX(L"digits replace", std::regex_replace(text, digits, L"#")) ==
+          L"abc #");
+    CHECK(evaluations == 2);
+
+    regex_set set;
+    set.add(L"[a-z]+");
+    set.add(L"[0-9]+");
+    CHECK(set.find_match(L"42") == 1);
+
+#ifdef QUNEIFORM_REGEX_PROFILING
+    set.set_profile_name(L"test set");
+    CHECK(set.find_match(L"42") == 1);
+
+    const auto statistics = regex_profiler::get_ranked_statistics();
+    const auto findRule = [&statistics](std::wstring_view name)
+    {
+        return std::find_if(statistics.cbegin(), statistics.cend(),
+                            [name](const auto& rule) { return rule.m_name == name; });
+    };
+    REQUIRE(findRule(L"digits") != statistics.cend());
+    CHECK(findRule(L"digits")->m_invocations == 2);
+    CHECK(findRule(L"digits")->m_matches == 1);
+    CHECK(findRule(L"digits")->m_reports_matches);
+    REQUIRE(findRule(L"digits replace") != statistics.cend());
+    CHECK(findRule(L"digits replace")->m_invocations == 1);
+    CHECK_FALSE(findRule(L"digits replace")->m_reports_matches);
+    // "[a-z]+" can't start with '4', so it is never run
+    CHECK(findRule(L"test set: [a-z]+") == statistics.cend());
+    REQUIRE(findRule(L"test set: [0-9]+") != statistics.cend());
+    CHECK(findRule(L"test set: [0-9]+")->m_matches == 1);
+    CHECK(findRule(L"regex set: [0-9]+") != statistics.cend());
+    // ranked by time
+    CHECK(std::is_sorted(statistics.cbegin(), statistics.cend(),
+                         [](const auto& lhs, const auto& rhs) { return lhs.m_time > rhs.m_time; }));
+    regex_profiler::reset();
+    CHECK(regex_profiler::get_ranked_statistics().empty());
+#endif
+    }
+
+TEST_CASE("Regex pattern", "[matchers]")
+    {
+    // results should be the same as std::wregex, whichever engine is running them
+    const regex_pattern number{ LR"(([0-9]+)([.][0-9]+)?)" };
+    CHECK(number.matches(L"3.14"));
+    CHECK_FALSE(number.matches(L"3.14 apples"));
+    CHECK_FALSE(number.matches(L"pi"));
+    CHECK(number.contains(L"about 3.14 apples"));
+    REQUIRE(number.search(L"about 3.14 apples").has_value());
+    CHECK(number.search(L"about 3.14 apples")->m_position == 6);
+    CHECK(number.search(L"about 3.14 apples")->m_length == 4);
+    CHECK_FALSE(number.search(L"no numbers").has_value());
+    CHECK(number.count(L"1, 22, and 3.5") == 3);
+    CHECK(number.count(L"") == 0);
+    CHECK(number.replace(L"1, 22, and 3.5", L"<$1>") == L"<1>, <22>, and <3>");
+    CHECK(number.replace(L"no numbers", L"#") == L"no numbers");
+
+    const regex_pattern caseless{ L"select", std::regex_constants::icase };
+    CHECK(caseless.matches(L"SELECT"));
+    CHECK(caseless.matches(L"Select"));
+    CHECK_FALSE(regex_pattern{ L"select" }.matches(L"SELECT"));
+
+    // '.' and '$' follow ECMAScript's rules
+    const regex_pattern line{ L"a.*$" };
+    CHECK(line.matches(L"abc"));
+    CHECK_FALSE(line.matches(L"ab\nc"));
+    CHECK(line.count(L"ab\nac") == 1);
+
+    // an empty expression only has empty matches
+    CHECK(regex_pattern{ L"x*" }.count(L"ab") == 3);
+    CHECK_FALSE(regex_pattern{}.matches(L"text"));
+
+    // already compiled expressions
+    const regex_pattern compiled{ std::wregex{ L"[a-z]+" } };
+    CHECK(compiled.matches(L"word"));
+    CHECK(compiled.get_pattern().empty());
+    CHECK(number.get_pattern() == LR"(([0-9]+)([.][0-9]+)?)");
+    CHECK_FALSE(regex_pattern::get_engine_name().empty());
+
+    CHECK_THROWS_AS(regex_pattern{ L"(unclosed" }, std::regex_error);
+
+    SECTION("Prefilter")
+        {
+        const regex_pattern badAmpersand{ L"&amp;[a-zA-Z]{3,5};" };
+        const regex_pattern caselessTable{ L".*DROP TABLE.*", std::regex_constants::icase };
+        regex_pattern::reset_statistics();
+        // the required text isn't there, so the engine isn't run
+        CHECK_FALSE(badAmpersand.contains(L"Tom & Jerry"));
+        CHECK(badAmpersand.count(L"&amp ;") == 0);
+        CHECK(badAmpersand.replace(L"R&D", L"and") == L"R&D");
+        CHECK_FALSE(caselessTable.matches(L"Drop the table"));
+        CHECK(regex_pattern::get_statistics().m_literal_skips == 4);
+        CHECK(regex_pattern::get_statistics().m_regex_evaluations == 0);
+        // can't begin with a digit
+        CHECK_FALSE(badAmpersand.matches(L"1&amp;nbsp;"));
+        CHECK(regex_pattern::get_statistics().m_first_character_skips == 1);
+
+        // but it is when the text is
+        CHECK(badAmpersand.contains(L"Tom &amp;amp; Jerry"));
+        CHECK(badAmpersand.replace(L"a&amp;nbsp;b", L" ") == L"a b");
+        CHECK(caselessTable.matches(L"x; drop table users"));
+        // letters beyond 7-bit may fold to the required text, so they aren't skipped
+        CHECK_FALSE(caselessTable.matches(L"drop \u017Fable"));
+        CHECK(regex_pattern::get_statistics().m_literal_skips == 4);
+        CHECK(regex_pattern::get_statistics().m_regex_evaluations == 4);
+
+        // expressions that aren't analyzed are always run
+        const regex_pattern compiledAmpersand{ std::wregex{ L"&amp;[a-z]+;" } };
+        CHECK_FALSE(compiledAmpersand.contains(L"Tom & Jerry"));
+        CHECK(regex_pattern::get_statistics().m_regex_evaluations == 5);
+        }
+    }
+
+TEST_CASE("Regex construction", "[matchers]")
+    {
+    // Expressions should be compiled once (as statics or in the shared rule tables),
+    // not every time a function that reviews a string or file is called.
+    // Outside of the files that build them once, only static expressions are allowed.
+#ifdef QUNEIFORM_SOURCE_DIR
+    const std::filesystem::path sourceFolder{ QUNEIFORM_SOURCE_DIR };
+#else
+    const std::filesystem::path sourceFolder{ std::filesystem::path{ __FILE__ }.parent_path() /
+                                              "../src" };
+#endif
+    if (!std::filesystem::is_directory(sourceFolder))
+        {
+        SKIP("The source files are not available");
+        }
+
+    // the expression class itself, the rule tables and reviewers' expressions
+    // (built in their constructors), and the GUI's user-defined patterns
+    // (compiled when a project's settings are loaded)
+    const std::array<std::filesystem::path, 4> allowedFiles{ "regex_pattern.h",
+                                                             "regex_pattern.cpp",
+                                                             "i18n_review.cpp",
+                                                             "gui/i18nframe.cpp" };
+    const std::regex construction{ R"(\b(std::wregex|regex_pattern)(\s+\w+)?\s*[({])" };
+    const std::regex staticDeclaration{
+        R"(\bstatic\s+(const\s+)?(std::wregex|regex_pattern)\s+\w+\s*[({])" };
+
+    size_t filesReviewed{ 0 };
+    std::vector<std::string> offenders;
+    for (const auto& entry : std::filesystem::recursive_directory_iterator{ sourceFolder })
+        {
+        const auto extension = entry.path().extension();
+        if (!entry.is_regular_file() || (extension != ".cpp" && extension != ".h"))
+            {
+            continue;
+            }
+        ++filesReviewed;
+        const auto relativePath = entry.path().lexically_relative(sourceFolder);
+        if (std::find(allowedFiles.cbegin(), allowedFiles.cend(), relativePath) !=
+            allowedFiles.cend())
+            {
+            continue;
+            }
+        std::ifstream sourceFile{ entry.path() };
+        std::string line;
+        size_t lineNumber{ 0 };
+        while (std::getline(sourceFile, line))
+            {
+            ++lineNumber;
+            if (std::regex_search(line, construction) &&
+                !std::regex_search(line, staticDeclaration))
+                {
+                offenders.push_back(relativePath.generic_string() + ":" +
+                                    std::to_string(lineNumber));
+                }
+            }
+        }
+    CHECK(filesReviewed > 0);
+    for (const auto& offender : offenders)
+        {
+        UNSCOPED_INFO(offender);
+        }
+    CHECK(offenders.empty());
+    }
+
+// clang-format on
+// NOLINTEND
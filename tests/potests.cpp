@@ -24,13 +24,140 @@ msgstr "<%1> text")";
 		po(code, L"");
 		po.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
 
-		const auto issues = std::count_if(
-			po.get_catalog_entries().cbegin(), po.get_catalog_entries().cend(), [](const auto& ent)
-			{ return ent.second.m_issues.size() > 0; });
+		const auto issues = po.get_catalog_entries_with_issues_count();
 		CHECK(issues == 0);
 		}
 	}
 
+TEST_CASE("Entry parsing", "[po][l10n]")
+	{
+	SECTION("Translator comments")
+		{
+		po_file_review po(false);
+		const wchar_t* code = LR"(
+
+#. TRANSLATORS: %s is the
+#. name of the file
+#: ../src/common/file.cpp:604
+#, c-format
+msgid "Opening %s"
+msgstr "Ouverture de %s")";
+		po(code, L"");
+
+		REQUIRE(po.get_catalog_entry_count() == 1);
+		CHECK(po.get_catalogs()[0].m_entries[0].m_comment ==
+			  L"TRANSLATORS: %s is the name of the file");
+		CHECK(po.get_catalogs()[0].m_entries[0].m_po_format == po_format_string::cpp_format);
+		}
+
+	SECTION("Multiline and plural")
+		{
+		po_file_review po(false);
+		const wchar_t* code = LR"(
+
+#: ../src/common/file.cpp:604
+#, qt-format
+msgctxt "File count"
+msgid ""
+"%n file "
+"was opened"
+msgid_plural "%n files were opened"
+msgstr[0] "%n fichier "
+"a été ouvert"
+msgstr[1] "%n fichiers ont été ouverts")";
+		po(code, L"");
+
+		REQUIRE(po.get_catalog_entry_count() == 1);
+		const auto& entry = po.get_catalogs()[0].m_entries[0];
+		CHECK(entry.m_source == L"%n file was opened");
+		CHECK(entry.m_source_plural == L"%n files were opened");
+		CHECK(entry.m_translation == L"%n fichier a été ouvert");
+		CHECK(entry.m_translation_plural == L"%n fichiers ont été ouverts");
+		CHECK(entry.m_comment == L"File count");
+		CHECK(entry.m_po_format == po_format_string::qt_format);
+		}
+
+	SECTION("Previous source string")
+		{
+		po_file_review po(false);
+		po.review_fuzzy_translations(true);
+		const wchar_t* code = LR"(
+
+#: ../src/common/file.cpp:604
+#, fuzzy, c-format
+#| msgid "Opening %s"
+msgid "Opening %s..."
+msgstr "Ouverture de %s")";
+		po(code, L"");
+
+		REQUIRE(po.get_catalog_entry_count() == 1);
+		CHECK(po.get_catalogs()[0].m_entries[0].m_source == L"Opening %s...");
+		CHECK(po.get_catalogs()[0].m_entries[0].m_translation == L"Ouverture de %s");
+		CHECK(po.get_catalogs()[0].m_entries[0].m_po_format == po_format_string::cpp_format);
+		}
+	}
+
+TEST_CASE("Catalogs", "[po][l10n]")
+	{
+	SECTION("Grouped by file")
+		{
+		po_file_review po(false);
+		const wchar_t* code = LR"(
+
+#: ../src/common/file.cpp:604
+msgid "Open"
+msgstr "Ouvrir"
+
+#: ../src/common/file.cpp:612
+msgid "Close"
+msgstr "Fermer")";
+		po(code, L"fr.po");
+		po(code, L"fr_CA.po");
+
+		REQUIRE(po.get_catalogs().size() == 2);
+		CHECK(po.get_catalog_entry_count() == 4);
+		CHECK(po.get_file_path(po.get_catalogs()[0].m_file_id) == L"fr.po");
+		CHECK(po.get_file_path(po.get_catalogs()[1].m_file_id) == L"fr_CA.po");
+		REQUIRE(po.get_catalogs()[1].m_entries.size() == 2);
+		CHECK(po.get_catalogs()[1].m_entries[1].m_source == L"Close");
+		CHECK(po.get_catalogs()[1].m_entries[1].m_translation == L"Fermer");
+		po.clear_results();
+		CHECK(po.get_catalogs().empty());
+		}
+
+	SECTION("Issue values")
+		{
+		po_file_review po(false);
+		po.set_style(static_cast<review_style>(check_mismatching_printf_commands | check_numbers));
+		const wchar_t* code = LR"(
+
+#: ../src/common/file.cpp:604
+#, c-format
+msgid "Opening %s"
+msgstr "Ouverture de %d"
+
+#: ../src/common/file.cpp:612
+msgid "Page 2"
+msgstr "Page 3")";
+		po(code, L"fr.po");
+		po.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+
+		REQUIRE(po.get_catalogs().size() == 1);
+		const auto& catalog = po.get_catalogs()[0];
+		REQUIRE(catalog.m_issues.size() == 2);
+		CHECK(catalog.get_entries_with_issues_count() == 2);
+		// refers to the entry's strings
+		CHECK(catalog.m_issues[0].m_issue == translation_issue::printf_issue);
+		CHECK(catalog.m_issues[0].m_entry == 0);
+		CHECK(catalog.get_entry(catalog.m_issues[0]).m_source == L"Opening %s");
+		CHECK(catalog.get_issue_value(catalog.m_issues[0]) == L"'Opening %s' vs. 'Ouverture de %d'");
+		// details that aren't in the entry
+		CHECK(catalog.m_issues[1].m_issue == translation_issue::number_issue);
+		CHECK(catalog.m_issues[1].m_entry == 1);
+		CHECK(catalog.get_issue_value(catalog.m_issues[1]) == L"Number differences: '2' vs. '3'");
+		}
+	}
+
 TEST_CASE("Accelerator Mismatch", "[po][l10n]")
 	{
 	SECTION("Real")
@@ -49,9 +176,7 @@ msgstr "Сервер")";
 		po(code, L"");
 		po.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
 
-		const auto issues = std::count_if(
-			po.get_catalog_entries().cbegin(), po.get_catalog_entries().cend(), [](const auto& ent)
-			{ return ent.second.m_issues.size() > 0; });
+		const auto issues = po.get_catalog_entries_with_issues_count();
 		CHECK(issues == 1);
 		}
 
@@ -71,9 +196,7 @@ msgstr "Сервер & Internet")";
 		po(code, L"");
 		po.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
 
-		const auto issues = std::count_if(
-			po.get_catalog_entries().cbegin(), po.get_catalog_entries().cend(), [](const auto& ent)
-			{ return ent.second.m_issues.size() > 0; });
+		const auto issues = po.get_catalog_entries_with_issues_count();
 		CHECK(issues == 0);
 		}
 
@@ -93,9 +216,7 @@ msgstr "Сервер")";
 		po(code, L"");
 		po.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
 
-		const auto issues = std::count_if(
-			po.get_catalog_entries().cbegin(), po.get_catalog_entries().cend(), [](const auto& ent)
-			{ return ent.second.m_issues.size() > 0; });
+		const auto issues = po.get_catalog_entries_with_issues_count();
 		CHECK(issues == 0);
 		}
 	}
@@ -114,9 +235,7 @@ msgstr "PORT 8: 650 Сервер не поддерживает команду.")
 		po(code, L"");
 		po.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
 
-		const auto issues = std::count_if(
-			po.get_catalog_entries().cbegin(), po.get_catalog_entries().cend(), [](const auto& ent)
-			{ return ent.second.m_issues.size() > 0; });
+		const auto issues = po.get_catalog_entries_with_issues_count();
 		CHECK(issues == 0);
 		}
 
@@ -132,9 +251,7 @@ msgstr "PORT 9: 650 Сервер не поддерживает команду.")
 		po(code, L"");
 		po.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
 
-		const auto issues = std::count_if(
-			po.get_catalog_entries().cbegin(), po.get_catalog_entries().cend(), [](const auto& ent)
-			{ return ent.second.m_issues.size() > 0; });
+		const auto issues = po.get_catalog_entries_with_issues_count();
 		CHECK(issues == 1);
 		}
 
@@ -151,9 +268,7 @@ msgstr ""
 		po(code, L"");
 		po.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
 
-		const auto issues = std::count_if(
-			po.get_catalog_entries().cbegin(), po.get_catalog_entries().cend(), [](const auto& ent)
-			{ return ent.second.m_issues.size() > 0; });
+		const auto issues = po.get_catalog_entries_with_issues_count();
 		CHECK(issues == 0);
 		}
 
@@ -170,9 +285,7 @@ msgstr ""
 		po(code, L"");
 		po.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
 
-		const auto issues = std::count_if(
-			po.get_catalog_entries().cbegin(), po.get_catalog_entries().cend(), [](const auto& ent)
-			{ return ent.second.m_issues.size() > 0; });
+		const auto issues = po.get_catalog_entries_with_issues_count();
 		CHECK(issues == 0);
 		}
 
@@ -188,9 +301,7 @@ msgstr "PORT 8: 650 Сервер не поддерживает команду 72
 		po(code, L"");
 		po.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
 
-		const auto issues = std::count_if(
-			po.get_catalog_entries().cbegin(), po.get_catalog_entries().cend(), [](const auto& ent)
-			{ return ent.second.m_issues.size() > 0; });
+		const auto issues = po.get_catalog_entries_with_issues_count();
 		CHECK(issues == 1);
 		}
 
@@ -206,9 +317,7 @@ msgstr "PORT 8,7: 650 Сервер не поддерживает команду.
 		po(code, L"");
 		po.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
 
-		const auto issues = std::count_if(
-			po.get_catalog_entries().cbegin(), po.get_catalog_entries().cend(), [](const auto& ent)
-			{ return ent.second.m_issues.size() > 0; });
+		const auto issues = po.get_catalog_entries_with_issues_count();
 		CHECK(issues == 0);
 		}
 
@@ -224,9 +333,7 @@ msgstr "Лист A3 297 x 420 мм")";
 		po(code, L"");
 		po.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
 
-		const auto issues = std::count_if(
-			po.get_catalog_entries().cbegin(), po.get_catalog_entries().cend(), [](const auto& ent)
-			{ return ent.second.m_issues.size() > 0; });
+		const auto issues = po.get_catalog_entries_with_issues_count();
 		CHECK(issues == 0);
 		}
 
@@ -242,9 +349,7 @@ msgstr "Koevert nr.9, 3 7/8 x 8 7/8 duim")";
 		po(code, L"");
 		po.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
 
-		const auto issues = std::count_if(
-			po.get_catalog_entries().cbegin(), po.get_catalog_entries().cend(), [](const auto& ent)
-			{ return ent.second.m_issues.size() > 0; });
+		const auto issues = po.get_catalog_entries_with_issues_count();
 		CHECK(issues == 0);
 		}
 
@@ -260,9 +365,7 @@ msgstr "PORT 8,7: 650 Сервер не поддерживает команду.
 		po(code, L"");
 		po.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
 
-		const auto issues = std::count_if(
-			po.get_catalog_entries().cbegin(), po.get_catalog_entries().cend(), [](const auto& ent)
-			{ return ent.second.m_issues.size() > 0; });
+		const auto issues = po.get_catalog_entries_with_issues_count();
 		CHECK(issues == 0);
 		}
 
@@ -278,9 +381,7 @@ msgstr "PORT 8,6: 650 Сервер не поддерживает команду.
 		po(code, L"");
 		po.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
 
-		const auto issues = std::count_if(
-			po.get_catalog_entries().cbegin(), po.get_catalog_entries().cend(), [](const auto& ent)
-			{ return ent.second.m_issues.size() > 0; });
+		const auto issues = po.get_catalog_entries_with_issues_count();
 		CHECK(issues == 1);
 		}
 	}
@@ -311,9 +412,7 @@ msgstr "Сервер не поддерживает команду PORT."")";
 		po(code, L"");
 		po.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
 
-		const auto issues = std::count_if(
-			po.get_catalog_entries().cbegin(), po.get_catalog_entries().cend(), [](const auto& ent)
-			{ return ent.second.m_issues.size() > 0; });
+		const auto issues = po.get_catalog_entries_with_issues_count();
 		CHECK(issues == 0);
 		}
 
@@ -334,9 +433,7 @@ msgstr "Неправильный размер кадра (%d, %s) для frame #
 		po(code, L"");
 		po.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
 
-		const auto issues = std::count_if(
-			po.get_catalog_entries().cbegin(), po.get_catalog_entries().cend(), [](const auto& ent)
-			{ return ent.second.m_issues.size() > 0; });
+		const auto issues = po.get_catalog_entries_with_issues_count();
 		CHECK(issues == 2);
 		}
 
@@ -352,9 +449,7 @@ msgstr "Неправильный размер кадра (%1) для frame %3")"
 		po(code, L"");
 		po.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
 
-		auto issues = std::count_if(
-			po.get_catalog_entries().cbegin(), po.get_catalog_entries().cend(), [](const auto& ent)
-			{ return ent.second.m_issues.size() > 0; });
+		auto issues = po.get_catalog_entries_with_issues_count();
 		CHECK(issues == 1); // translation is missing %2
 		po.clear_results();
 
@@ -367,14 +462,12 @@ msgid "Incorrect frame size (%1, %2) for the frame %3"
 msgstr "Неправильный размер кадра (%2, %1) для frame %3")";
 		po(code, L"");
 		po.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
-		po.get_catalog_entries().clear();
+		po.get_catalogs().clear();
 
-		issues = std::count_if(
-			po.get_catalog_entries().cbegin(), po.get_catalog_entries().cend(), [](const auto& ent)
-			{ return ent.second.m_issues.size() > 0; });
+		issues = po.get_catalog_entries_with_issues_count();
 		CHECK(issues == 0);
 		po.clear_results();
-		po.get_catalog_entries().clear();
+		po.get_catalogs().clear();
 
 		// has an extra %1, missing %2
 		code = LR"(
@@ -386,9 +479,7 @@ msgstr "Неправильный размер кадра (%1, %1) для frame %
 		po(code, L"");
 		po.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
 
-		issues = std::count_if(
-			po.get_catalog_entries().cbegin(), po.get_catalog_entries().cend(), [](const auto& ent)
-			{ return ent.second.m_issues.size() > 0; });
+		issues = po.get_catalog_entries_with_issues_count();
 		CHECK(issues == 1);
 		}
 
@@ -404,9 +495,7 @@ msgstr "Неправильный размер кадра (%u, % s) для frame
 		po(code, L"");
 		po.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
 
-		const auto issues = std::count_if(
-			po.get_catalog_entries().cbegin(), po.get_catalog_entries().cend(), [](const auto& ent)
-			{ return ent.second.m_issues.size() > 0; });
+		const auto issues = po.get_catalog_entries_with_issues_count();
 		CHECK(issues == 1);
 		}
 	}
@@ -428,9 +517,7 @@ msgstr "Неправильный размер кадра (%d, %s) для frame #
 		po(code, L"");
 		po.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
 
-		const auto issues = std::count_if(
-			po.get_catalog_entries().cbegin(), po.get_catalog_entries().cend(), [](const auto& ent)
-			{ return ent.second.m_issues.size() > 0; });
+		const auto issues = po.get_catalog_entries_with_issues_count();
 		CHECK(issues == 0);
 		}
 
@@ -452,9 +539,7 @@ msgstr "Неправильный размер кадра (%d, %s) для frame #
 		po(code, L"");
 		po.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
 
-		const auto issues = std::count_if(
-			po.get_catalog_entries().cbegin(), po.get_catalog_entries().cend(), [](const auto& ent)
-			{ return ent.second.m_issues.size() > 0; });
+		const auto issues = po.get_catalog_entries_with_issues_count();
 		CHECK(issues == 2);
 		}
 
@@ -475,9 +560,7 @@ msgstr "Неправильный размер кадра (%d, %s) для frame #
 		po(code, L"");
 		po.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
 
-		const auto issues = std::count_if(
-			po.get_catalog_entries().cbegin(), po.get_catalog_entries().cend(), [](const auto& ent)
-			{ return ent.second.m_issues.size() > 0; });
+		const auto issues = po.get_catalog_entries_with_issues_count();
 		CHECK(issues == 0);
 		}
 
@@ -494,9 +577,7 @@ msgstr "Bolumena: %%%ld.")";
 	po(code, L"");
 	po.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
 
-	const auto issues = std::count_if(
-		po.get_catalog_entries().cbegin(), po.get_catalog_entries().cend(), [](const auto& ent)
-		{ return ent.second.m_issues.size() > 0; });
+	const auto issues = po.get_catalog_entries_with_issues_count();
 	CHECK(issues == 0);
 	}
 
@@ -513,9 +594,7 @@ msgstr "Bolumena: %%%d")";
 	po(code, L"");
 	po.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
 
-	const auto issues = std::count_if(
-		po.get_catalog_entries().cbegin(), po.get_catalog_entries().cend(), [](const auto& ent)
-		{ return ent.second.m_issues.size() > 0; });
+	const auto issues = po.get_catalog_entries_with_issues_count();
 	CHECK(issues == 1);
 	}
 
@@ -532,9 +611,7 @@ msgstr "%d%d bloques en 0x%02x")";
 	po(code, L"");
 	po.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
 
-	const auto issues = std::count_if(
-		po.get_catalog_entries().cbegin(), po.get_catalog_entries().cend(), [](const auto& ent)
-		{ return ent.second.m_issues.size() > 0; });
+	const auto issues = po.get_catalog_entries_with_issues_count();
 	CHECK(issues == 0);
 	}
 
@@ -552,9 +629,7 @@ msgstr "Неправильный размер кадра (%2$s, %1$u) для val
 		po(code, L"");
 		po.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
 
-		const auto issues = std::count_if(
-			po.get_catalog_entries().cbegin(), po.get_catalog_entries().cend(), [](const auto& ent)
-			{ return ent.second.m_issues.size() > 0; });
+		const auto issues = po.get_catalog_entries_with_issues_count();
 		CHECK(issues == 0);
 		}
 
@@ -570,9 +645,7 @@ msgstr "Неправильный %2$s размер кадра (%2$s, %1$u) дл
 		po(code, L"");
 		po.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
 
-		const auto issues = std::count_if(
-			po.get_catalog_entries().cbegin(), po.get_catalog_entries().cend(), [](const auto& ent)
-			{ return ent.second.m_issues.size() > 0; });
+		const auto issues = po.get_catalog_entries_with_issues_count();
 		CHECK(issues == 0);
 		}
 
@@ -588,9 +661,7 @@ msgstr "Неправильный %2$s размер кадра (%2$d, %1$u) дл
 		po(code, L"");
 		po.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
 
-		const auto issues = std::count_if(
-			po.get_catalog_entries().cbegin(), po.get_catalog_entries().cend(), [](const auto& ent)
-			{ return ent.second.m_issues.size() > 0; });
+		const auto issues = po.get_catalog_entries_with_issues_count();
 		CHECK(issues == 1);
 		}
 
@@ -606,11 +677,49 @@ msgstr "Неправильный %u %2$s")";
 		po(code, L"");
 		po.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
 
-		const auto issues = std::count_if(
-			po.get_catalog_entries().cbegin(), po.get_catalog_entries().cend(), [](const auto& ent)
-			{ return ent.second.m_issues.size() > 0; });
+		const auto issues = po.get_catalog_entries_with_issues_count();
 		CHECK(issues == 1);
 		}
 	}
+
+TEST_CASE("Source checks across catalogs", "[po][l10n]")
+	{
+	SECTION("Same msgid in multiple catalogs")
+		{
+		po_file_review po(false);
+		po.set_style(static_cast<review_style>(check_l10n_contains_url | check_needing_context));
+		const wchar_t* code1 = LR"(
+
+#: ../src/common/file.cpp:604
+msgid "Visit www.example.com for more information."
+msgstr "Visitez www.example.com pour plus d'informations."
+
+#: ../src/common/file.cpp:612
+msgid "PRT"
+msgstr "IMP")";
+		const wchar_t* code2 = LR"(
+
+#: ../src/common/file.cpp:604
+msgid "Visit www.example.com for more information."
+msgstr "Besuchen Sie www.example.com für weitere Informationen."
+
+#: ../src/common/file.cpp:612
+msgctxt "Abbreviation for print on a toolbar button"
+msgid "PRT"
+msgstr "DRK")";
+		po(code1, L"fr.po");
+		po(code2, L"de.po");
+		po.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+
+		REQUIRE(po.get_catalog_entry_count() == 4);
+		REQUIRE(po.get_catalogs().size() == 2);
+		// URL issue is reported for each catalog
+		CHECK(po.get_catalogs()[0].get_issue_count(0) == 1);
+		CHECK(po.get_catalogs()[1].get_issue_count(0) == 1);
+		// context check still depends on each entry's own comment
+		CHECK(po.get_catalogs()[0].get_issue_count(1) == 1);
+		CHECK(po.get_catalogs()[1].get_issue_count(1) == 0);
+		}
+	}
 // NOLINTEND
 // clang-format on
@@ -48,6 +48,31 @@ END)";
 		CHECK(rc.get_unsafe_localizable_strings()[0].m_string == L"image.bmp");
 		CHECK(rc.get_unsafe_localizable_strings()[1].m_string == L"%s");
 		}
+
+	SECTION("Options, comments, and line numbers")
+		{
+		rc_file_review rc(false);
+		const wchar_t* code = LR"(// "Not in a table"
+#include "resource.h"
+STRINGTABLE DISCARDABLE
+BEGIN
+    IDS_OPEN "Open the file" // "a comment"
+    /* IDS_OLD "Removed" */
+    IDS_QUOTE "Say ""hello"""
+END
+
+STRINGTABLE
+{
+    IDS_CLOSE "Close the file"
+})";
+		rc(code, L"");
+		REQUIRE(rc.get_localizable_strings().size() == 3);
+		CHECK(rc.get_localizable_strings()[0].m_string == L"Open the file");
+		CHECK(rc.get_localizable_strings()[0].m_line == 5);
+		CHECK(rc.get_localizable_strings()[1].m_string == LR"(Say ""hello"")");
+		CHECK(rc.get_localizable_strings()[2].m_string == L"Close the file");
+		CHECK(rc.get_localizable_strings()[2].m_line == 12);
+		}
 	}
 
 TEST_CASE("Fonts", "[rc][i18n]")
@@ -80,6 +105,21 @@ BEGIN)";
 		REQUIRE(rc.get_non_system_dialog_fonts().size() == 1);
 		CHECK(rc.get_non_system_dialog_fonts()[0].m_string == LR"(Comic Sans)");
 	}
+
+	SECTION("Font statements")
+	{
+		rc_file_review rc(false);
+		const wchar_t* code = LR"(IDD_ABOUTBOX DIALOGEX 0, 0, 170, 184
+CAPTION "FONT 12, ""Arial"""
+FONT 0xC , "MS Shell Dlg 2", 0, 0, 0x1
+BEGIN
+END)";
+		rc(code, L"");
+		REQUIRE(rc.get_bad_dialog_font_sizes().size() == 1);
+		CHECK(rc.get_bad_dialog_font_sizes()[0].m_string == LR"(12)");
+		CHECK(rc.get_bad_dialog_font_sizes()[0].m_line == 3);
+		CHECK(rc.get_non_system_dialog_fonts().empty());
+	}
 }
 // NOLINTEND
 // clang-format on
@@ -0,0 +1,156 @@
+#include "../src/local_server.h"
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
+#include <chrono>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#ifndef _WIN32
+	#include <unistd.h>
+#endif
+
+// NOLINTBEGIN
+using namespace i18n_check;
+using namespace Catch::Matchers;
+using namespace std::string_literals;
+
+#ifndef _WIN32
+namespace
+	{
+	/// @brief Starts (once) a server that echoes each request back:
+	///     the working directory and each argument on their own lines, bracketed
+	///     (so that empty arguments show). The exit code is the number of arguments.
+	///     The arguments "large", "null", and "throw" send a large response,
+	///     one with an embedded NUL, or throw an exception.
+	std::filesystem::path start_echo_server()
+		{
+		static const std::filesystem::path socketPath{ std::filesystem::temp_directory_path() /
+			("quneiform-test-" + std::to_string(::getpid()) + ".sock") };
+		static std::once_flag started;
+		std::call_once(started,
+			[]()
+			{
+			std::thread serverThread(
+				[]()
+				{
+				std::wstring errorInfo;
+				run_local_server(socketPath,
+					[](const std::filesystem::path& workingDirectory,
+					   const std::vector<std::string>& args, std::ostream& response)
+					{
+					response << "[" << workingDirectory.string() << "]\n";
+					for (const auto& arg : args)
+						{
+						if (arg == "large")
+							{
+							for (size_t i = 0; i < 100'000; ++i)
+								{
+								response << "line " << i << " \xC3\xA9\xF0\x9F\x98\x80\n";
+								}
+							}
+						else if (arg == "null")
+							{
+							response << "before" << '\0' << "after\n";
+							}
+						else if (arg == "throw")
+							{
+							throw std::runtime_error("Request failed");
+							}
+						response << "[" << arg << "]\n";
+						}
+					return static_cast<int>(args.size());
+					},
+					errorInfo);
+				});
+			serverThread.detach();
+			});
+		return socketPath;
+		}
+
+	/// @brief Sends a request to the echo server, waiting for it to start if necessary.
+	std::optional<int> send_echo_request(const std::vector<std::string>& args,
+										 std::ostream& response)
+		{
+		const auto socketPath = start_echo_server();
+		std::wstring errorInfo;
+		for (int attempt = 0; attempt < 200; ++attempt)
+			{
+			if (std::filesystem::is_socket(socketPath))
+				{
+				return send_local_request(socketPath, "/client/folder", args, response,
+										  errorInfo);
+				}
+			std::this_thread::sleep_for(std::chrono::milliseconds(10));
+			}
+		return std::nullopt;
+		}
+	}
+
+// clang-format off
+TEST_CASE("Local server", "[server][i18n]")
+	{
+	SECTION("Round trip")
+		{
+		std::ostringstream response;
+		const auto exitCode = send_echo_request({ "--enable=allI18N", "", "src" }, response);
+		REQUIRE(exitCode);
+		CHECK(*exitCode == 3);
+		CHECK(response.str() == "[/client/folder]\n[--enable=allI18N]\n[]\n[src]\n");
+		}
+
+	SECTION("No arguments")
+		{
+		std::ostringstream response;
+		const auto exitCode = send_echo_request({}, response);
+		REQUIRE(exitCode);
+		CHECK(*exitCode == 0);
+		CHECK(response.str() == "[/client/folder]\n");
+		}
+
+	SECTION("Large response")
+		{
+		std::ostringstream response;
+		const auto exitCode = send_echo_request({ "large" }, response);
+		REQUIRE(exitCode);
+		CHECK(*exitCode == 1);
+		const std::string responseText{ response.str() };
+		CHECK(responseText.starts_with("[/client/folder]\nline 0 \xC3\xA9\xF0\x9F\x98\x80\n"));
+		CHECK(responseText.ends_with("line 99999 \xC3\xA9\xF0\x9F\x98\x80\n[large]\n"));
+		CHECK(std::count(responseText.cbegin(), responseText.cend(), '\n') == 100'002);
+		}
+
+	SECTION("Embedded NUL in response")
+		{
+		std::ostringstream response;
+		const auto exitCode = send_echo_request({ "null", "x" }, response);
+		REQUIRE(exitCode);
+		CHECK(*exitCode == 2);
+		CHECK(response.str() == "[/client/folder]\nbefore\0after\n[null]\n[x]\n"s);
+		}
+
+	SECTION("Handler error")
+		{
+		std::ostringstream response;
+		const auto exitCode = send_echo_request({ "a", "throw" }, response);
+		REQUIRE(exitCode);
+		CHECK(*exitCode == 1);
+		CHECK(response.str() == "[/client/folder]\n[a]\nError: Request failed\n");
+		}
+
+	SECTION("No server")
+		{
+		std::ostringstream response;
+		std::wstring errorInfo;
+		const auto exitCode = send_local_request(
+			std::filesystem::temp_directory_path() / "quneiform-test-missing.sock",
+			"/client/folder", { "src" }, response, errorInfo);
+		CHECK_FALSE(exitCode);
+		CHECK_FALSE(errorInfo.empty());
+		CHECK(response.str().empty());
+		}
+	}
+#endif
+// NOLINTEND
+// clang-format on